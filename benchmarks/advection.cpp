@@ -0,0 +1,325 @@
+// SPDX-License-Identifier: MIT
+/*
+    Benchmarks of the BslAdvection1D operator used as a spatial advection (along X,
+    advection field given by Vx) and as a velocity advection (along Vx, advection
+    field given by a function of X).
+*/
+#include <string>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/splines.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "bsl_advection_1d.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "euler.hpp"
+#include "lagrange_basis_uniform.hpp"
+#include "lagrange_interpolation.hpp"
+#include "spline_interpolation.hpp"
+
+namespace {
+
+struct X
+{
+    static bool constexpr PERIODIC = true;
+};
+struct Vx
+{
+    static bool constexpr PERIODIC = false;
+};
+
+using CoordX = Coord<X>;
+using CoordVx = Coord<Vx>;
+
+// A discrete space can only be initialised once so each number of cells has its own tags
+template <int NX>
+struct BSplinesX : ddc::UniformBSplines<X, 3>
+{
+};
+template <int NVX>
+struct BSplinesVx : ddc::UniformBSplines<Vx, 3>
+{
+};
+
+ddc::BoundCond constexpr SplineXBoundary = ddc::BoundCond::PERIODIC;
+ddc::BoundCond constexpr SplineVxBoundary = ddc::BoundCond::GREVILLE;
+
+template <int NX>
+struct GridX : UniformGridBase<X>
+{
+};
+template <int NVX>
+struct GridVx : UniformGridBase<Vx>
+{
+};
+
+template <int NX>
+using SplineInterpPointsX
+        = ddc::GrevilleInterpolationPoints<BSplinesX<NX>, SplineXBoundary, SplineXBoundary>;
+template <int NVX>
+using SplineInterpPointsVx
+        = ddc::GrevilleInterpolationPoints<BSplinesVx<NVX>, SplineVxBoundary, SplineVxBoundary>;
+
+template <int NX>
+struct LagBasisX : UniformLagrangeBasis<X, 3, double>
+{
+};
+
+template <int NX, int NVX>
+using IdxRangeXVx = IdxRange<GridX<NX>, GridVx<NVX>>;
+template <int NX, int NVX>
+using IdxXVx = Idx<GridX<NX>, GridVx<NVX>>;
+
+template <int NX, int NVX>
+using DFieldMemXVx = DFieldMem<IdxRangeXVx<NX, NVX>>;
+template <int NX, int NVX>
+using DFieldXVx = DField<IdxRangeXVx<NX, NVX>>;
+
+template <int NX>
+using SplineInterpolatorX = SplineInterpolator<
+        Kokkos::DefaultExecutionSpace,
+        BSplinesX<NX>,
+        GridX<NX>,
+        ExtrapolationRule::PERIODIC,
+        ExtrapolationRule::PERIODIC,
+        SplineXBoundary,
+        SplineXBoundary>;
+
+template <int NVX>
+using SplineInterpolatorVx = SplineInterpolator<
+        Kokkos::DefaultExecutionSpace,
+        BSplinesVx<NVX>,
+        GridVx<NVX>,
+        ExtrapolationRule::CONSTANT,
+        ExtrapolationRule::CONSTANT,
+        SplineVxBoundary,
+        SplineVxBoundary>;
+
+template <int NX>
+using LagrangeInterpolatorX = LagrangeInterpolator<
+        Kokkos::DefaultExecutionSpace,
+        LagBasisX<NX>,
+        GridX<NX>,
+        ExtrapolationRule::PERIODIC,
+        ExtrapolationRule::PERIODIC>;
+
+/**
+ * @brief Initialise the discrete spaces on a (X, Vx) mesh if this was not done by a
+ * previous case.
+ *
+ * @tparam NX The number of cells along X.
+ * @tparam NVX The number of cells along Vx.
+ *
+ * @return The index range of the mesh.
+ */
+template <int NX, int NVX>
+IdxRangeXVx<NX, NVX> init_idx_range_xvx()
+{
+    if (!ddc::is_discrete_space_initialized<GridX<NX>>()) {
+        ddc::init_discrete_space<
+                BSplinesX<NX>>(CoordX(0.0), CoordX(2 * M_PI), IdxStep<GridX<NX>>(NX));
+        ddc::init_discrete_space<GridX<NX>>(
+                SplineInterpPointsX<NX>::template get_sampling<GridX<NX>>());
+    }
+    if (!ddc::is_discrete_space_initialized<GridVx<NVX>>()) {
+        ddc::init_discrete_space<
+                BSplinesVx<NVX>>(CoordVx(-6.0), CoordVx(6.0), IdxStep<GridVx<NVX>>(NVX));
+        ddc::init_discrete_space<GridVx<NVX>>(
+                SplineInterpPointsVx<NVX>::template get_sampling<GridVx<NVX>>());
+    }
+    IdxRange<GridX<NX>> idx_range_x(SplineInterpPointsX<NX>::template get_domain<GridX<NX>>());
+    IdxRange<GridVx<NVX>> idx_range_vx(
+            SplineInterpPointsVx<NVX>::template get_domain<GridVx<NVX>>());
+    return IdxRangeXVx<NX, NVX>(idx_range_x, idx_range_vx);
+}
+
+/**
+ * @brief Fill the distribution function and the advection fields.
+ *
+ * @param[out] fdistribu A Maxwellian modulated along X.
+ * @param[out] spatial_advection_field The advection field along X (Vx).
+ * @param[out] velocity_advection_field The advection field along Vx (a function of X).
+ */
+template <int NX, int NVX>
+void fill_fields(
+        DFieldXVx<NX, NVX> fdistribu,
+        DFieldXVx<NX, NVX> spatial_advection_field,
+        DFieldXVx<NX, NVX> velocity_advection_field)
+{
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(fdistribu),
+            KOKKOS_LAMBDA(IdxXVx<NX, NVX> const ixvx) {
+                double const x = ddc::coordinate(Idx<GridX<NX>>(ixvx));
+                double const v = ddc::coordinate(Idx<GridVx<NVX>>(ixvx));
+                fdistribu(ixvx) = (1.0 + 0.1 * Kokkos::cos(x)) * Kokkos::exp(-0.5 * v * v);
+                spatial_advection_field(ixvx) = v;
+                velocity_advection_field(ixvx) = 0.5 * Kokkos::sin(x);
+            });
+}
+
+template <int NX, int NVX, class Interpolator>
+void run_spatial_advection(benchmark::State& state, Interpolator const& interpolator)
+{
+    IdxRangeXVx<NX, NVX> const idx_range(
+            SplineInterpPointsX<NX>::template get_domain<GridX<NX>>(),
+            SplineInterpPointsVx<NVX>::template get_domain<GridVx<NVX>>());
+    SplineInterpolatorX<NX> const adv_field_interpolator(ddc::select<GridX<NX>>(idx_range));
+
+    EulerBuilder const euler;
+    BslAdvection1D<
+            GridX<NX>,
+            IdxRangeXVx<NX, NVX>,
+            IdxRangeXVx<NX, NVX>,
+            Interpolator,
+            SplineInterpolatorX<NX>,
+            EulerBuilder> const advection(interpolator, adv_field_interpolator, euler);
+
+    DFieldMemXVx<NX, NVX> fdistribu_alloc(idx_range);
+    DFieldMemXVx<NX, NVX> spatial_advection_field_alloc(idx_range);
+    DFieldMemXVx<NX, NVX> velocity_advection_field_alloc(idx_range);
+    fill_fields<NX, NVX>(
+            get_field(fdistribu_alloc),
+            get_field(spatial_advection_field_alloc),
+            get_field(velocity_advection_field_alloc));
+    Kokkos::fence();
+
+    double const dt = 0.01;
+    for (auto _ : state) {
+        advection(get_field(fdistribu_alloc), get_field(spatial_advection_field_alloc), dt);
+        Kokkos::fence();
+    }
+    state.SetItemsProcessed(state.iterations() * idx_range.size());
+}
+
+template <int NX, int NVX>
+void BM_SpatialAdvectionSpline(benchmark::State& state)
+{
+    IdxRangeXVx<NX, NVX> const idx_range = init_idx_range_xvx<NX, NVX>();
+    SplineInterpolatorX<NX> const interpolator(ddc::select<GridX<NX>>(idx_range));
+    run_spatial_advection<NX, NVX>(state, interpolator);
+}
+
+template <int NX, int NVX>
+void BM_SpatialAdvectionLagrange(benchmark::State& state)
+{
+    IdxRangeXVx<NX, NVX> const idx_range = init_idx_range_xvx<NX, NVX>();
+    if (!ddc::is_discrete_space_initialized<LagBasisX<NX>>()) {
+        IdxRange<GridX<NX>> const idx_range_x = ddc::select<GridX<NX>>(idx_range);
+        IdxRange<GridX<NX>> const lagrange_break_point_idx_range(
+                idx_range_x.front(),
+                idx_range_x.extents() + 1);
+        ddc::init_discrete_space<LagBasisX<NX>>(lagrange_break_point_idx_range);
+    }
+    LagrangeInterpolatorX<NX> const interpolator;
+    run_spatial_advection<NX, NVX>(state, interpolator);
+}
+
+template <int NX, int NVX>
+void BM_VelocityAdvectionSpline(benchmark::State& state)
+{
+    IdxRangeXVx<NX, NVX> const idx_range = init_idx_range_xvx<NX, NVX>();
+    SplineInterpolatorVx<NVX> const interpolator(ddc::select<GridVx<NVX>>(idx_range));
+
+    EulerBuilder const euler;
+    BslAdvection1D<
+            GridVx<NVX>,
+            IdxRangeXVx<NX, NVX>,
+            IdxRangeXVx<NX, NVX>,
+            SplineInterpolatorVx<NVX>,
+            SplineInterpolatorVx<NVX>,
+            EulerBuilder> const advection(interpolator, euler);
+
+    DFieldMemXVx<NX, NVX> fdistribu_alloc(idx_range);
+    DFieldMemXVx<NX, NVX> spatial_advection_field_alloc(idx_range);
+    DFieldMemXVx<NX, NVX> velocity_advection_field_alloc(idx_range);
+    fill_fields<NX, NVX>(
+            get_field(fdistribu_alloc),
+            get_field(spatial_advection_field_alloc),
+            get_field(velocity_advection_field_alloc));
+    Kokkos::fence();
+
+    double const dt = 0.01;
+    for (auto _ : state) {
+        advection(get_field(fdistribu_alloc), get_field(velocity_advection_field_alloc), dt);
+        Kokkos::fence();
+    }
+    state.SetItemsProcessed(state.iterations() * idx_range.size());
+}
+
+/**
+ * @brief Register a benchmark for each combination of a number of cells along X and a number
+ * of cells along Vx.
+ *
+ * @param[in] name The name of the benchmark.
+ * @param[in] nx The number of cells along X.
+ * @param[in] benchmark_fns The benchmark functions for each number of cells along Vx.
+ *
+ * @tparam NVX The numbers of cells along Vx.
+ */
+template <int... NVX, class... BenchmarkFn>
+void register_benchmark_nvx(std::string const& name, int nx, BenchmarkFn... benchmark_fns)
+{
+    (benchmark::RegisterBenchmark(
+             (name + "/nx:" + std::to_string(nx) + "/nvx:" + std::to_string(NVX)).c_str(),
+             benchmark_fns)
+             ->Unit(benchmark::kMillisecond)
+             ->UseRealTime(),
+     ...);
+}
+
+/**
+ * @brief Register the spatial advection benchmarks for a number of cells along X.
+ *
+ * @tparam NX The number of cells along X.
+ */
+template <int NX>
+void register_spatial_benchmarks()
+{
+    register_benchmark_nvx<64, 256>(
+            "BM_SpatialAdvectionSpline",
+            NX,
+            BM_SpatialAdvectionSpline<NX, 64>,
+            BM_SpatialAdvectionSpline<NX, 256>);
+    register_benchmark_nvx<64, 256>(
+            "BM_SpatialAdvectionLagrange",
+            NX,
+            BM_SpatialAdvectionLagrange<NX, 64>,
+            BM_SpatialAdvectionLagrange<NX, 256>);
+}
+
+/**
+ * @brief Register the velocity advection benchmarks for a number of cells along X.
+ *
+ * @tparam NX The number of cells along X.
+ */
+template <int NX>
+void register_velocity_benchmarks()
+{
+    register_benchmark_nvx<64, 256, 1024>(
+            "BM_VelocityAdvectionSpline",
+            NX,
+            BM_VelocityAdvectionSpline<NX, 64>,
+            BM_VelocityAdvectionSpline<NX, 256>,
+            BM_VelocityAdvectionSpline<NX, 1024>);
+}
+
+/**
+ * @brief Register all the advection benchmarks.
+ *
+ * @return True once the benchmarks are registered.
+ */
+bool register_benchmarks()
+{
+    register_spatial_benchmarks<64>();
+    register_spatial_benchmarks<256>();
+    register_spatial_benchmarks<1024>();
+    register_velocity_benchmarks<64>();
+    register_velocity_benchmarks<256>();
+    return true;
+}
+
+[[maybe_unused]] bool const benchmarks_registered = register_benchmarks();
+
+} // namespace
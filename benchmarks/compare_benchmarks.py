@@ -0,0 +1,100 @@
+#!/bin/env python3
+
+# SPDX-License-Identifier: MIT
+
+""" Compare two JSON outputs of gyselalibxx_benchmarks and flag the benchmarks
+whose time increased by more than a given threshold.
+
+Usage:
+    ./gyselalibxx_benchmarks --benchmark_out=baseline.json --benchmark_out_format=json
+    ./gyselalibxx_benchmarks --benchmark_out=candidate.json --benchmark_out_format=json
+    python3 compare_benchmarks.py baseline.json candidate.json --threshold 0.05
+
+The script exits with a non-zero status if a regression is found.
+"""
+
+import json
+import sys
+
+from argparse import ArgumentParser
+from pathlib import Path
+
+
+def load_benchmarks(filename):
+    """ Read a Google Benchmark JSON file.
+
+    Parameters
+    ----------
+    filename : Path
+        The JSON file written with --benchmark_out_format=json.
+
+    Returns
+    -------
+    dict
+        A dictionary mapping the benchmark names to their real time (in the unit of the benchmark).
+        If repetitions were used then only the median aggregate is kept.
+    """
+    with open(filename, encoding='utf-8') as f:
+        data = json.load(f)
+
+    times = {}
+    for bench in data['benchmarks']:
+        run_type = bench.get('run_type', 'iteration')
+        if run_type == 'aggregate':
+            if bench.get('aggregate_name') != 'median':
+                continue
+            name = bench['run_name']
+        else:
+            name = bench['name']
+            # Prefer aggregates when they exist
+            if name in times:
+                continue
+        times[name] = bench['real_time']
+    return times
+
+
+if __name__ == '__main__':
+    parser = ArgumentParser(description="Compare two runs of gyselalibxx_benchmarks.")
+    parser.add_argument('baseline',
+                        action='store',
+                        type=Path,
+                        help='JSON output of the reference run')
+    parser.add_argument('candidate',
+                        action='store',
+                        type=Path,
+                        help='JSON output of the run to be checked')
+    parser.add_argument('-t', '--threshold',
+                        action='store',
+                        default=0.1,
+                        type=float,
+                        help='relative increase in time above which a benchmark is flagged as a regression')
+    args = parser.parse_args()
+
+    baseline = load_benchmarks(args.baseline)
+    candidate = load_benchmarks(args.candidate)
+
+    common_names = [name for name in baseline if name in candidate]
+    name_width = max((len(name) for name in common_names), default=4)
+
+    print(f"{'Name':<{name_width}}  {'Baseline':>12}  {'Candidate':>12}  {'Change':>8}")
+    regressions = []
+    for name in common_names:
+        change = (candidate[name] - baseline[name]) / baseline[name]
+        flag = ''
+        if change > args.threshold:
+            flag = '  REGRESSION'
+            regressions.append(name)
+        elif change < -args.threshold:
+            flag = '  improvement'
+        print(f"{name:<{name_width}}  {baseline[name]:>12.4g}  {candidate[name]:>12.4g}  {change:>+8.1%}{flag}")
+
+    for name in baseline:
+        if name not in candidate:
+            print(f"Missing from candidate run: {name}")
+    for name in candidate:
+        if name not in baseline:
+            print(f"New benchmark: {name}")
+
+    if regressions:
+        print(f"{len(regressions)} regression(s) found above the {args.threshold:.0%} threshold.")
+        sys.exit(1)
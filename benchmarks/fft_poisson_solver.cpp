@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: MIT
+/*
+    Benchmarks of the FFTPoissonSolver on a 2D periodic domain and on a batch of 1D periodic domains.
+*/
+#include <string>
+
+#include <ddc/ddc.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "fft_poisson_solver.hpp"
+#include "vector_field.hpp"
+#include "vector_field_mem.hpp"
+
+namespace {
+
+/*
+ * A discrete space can only be initialised once and FFTPoissonSolver initialises a Fourier
+ * space for each continuous dimension, so each mesh size has its own dimensions and grids.
+ */
+template <int NX, int NY>
+struct X
+{
+    static bool constexpr PERIODIC = true;
+};
+template <int NX, int NY>
+struct Y
+{
+    static bool constexpr PERIODIC = true;
+};
+template <int NX>
+struct XBatched
+{
+    static bool constexpr PERIODIC = true;
+};
+struct Batch
+{
+};
+
+template <class Dim>
+struct GridPeriodic : UniformGridBase<Dim>
+{
+};
+struct GridBatch : UniformGridBase<Batch>
+{
+};
+
+using IdxBatch = Idx<GridBatch>;
+using IdxStepBatch = IdxStep<GridBatch>;
+using IdxRangeBatch = IdxRange<GridBatch>;
+
+/**
+ * @brief Initialise a uniform periodic grid on [0, 2 pi[ if this was not done by a previous case.
+ *
+ * @param[in] n The number of points.
+ *
+ * @return The index range of the grid.
+ */
+template <class Grid>
+IdxRange<Grid> init_periodic_grid(int n)
+{
+    using Dim = typename Grid::continuous_dimension_type;
+    Coord<Dim> const min(0.0);
+    Coord<Dim> const max(2.0 * M_PI);
+    if (!ddc::is_discrete_space_initialized<Grid>()) {
+        ddc::init_discrete_space<Grid>(Grid::template init<Grid>(min, max, IdxStep<Grid>(n + 1)));
+    }
+    return IdxRange<Grid>(Idx<Grid>(0), IdxStep<Grid>(n));
+}
+
+template <int NX, int NY>
+void BM_FFTPoissonSolver2D(benchmark::State& state)
+{
+    using DimX = X<NX, NY>;
+    using DimY = Y<NX, NY>;
+    using GridX = GridPeriodic<DimX>;
+    using GridY = GridPeriodic<DimY>;
+    using IdxX = Idx<GridX>;
+    using IdxY = Idx<GridY>;
+    using IdxXY = Idx<GridX, GridY>;
+    using IdxRangeXY = IdxRange<GridX, GridY>;
+    using PoissonSolver = FFTPoissonSolver<IdxRangeXY, IdxRangeXY, Kokkos::DefaultExecutionSpace>;
+
+    IdxRange<GridX> const idx_range_x = init_periodic_grid<GridX>(NX);
+    IdxRange<GridY> const idx_range_y = init_periodic_grid<GridY>(NY);
+    IdxRangeXY const idx_range(idx_range_x, idx_range_y);
+
+    // The constructor initialises the Fourier spaces so it is only called by the first run
+    static PoissonSolver const poisson(idx_range);
+
+    DFieldMem<IdxRangeXY> rhs_alloc(idx_range);
+    DFieldMem<IdxRangeXY> electrostatic_potential_alloc(idx_range);
+    VectorFieldMem<double, IdxRangeXY, VectorIndexSet<DimX, DimY>> electric_field_alloc(idx_range);
+    DField<IdxRangeXY> rhs = get_field(rhs_alloc);
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            idx_range,
+            KOKKOS_LAMBDA(IdxXY const ixy) {
+                double const x = ddc::coordinate(IdxX(ixy));
+                double const y = ddc::coordinate(IdxY(ixy));
+                rhs(ixy) = Kokkos::cos(x) * Kokkos::sin(2 * y);
+            });
+    Kokkos::fence();
+
+    for (auto _ : state) {
+        poisson(get_field(electrostatic_potential_alloc), get_field(electric_field_alloc), rhs);
+        Kokkos::fence();
+    }
+    state.SetItemsProcessed(state.iterations() * idx_range.size());
+}
+
+template <int NX>
+void BM_FFTPoissonSolverBatched1D(benchmark::State& state)
+{
+    using GridX = GridPeriodic<XBatched<NX>>;
+    using IdxX = Idx<GridX>;
+    using IdxRangeX = IdxRange<GridX>;
+    using IdxBatchX = Idx<GridBatch, GridX>;
+    using IdxRangeBatchX = IdxRange<GridBatch, GridX>;
+    using PoissonSolver
+            = FFTPoissonSolver<IdxRangeX, IdxRangeBatchX, Kokkos::DefaultExecutionSpace>;
+
+    IdxRangeX const idx_range_x = init_periodic_grid<GridX>(NX);
+    IdxRangeBatch const idx_range_batch(IdxBatch(0), IdxStepBatch(state.range(0)));
+    IdxRangeBatchX const idx_range(idx_range_batch, idx_range_x);
+
+    // The constructor initialises the Fourier space so it is only called by the first run
+    static PoissonSolver const poisson(idx_range_x);
+
+    DFieldMem<IdxRangeBatchX> rhs_alloc(idx_range);
+    DFieldMem<IdxRangeBatchX> electrostatic_potential_alloc(idx_range);
+    DFieldMem<IdxRangeBatchX> electric_field_alloc(idx_range);
+    DField<IdxRangeBatchX> rhs = get_field(rhs_alloc);
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            idx_range,
+            KOKKOS_LAMBDA(IdxBatchX const idx) {
+                rhs(idx) = Kokkos::cos(ddc::coordinate(IdxX(idx)));
+            });
+    Kokkos::fence();
+
+    for (auto _ : state) {
+        poisson(get_field(electrostatic_potential_alloc), get_field(electric_field_alloc), rhs);
+        Kokkos::fence();
+    }
+    state.SetItemsProcessed(state.iterations() * idx_range.size());
+}
+
+/**
+ * @brief Register the 2D benchmarks for a number of points along X and each number along Y.
+ *
+ * @tparam NX The number of points along X.
+ * @tparam NY The numbers of points along Y.
+ *
+ * @return True once the benchmarks are registered.
+ */
+template <int NX, int... NY>
+bool register_benchmarks_2d()
+{
+    (benchmark::RegisterBenchmark(
+             ("BM_FFTPoissonSolver2D/nx:" + std::to_string(NX) + "/ny:" + std::to_string(NY))
+                     .c_str(),
+             BM_FFTPoissonSolver2D<NX, NY>)
+             ->Unit(benchmark::kMillisecond)
+             ->UseRealTime(),
+     ...);
+    return true;
+}
+
+/**
+ * @brief Register the batched 1D benchmarks for each number of points along X.
+ *
+ * @tparam NX The numbers of points along X.
+ *
+ * @return True once the benchmarks are registered.
+ */
+template <int... NX>
+bool register_benchmarks_batched_1d()
+{
+    (benchmark::RegisterBenchmark(
+             ("BM_FFTPoissonSolverBatched1D/nx:" + std::to_string(NX)).c_str(),
+             BM_FFTPoissonSolverBatched1D<NX>)
+             ->ArgNames({"batch"})
+             ->ArgsProduct({{1, 256, 16384}})
+             ->Unit(benchmark::kMillisecond)
+             ->UseRealTime(),
+     ...);
+    return true;
+}
+
+[[maybe_unused]] bool const benchmarks_registered
+        = register_benchmarks_2d<64, 64, 256, 1024>()
+          && register_benchmarks_2d<256, 64, 256, 1024>()
+          && register_benchmarks_2d<1024, 64, 256, 1024>()
+          && register_benchmarks_batched_1d<64, 256, 1024>();
+
+} // namespace
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: MIT
+/*
+    Benchmarks of the batched evaluation of Lagrange polynomials with LagrangeEvaluator.
+*/
+#include <string>
+
+#include <ddc/ddc.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "identity_interpolation_builder.hpp"
+#include "lagrange_basis_uniform.hpp"
+#include "lagrange_evaluator.hpp"
+
+namespace {
+
+struct X
+{
+    static bool constexpr PERIODIC = false;
+};
+struct Batch
+{
+};
+
+using CoordX = Coord<X>;
+
+// A discrete space can only be initialised once so each number of cells has its own tags
+template <int NX>
+struct GridX : UniformGridBase<X>
+{
+};
+struct GridBatch : UniformGridBase<Batch>
+{
+};
+
+template <int NX, std::size_t Degree>
+struct LagBasisX : UniformLagrangeBasis<X, Degree, double>
+{
+};
+
+using IdxRangeBatch = IdxRange<GridBatch>;
+using IdxBatch = Idx<GridBatch>;
+using IdxStepBatch = IdxStep<GridBatch>;
+
+template <int NX, std::size_t Degree>
+void BM_LagrangeEvaluate(benchmark::State& state)
+{
+    using GridXN = GridX<NX>;
+    using LagBasis = LagBasisX<NX, Degree>;
+    using IdxRangeX = IdxRange<GridXN>;
+    using IdxRangeBatchX = IdxRange<GridBatch, GridXN>;
+    using IdxBatchX = Idx<GridBatch, GridXN>;
+    using IdxX = Idx<GridXN>;
+    using IdxStepX = IdxStep<GridXN>;
+    using Builder = IdentityInterpolationBuilder<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            double,
+            GridXN,
+            LagBasis>;
+    using Evaluator = LagrangeEvaluator<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            double,
+            LagBasis,
+            GridXN,
+            ddc::NullExtrapolationRule,
+            ddc::NullExtrapolationRule>;
+    using IdxRangeCoeff = typename Builder::template batched_basis_idx_range_type<IdxRangeBatchX>;
+
+    int const nbatch = state.range(0);
+    CoordX const x_min(0.0);
+    CoordX const x_max(1.0);
+
+    IdxRangeX const idx_range_x(IdxX(0), IdxStepX(NX + 1));
+    if (!ddc::is_discrete_space_initialized<GridXN>()) {
+        ddc::init_discrete_space<GridXN>(GridXN::init(x_min, x_max, IdxStepX(NX + 1)));
+    }
+    if (!ddc::is_discrete_space_initialized<LagBasis>()) {
+        ddc::init_discrete_space<LagBasis>(idx_range_x);
+    }
+    IdxRangeBatchX const idx_range(IdxRangeBatch(IdxBatch(0), IdxStepBatch(nbatch)), idx_range_x);
+
+    Builder const builder;
+    ddc::NullExtrapolationRule extrapolation;
+    Evaluator const evaluator(extrapolation, extrapolation);
+
+    DFieldMem<IdxRangeBatchX> values_alloc(idx_range);
+    FieldMem<CoordX, IdxRangeBatchX> coords_alloc(idx_range);
+    DField<IdxRangeBatchX> values = get_field(values_alloc);
+    Field<CoordX, IdxRangeBatchX> coords = get_field(coords_alloc);
+    double const dx = (x_max - x_min) / NX;
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            idx_range,
+            KOKKOS_LAMBDA(IdxBatchX const idx) {
+                double const x = ddc::coordinate(IdxX(idx));
+                values(idx) = Kokkos::sin(2 * M_PI * x);
+                coords(idx) = CoordX(Kokkos::fmin(x + 0.37 * dx, double(x_max)));
+            });
+
+    DFieldMem<IdxRangeCoeff> coeffs_alloc(builder.batched_basis_idx_range(idx_range));
+    builder(get_field(coeffs_alloc), get_const_field(values_alloc));
+    Kokkos::fence();
+
+    for (auto _ : state) {
+        evaluator(values, get_const_field(coords_alloc), get_const_field(coeffs_alloc));
+        Kokkos::fence();
+    }
+    state.SetItemsProcessed(state.iterations() * idx_range.size());
+}
+
+/**
+ * @brief Register the benchmarks of a given degree for each number of cells along X.
+ *
+ * @tparam Degree The degree of the Lagrange polynomials.
+ * @tparam NX The numbers of cells along X.
+ *
+ * @return True once the benchmarks are registered.
+ */
+template <std::size_t Degree, int... NX>
+bool register_benchmarks()
+{
+    (benchmark::RegisterBenchmark(
+             ("BM_LagrangeEvaluate<" + std::to_string(Degree) + ">/nx:" + std::to_string(NX))
+                     .c_str(),
+             BM_LagrangeEvaluate<NX, Degree>)
+             ->ArgNames({"batch"})
+             ->ArgsProduct({{1, 256, 16384}})
+             ->Unit(benchmark::kMicrosecond)
+             ->UseRealTime(),
+     ...);
+    return true;
+}
+
+[[maybe_unused]] bool const benchmarks_registered
+        = register_benchmarks<3, 64, 256, 1024>() && register_benchmarks<5, 64, 256, 1024>();
+
+} // namespace
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: MIT
+#include <mpi.h>
+
+#include <ddc/ddc.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+/**
+ * @brief A reporter which discards all results.
+ *
+ * It is used on all MPI ranks except the first so that each benchmark is only
+ * reported once.
+ */
+class SilentReporter : public ::benchmark::BenchmarkReporter
+{
+public:
+    bool ReportContext(Context const&) override
+    {
+        return true;
+    }
+
+    void ReportRuns(std::vector<Run> const&) override {}
+};
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    ::Kokkos::ScopeGuard kokkos_scope(argc, argv);
+    ::ddc::ScopeGuard ddc_scope(argc, argv);
+    MPI_Init(&argc, &argv);
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        MPI_Finalize();
+        return EXIT_FAILURE;
+    }
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    if (rank == 0) {
+        ::benchmark::RunSpecifiedBenchmarks();
+    } else {
+        SilentReporter display_reporter;
+        SilentReporter file_reporter;
+        ::benchmark::RunSpecifiedBenchmarks(&display_reporter, &file_reporter);
+    }
+    ::benchmark::Shutdown();
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: MIT
+/*
+    Benchmarks of the batched linear solvers MatrixBatchTridiag and MatrixBatchCsr.
+    The systems are discretisations of a 1D diffusion problem: (4, -1) on the diagonals.
+*/
+#include <algorithm>
+
+#include <Kokkos_Core.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "matrix_batch_csr.hpp"
+#include "matrix_batch_tridiag.hpp"
+
+namespace {
+
+using DKokkosView2D = Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::DefaultExecutionSpace>;
+using IKokkosView1D = Kokkos::View<int*, Kokkos::LayoutRight, Kokkos::DefaultExecutionSpace>;
+
+void BM_MatrixBatchTridiagSolve(benchmark::State& state)
+{
+    int const mat_size = state.range(0);
+    int const batch_size = state.range(1);
+
+    DKokkosView2D sub_diag("sub_diag", batch_size, mat_size);
+    DKokkosView2D diag("diag", batch_size, mat_size);
+    DKokkosView2D up_diag("up_diag", batch_size, mat_size);
+    DKokkosView2D rhs("rhs", batch_size, mat_size);
+    Kokkos::deep_copy(sub_diag, -1.0);
+    Kokkos::deep_copy(diag, 4.0);
+    Kokkos::deep_copy(up_diag, -1.0);
+    Kokkos::deep_copy(rhs, 1.0);
+
+    MatrixBatchTridiag<Kokkos::DefaultExecutionSpace>
+            matrix(batch_size, mat_size, sub_diag, diag, up_diag);
+    matrix.setup_solver();
+    Kokkos::fence();
+
+    for (auto _ : state) {
+        // The solution of the previous solve is used as the new right-hand side.
+        matrix.solve(rhs);
+        Kokkos::fence();
+    }
+    state.SetItemsProcessed(state.iterations() * batch_size * mat_size);
+}
+
+template <MatrixBatchCsrSolver Solver>
+void BM_MatrixBatchCsrSolve(benchmark::State& state)
+{
+    int const mat_size = state.range(0);
+    int const batch_size = state.range(1);
+    int const nnz_per_system = 3 * mat_size - 2;
+
+    Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::DefaultHostExecutionSpace>
+            values_host("values_host", batch_size, nnz_per_system);
+    Kokkos::View<int*, Kokkos::LayoutRight, Kokkos::DefaultHostExecutionSpace>
+            cols_idx_host("cols_idx_host", nnz_per_system);
+    Kokkos::View<int*, Kokkos::LayoutRight, Kokkos::DefaultHostExecutionSpace>
+            nnz_per_row_host("nnz_per_row_host", mat_size + 1);
+
+    int nnz = 0;
+    nnz_per_row_host(0) = 0;
+    for (int i = 0; i < mat_size; ++i) {
+        for (int j = std::max(i - 1, 0); j <= std::min(i + 1, mat_size - 1); ++j) {
+            cols_idx_host(nnz) = j;
+            for (int batch_idx = 0; batch_idx < batch_size; ++batch_idx) {
+                values_host(batch_idx, nnz) = (i == j) ? 4.0 : -1.0;
+            }
+            nnz++;
+        }
+        nnz_per_row_host(i + 1) = nnz;
+    }
+
+    DKokkosView2D values("values", batch_size, nnz_per_system);
+    IKokkosView1D cols_idx("cols_idx", nnz_per_system);
+    IKokkosView1D nnz_per_row("nnz_per_row", mat_size + 1);
+    Kokkos::deep_copy(values, values_host);
+    Kokkos::deep_copy(cols_idx, cols_idx_host);
+    Kokkos::deep_copy(nnz_per_row, nnz_per_row_host);
+
+    DKokkosView2D rhs("rhs", batch_size, mat_size);
+    DKokkosView2D solution("solution", batch_size, mat_size);
+    Kokkos::deep_copy(rhs, 1.0);
+
+    MatrixBatchCsr<Kokkos::DefaultExecutionSpace, Solver>
+            matrix(values, cols_idx, nnz_per_row, 1000, 1e-12);
+    matrix.setup_solver();
+    Kokkos::fence();
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Kokkos::deep_copy(solution, 0.0);
+        Kokkos::fence();
+        state.ResumeTiming();
+        matrix.solve(solution, rhs);
+        Kokkos::fence();
+    }
+    state.SetItemsProcessed(state.iterations() * batch_size * mat_size);
+}
+
+} // namespace
+
+BENCHMARK(BM_MatrixBatchTridiagSolve)
+        ->ArgNames({"size", "batch"})
+        ->ArgsProduct({{64, 256, 1024}, {1, 256, 16384}})
+        ->Unit(benchmark::kMicrosecond)
+        ->UseRealTime();
+
+BENCHMARK(BM_MatrixBatchCsrSolve<MatrixBatchCsrSolver::BATCH_CG>)
+        ->ArgNames({"size", "batch"})
+        ->ArgsProduct({{64, 256}, {1, 256, 4096}})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+BENCHMARK(BM_MatrixBatchCsrSolve<MatrixBatchCsrSolver::BATCH_BICGSTAB>)
+        ->ArgNames({"size", "batch"})
+        ->ArgsProduct({{64, 256}, {1, 256, 4096}})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
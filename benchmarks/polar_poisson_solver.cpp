@@ -0,0 +1,257 @@
+// SPDX-License-Identifier: MIT
+/*
+    Benchmarks of the PolarSplineFEMPoissonLikeSolver on a circular mapping.
+*/
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "circular_to_cartesian.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "discrete_poloidal_cs_spline_mapping.hpp"
+#include "discrete_poloidal_cs_spline_mapping_builder.hpp"
+#include "geometry_r_theta.hpp"
+#include "mesh_builder.hpp"
+#include "polar_spline_fem_poisson_like_solver.hpp"
+#include "spline_definitions_r_theta.hpp"
+
+namespace {
+
+/*
+ * A discrete space can only be initialised once so each mesh size has its own copy of the
+ * B-splines and grids defined in spline_definitions_r_theta.hpp.
+ */
+template <int NR, int NTheta>
+struct BSplinesR : ddc::NonUniformBSplines<R, BSDegreeR>
+{
+};
+template <int NR, int NTheta>
+struct BSplinesTheta : ddc::NonUniformBSplines<Theta, BSDegreeTheta>
+{
+};
+template <int NR, int NTheta>
+struct PolarBSplinesRTheta : PolarBSplines<BSplinesR<NR, NTheta>, BSplinesTheta<NR, NTheta>, 1>
+{
+};
+
+template <int NR, int NTheta>
+struct GridR : NonUniformGridBase<R>
+{
+};
+template <int NR, int NTheta>
+struct GridTheta : NonUniformGridBase<Theta>
+{
+};
+
+template <int NR, int NTheta>
+using SplineInterpPointsR = ddc::
+        GrevilleInterpolationPoints<BSplinesR<NR, NTheta>, SplineRBoundary, SplineRBoundary>;
+template <int NR, int NTheta>
+using SplineInterpPointsTheta = ddc::GrevilleInterpolationPoints<
+        BSplinesTheta<NR, NTheta>,
+        SplineThetaBoundary,
+        SplineThetaBoundary>;
+
+template <int NR, int NTheta>
+using IdxRangeRTheta = IdxRange<GridR<NR, NTheta>, GridTheta<NR, NTheta>>;
+template <int NR, int NTheta>
+using IdxRTheta = Idx<GridR<NR, NTheta>, GridTheta<NR, NTheta>>;
+template <int NR, int NTheta>
+using DFieldMemRTheta = DFieldMem<IdxRangeRTheta<NR, NTheta>>;
+template <int NR, int NTheta>
+using DFieldRTheta = DField<IdxRangeRTheta<NR, NTheta>>;
+
+template <int NR, int NTheta>
+using SplineRThetaBuilder = ddc::SplineBuilder2D<
+        Kokkos::DefaultExecutionSpace,
+        typename Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesR<NR, NTheta>,
+        BSplinesTheta<NR, NTheta>,
+        GridR<NR, NTheta>,
+        GridTheta<NR, NTheta>,
+        SplineRBoundary, // boundary at r=0
+        SplineRBoundary, // boundary at rmax
+        SplineThetaBoundary,
+        SplineThetaBoundary,
+        ddc::SplineSolver::LAPACK>;
+
+template <int NR, int NTheta>
+using SplineRThetaEvaluatorNullBound = ddc::SplineEvaluator2D<
+        Kokkos::DefaultExecutionSpace,
+        typename Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesR<NR, NTheta>,
+        BSplinesTheta<NR, NTheta>,
+        GridR<NR, NTheta>,
+        GridTheta<NR, NTheta>,
+        ddc::NullExtrapolationRule, // boundary at r=0
+        ddc::NullExtrapolationRule, // boundary at rmax
+        ddc::PeriodicExtrapolationRule<Theta>,
+        ddc::PeriodicExtrapolationRule<Theta>>;
+
+using Mapping = CircularToCartesian<R, Theta, X, Y>;
+template <int NR, int NTheta>
+using DiscreteMappingBuilder = DiscretePoloidalCSSplineMappingBuilder<
+        X,
+        Y,
+        SplineRThetaBuilder<NR, NTheta>,
+        SplineRThetaEvaluatorNullBound<NR, NTheta>>;
+template <int NR, int NTheta>
+using DiscreteMapping = typename DiscreteMappingBuilder<NR, NTheta>::MappingType;
+template <int NR, int NTheta>
+using PoissonSolver = PolarSplineFEMPoissonLikeSolver<
+        GridR<NR, NTheta>,
+        GridTheta<NR, NTheta>,
+        PolarBSplinesRTheta<NR, NTheta>,
+        SplineRThetaBuilder<NR, NTheta>,
+        SplineRThetaEvaluatorNullBound<NR, NTheta>,
+        DiscreteMapping<NR, NTheta>>;
+
+/**
+ * @brief Initialise the discrete spaces of the polar geometry if this was not done by a
+ * previous case.
+ *
+ * @tparam NR The number of cells along r.
+ * @tparam NTheta The number of cells along theta.
+ *
+ * @return The index range of the interpolation points.
+ */
+template <int NR, int NTheta>
+IdxRangeRTheta<NR, NTheta> init_idx_range_r_theta()
+{
+    using GridRN = GridR<NR, NTheta>;
+    using GridThetaN = GridTheta<NR, NTheta>;
+    if (!ddc::is_discrete_space_initialized<GridRN>()) {
+        std::vector<CoordR> r_break_points
+                = build_uniform_break_points(CoordR(0.0), CoordR(1.0), IdxStepR(NR));
+        std::vector<CoordTheta> theta_break_points = build_uniform_break_points(
+                CoordTheta(0.0),
+                CoordTheta(2.0 * M_PI),
+                IdxStepTheta(NTheta));
+        ddc::init_discrete_space<BSplinesR<NR, NTheta>>(r_break_points);
+        ddc::init_discrete_space<BSplinesTheta<NR, NTheta>>(theta_break_points);
+        ddc::init_discrete_space<GridRN>(
+                SplineInterpPointsR<NR, NTheta>::template get_sampling<GridRN>());
+        ddc::init_discrete_space<GridThetaN>(
+                SplineInterpPointsTheta<NR, NTheta>::template get_sampling<GridThetaN>());
+    }
+    IdxRange<GridRN> idx_range_r(SplineInterpPointsR<NR, NTheta>::template get_domain<GridRN>());
+    IdxRange<GridThetaN> idx_range_theta(
+            SplineInterpPointsTheta<NR, NTheta>::template get_domain<GridThetaN>());
+    return IdxRangeRTheta<NR, NTheta>(idx_range_r, idx_range_theta);
+}
+
+/**
+ * @brief Fill the coefficients of the equation @f$ -\nabla \cdot (\alpha \nabla \phi) + \beta \phi = \rho @f$.
+ *
+ * @param[out] coeff_alpha The coefficient @f$ \alpha @f$.
+ * @param[out] coeff_beta The coefficient @f$ \beta @f$.
+ * @param[out] rhs The right-hand side @f$ \rho @f$.
+ */
+template <int NR, int NTheta>
+void fill_coefficients(
+        DFieldRTheta<NR, NTheta> coeff_alpha,
+        DFieldRTheta<NR, NTheta> coeff_beta,
+        DFieldRTheta<NR, NTheta> rhs)
+{
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(coeff_alpha),
+            KOKKOS_LAMBDA(IdxRTheta<NR, NTheta> const irtheta) {
+                double const r = ddc::coordinate(ddc::select<GridR<NR, NTheta>>(irtheta));
+                double const theta
+                        = ddc::coordinate(ddc::select<GridTheta<NR, NTheta>>(irtheta));
+                coeff_alpha(irtheta) = Kokkos::exp(-Kokkos::tanh((r - 0.7) / 0.05));
+                coeff_beta(irtheta) = 1.0 / coeff_alpha(irtheta);
+                rhs(irtheta) = r * (1.0 - r) * Kokkos::cos(theta);
+            });
+}
+
+template <int NR, int NTheta>
+void BM_PolarSplineFEMPoissonLikeSolver(benchmark::State& state, bool include_setup)
+{
+    using Builder = SplineRThetaBuilder<NR, NTheta>;
+    using Evaluator = SplineRThetaEvaluatorNullBound<NR, NTheta>;
+    using PolarBSplines = PolarBSplinesRTheta<NR, NTheta>;
+    IdxRangeRTheta<NR, NTheta> const grid = init_idx_range_r_theta<NR, NTheta>();
+
+    Builder const builder(grid);
+    ddc::NullExtrapolationRule bv_r_min;
+    ddc::NullExtrapolationRule bv_r_max;
+    ddc::PeriodicExtrapolationRule<Theta> bv_theta_min;
+    ddc::PeriodicExtrapolationRule<Theta> bv_theta_max;
+    Evaluator const evaluator(bv_r_min, bv_r_max, bv_theta_min, bv_theta_max);
+
+    Mapping const mapping;
+    DiscreteMappingBuilder<NR, NTheta> const
+            discrete_mapping_builder(Kokkos::DefaultExecutionSpace(), mapping, builder, evaluator);
+    DiscreteMapping<NR, NTheta> const discrete_mapping = discrete_mapping_builder();
+    if (!ddc::is_discrete_space_initialized<PolarBSplines>()) {
+        ddc::init_discrete_space<PolarBSplines>(discrete_mapping);
+    }
+
+    DFieldMemRTheta<NR, NTheta> coeff_alpha_alloc(grid);
+    DFieldMemRTheta<NR, NTheta> coeff_beta_alloc(grid);
+    DFieldMemRTheta<NR, NTheta> rhs_alloc(grid);
+    DFieldMemRTheta<NR, NTheta> phi_alloc(grid);
+    fill_coefficients<NR, NTheta>(
+            get_field(coeff_alpha_alloc),
+            get_field(coeff_beta_alloc),
+            get_field(rhs_alloc));
+
+    if (include_setup) {
+        for (auto _ : state) {
+            PoissonSolver<NR, NTheta> solver(discrete_mapping, builder, evaluator);
+            solver.update_coefficients(
+                    get_const_field(coeff_alpha_alloc),
+                    get_const_field(coeff_beta_alloc));
+            Kokkos::fence();
+        }
+    } else {
+        PoissonSolver<NR, NTheta> solver(discrete_mapping, builder, evaluator);
+        solver.update_coefficients(
+                get_const_field(coeff_alpha_alloc),
+                get_const_field(coeff_beta_alloc));
+        Kokkos::fence();
+        for (auto _ : state) {
+            solver(get_field(phi_alloc), get_const_field(rhs_alloc));
+            Kokkos::fence();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * grid.size());
+}
+
+/**
+ * @brief Register the setup and solve benchmarks for a number of cells along r and each
+ * number of cells along theta.
+ *
+ * @tparam NR The number of cells along r.
+ * @tparam NTheta The numbers of cells along theta.
+ *
+ * @return True once the benchmarks are registered.
+ */
+template <int NR, int... NTheta>
+bool register_benchmarks()
+{
+    for (auto [label, include_setup] : {std::pair("Setup", true), std::pair("Solve", false)}) {
+        (benchmark::RegisterBenchmark(
+                 (std::string("BM_PolarSplineFEMPoissonLikeSolver/") + label
+                  + "/nr:" + std::to_string(NR) + "/ntheta:" + std::to_string(NTheta))
+                         .c_str(),
+                 BM_PolarSplineFEMPoissonLikeSolver<NR, NTheta>,
+                 include_setup)
+                 ->Unit(benchmark::kMillisecond)
+                 ->UseRealTime(),
+         ...);
+    }
+    return true;
+}
+
+[[maybe_unused]] bool const benchmarks_registered = register_benchmarks<32, 64, 128, 256>()
+                                                    && register_benchmarks<64, 64, 128, 256>()
+                                                    && register_benchmarks<128, 64, 128, 256>();
+
+} // namespace
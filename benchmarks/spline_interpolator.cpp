@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: MIT
+/*
+    Benchmarks of the batched spline construction and evaluation provided by SplineInterpolator.
+*/
+#include <string>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/splines.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "i_interpolation_builder.hpp"
+#include "spline_interpolation.hpp"
+
+namespace {
+
+struct X
+{
+    static bool constexpr PERIODIC = true;
+};
+struct Batch
+{
+};
+
+using CoordX = Coord<X>;
+
+// A discrete space can only be initialised once so each number of cells has its own tags
+template <int NX>
+struct BSplinesX : ddc::UniformBSplines<X, 3>
+{
+};
+
+ddc::BoundCond constexpr SplineXBoundary = ddc::BoundCond::PERIODIC;
+
+template <int NX>
+struct GridX : UniformGridBase<X>
+{
+};
+struct GridBatch : UniformGridBase<Batch>
+{
+};
+
+template <int NX>
+using SplineInterpPointsX
+        = ddc::GrevilleInterpolationPoints<BSplinesX<NX>, SplineXBoundary, SplineXBoundary>;
+
+template <int NX>
+using IdxRangeBatchX = IdxRange<GridBatch, GridX<NX>>;
+template <int NX>
+using IdxBatchX = Idx<GridBatch, GridX<NX>>;
+using IdxRangeBatch = IdxRange<GridBatch>;
+using IdxBatch = Idx<GridBatch>;
+using IdxStepBatch = IdxStep<GridBatch>;
+
+template <int NX>
+using SplineInterpolatorX = SplineInterpolator<
+        Kokkos::DefaultExecutionSpace,
+        BSplinesX<NX>,
+        GridX<NX>,
+        ExtrapolationRule::PERIODIC,
+        ExtrapolationRule::PERIODIC,
+        SplineXBoundary,
+        SplineXBoundary>;
+
+/**
+ * @brief Initialise the discrete spaces (if this was not done by a previous case) and get
+ * the batched interpolation index range.
+ *
+ * @param[in] nbatch The number of batched 1D problems.
+ *
+ * @tparam NX The number of cells along X.
+ *
+ * @return The index range of the interpolation points.
+ */
+template <int NX>
+IdxRangeBatchX<NX> init_idx_range(int nbatch)
+{
+    if (!ddc::is_discrete_space_initialized<GridX<NX>>()) {
+        ddc::init_discrete_space<
+                BSplinesX<NX>>(CoordX(0.0), CoordX(2 * M_PI), IdxStep<GridX<NX>>(NX));
+        ddc::init_discrete_space<GridX<NX>>(
+                SplineInterpPointsX<NX>::template get_sampling<GridX<NX>>());
+    }
+    IdxRange<GridX<NX>> idx_range_x(SplineInterpPointsX<NX>::template get_domain<GridX<NX>>());
+    IdxRangeBatch idx_range_batch(IdxBatch(0), IdxStepBatch(nbatch));
+    return IdxRangeBatchX<NX>(idx_range_batch, idx_range_x);
+}
+
+/**
+ * @brief Fill the function values and the evaluation coordinates.
+ *
+ * @param[out] values The values of the function at the interpolation points.
+ * @param[out] coords The coordinates of the evaluation points (shifted interpolation points).
+ */
+template <int NX>
+void fill_fields(DField<IdxRangeBatchX<NX>> values, Field<CoordX, IdxRangeBatchX<NX>> coords)
+{
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(values),
+            KOKKOS_LAMBDA(IdxBatchX<NX> const idx) {
+                double const x = ddc::coordinate(Idx<GridX<NX>>(idx));
+                values(idx) = Kokkos::cos(x);
+                coords(idx) = CoordX(x + 0.1);
+            });
+}
+
+template <int NX>
+void BM_SplineBuild(benchmark::State& state)
+{
+    using Interpolator = SplineInterpolatorX<NX>;
+    using IdxRangeBatchBSX = IdxRange<GridBatch, BSplinesX<NX>>;
+    IdxRangeBatchX<NX> const idx_range = init_idx_range<NX>(state.range(0));
+    Interpolator const interpolator(ddc::select<GridX<NX>>(idx_range));
+    typename Interpolator::BuilderType const& builder = interpolator.get_builder();
+
+    DFieldMem<IdxRangeBatchX<NX>> values_alloc(idx_range);
+    FieldMem<CoordX, IdxRangeBatchX<NX>> coords_alloc(idx_range);
+    fill_fields<NX>(get_field(values_alloc), get_field(coords_alloc));
+
+    DFieldMem<IdxRangeBatchBSX> coefs_alloc(batched_basis_idx_range(builder, idx_range));
+    Kokkos::fence();
+
+    for (auto _ : state) {
+        builder(get_field(coefs_alloc), get_const_field(values_alloc));
+        Kokkos::fence();
+    }
+    state.SetItemsProcessed(state.iterations() * idx_range.size());
+}
+
+template <int NX>
+void BM_SplineEvaluate(benchmark::State& state)
+{
+    using Interpolator = SplineInterpolatorX<NX>;
+    using IdxRangeBatchBSX = IdxRange<GridBatch, BSplinesX<NX>>;
+    IdxRangeBatchX<NX> const idx_range = init_idx_range<NX>(state.range(0));
+    Interpolator const interpolator(ddc::select<GridX<NX>>(idx_range));
+    typename Interpolator::BuilderType const& builder = interpolator.get_builder();
+    typename Interpolator::EvaluatorType const& evaluator = interpolator.get_evaluator();
+
+    DFieldMem<IdxRangeBatchX<NX>> values_alloc(idx_range);
+    FieldMem<CoordX, IdxRangeBatchX<NX>> coords_alloc(idx_range);
+    fill_fields<NX>(get_field(values_alloc), get_field(coords_alloc));
+
+    DFieldMem<IdxRangeBatchBSX> coefs_alloc(batched_basis_idx_range(builder, idx_range));
+    builder(get_field(coefs_alloc), get_const_field(values_alloc));
+    Kokkos::fence();
+
+    for (auto _ : state) {
+        evaluator(
+                get_field(values_alloc),
+                get_const_field(coords_alloc),
+                get_const_field(coefs_alloc));
+        Kokkos::fence();
+    }
+    state.SetItemsProcessed(state.iterations() * idx_range.size());
+}
+
+/**
+ * @brief Register the benchmarks for each number of cells along X.
+ *
+ * @tparam NX The numbers of cells along X.
+ *
+ * @return True once the benchmarks are registered.
+ */
+template <int... NX>
+bool register_benchmarks()
+{
+    (benchmark::RegisterBenchmark(
+             ("BM_SplineBuild/nx:" + std::to_string(NX)).c_str(),
+             BM_SplineBuild<NX>)
+             ->ArgNames({"batch"})
+             ->ArgsProduct({{1, 256, 16384}})
+             ->Unit(benchmark::kMicrosecond)
+             ->UseRealTime(),
+     ...);
+    (benchmark::RegisterBenchmark(
+             ("BM_SplineEvaluate/nx:" + std::to_string(NX)).c_str(),
+             BM_SplineEvaluate<NX>)
+             ->ArgNames({"batch"})
+             ->ArgsProduct({{1, 256, 16384}})
+             ->Unit(benchmark::kMicrosecond)
+             ->UseRealTime(),
+     ...);
+    return true;
+}
+
+[[maybe_unused]] bool const benchmarks_registered = register_benchmarks<64, 256, 1024>();
+
+} // namespace
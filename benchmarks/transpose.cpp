@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: MIT
+/*
+    Benchmarks of the data layout changes: the local transpose_layout function and
+    the MPI transposition MPITransposeAllToAll.
+*/
+#include <mpi.h>
+
+#include <ddc/ddc.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "mpilayout.hpp"
+#include "mpitransposealltoall.hpp"
+#include "transpose.hpp"
+
+namespace {
+
+struct X
+{
+};
+struct Y
+{
+};
+struct Z
+{
+};
+
+struct GridX : UniformGridBase<X>
+{
+};
+struct GridY : UniformGridBase<Y>
+{
+};
+struct GridZ : UniformGridBase<Z>
+{
+};
+
+using IdxXYZ = Idx<GridX, GridY, GridZ>;
+using IdxStepXYZ = IdxStep<GridX, GridY, GridZ>;
+using IdxRangeXYZ = IdxRange<GridX, GridY, GridZ>;
+using IdxRangeYZX = IdxRange<GridY, GridZ, GridX>;
+using IdxRangeZYX = IdxRange<GridZ, GridY, GridX>;
+
+using YDistribLayout = MPILayout<IdxRangeXYZ, GridY>;
+using ZDistribLayout = MPILayout<IdxRangeYZX, GridZ>;
+
+/// The number of iterations of the MPI benchmarks. It is fixed so all ranks stay in step.
+constexpr int n_mpi_iterations = 20;
+
+void BM_TransposeLayout(benchmark::State& state)
+{
+    IdxRangeXYZ const idx_range(
+            IdxXYZ(0, 0, 0),
+            IdxStepXYZ(state.range(0), state.range(1), state.range(2)));
+
+    DFieldMem<IdxRangeXYZ> field_alloc(idx_range);
+    DFieldMem<IdxRangeZYX> transposed_field_alloc(IdxRangeZYX {idx_range});
+    ddc::parallel_fill(get_field(field_alloc), 1.0);
+    Kokkos::fence();
+
+    for (auto _ : state) {
+        transpose_layout(
+                Kokkos::DefaultExecutionSpace(),
+                get_field(transposed_field_alloc),
+                get_const_field(field_alloc));
+        Kokkos::fence();
+    }
+    state.SetItemsProcessed(state.iterations() * idx_range.size());
+    state.SetBytesProcessed(state.iterations() * idx_range.size() * 2 * sizeof(double));
+}
+
+void BM_MPITransposeAllToAll(benchmark::State& state)
+{
+    IdxRangeXYZ const full_idx_range(
+            IdxXYZ(0, 0, 0),
+            IdxStepXYZ(state.range(0), state.range(1), state.range(2)));
+
+    MPITransposeAllToAll<YDistribLayout, ZDistribLayout> const
+            transpose(full_idx_range, MPI_COMM_WORLD);
+
+    DFieldMem<IdxRangeXYZ> send_buffer_alloc(transpose.get_local_idx_range<YDistribLayout>());
+    DFieldMem<IdxRangeYZX> recv_buffer_alloc(transpose.get_local_idx_range<ZDistribLayout>());
+    ddc::parallel_fill(get_field(send_buffer_alloc), 1.0);
+    Kokkos::fence();
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    for (auto _ : state) {
+        transpose(
+                Kokkos::DefaultExecutionSpace(),
+                get_field(recv_buffer_alloc),
+                get_const_field(send_buffer_alloc));
+        Kokkos::fence();
+    }
+    int n_ranks;
+    MPI_Comm_size(MPI_COMM_WORLD, &n_ranks);
+    state.counters["ranks"] = n_ranks;
+    state.SetItemsProcessed(state.iterations() * full_idx_range.size());
+}
+
+} // namespace
+
+BENCHMARK(BM_TransposeLayout)
+        ->ArgNames({"nx", "ny", "nz"})
+        ->Args({64, 64, 64})
+        ->Args({128, 128, 128})
+        ->Args({256, 256, 64})
+        ->Args({1024, 32, 32})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+BENCHMARK(BM_MPITransposeAllToAll)
+        ->ArgNames({"nx", "ny", "nz"})
+        ->Args({64, 64, 64})
+        ->Args({128, 128, 128})
+        ->Args({256, 256, 64})
+        ->Iterations(n_mpi_iterations)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
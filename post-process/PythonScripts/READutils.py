@@ -12,6 +12,8 @@
 import glob
 import os
 
+import numpy as np
+
 import HDF5utils as H5ut
 
 #===============================================
@@ -45,6 +47,23 @@ def Ask_directory():
 #-----------------------------------------------
 
 
+#===============================================
+def promote_single_precision(H):
+    """ Convert the arrays saved in single precision to double precision
+
+    The distribution function may be saved in single precision (and compressed,
+    which is handled by h5py). It is converted so the results can be used in the
+    same way as results saved in double precision.
+    """
+    for key in H.keys:
+        var = getattr(H, key)
+        if isinstance(var, np.ndarray) and var.dtype == np.float32:
+            setattr(H, key, var.astype(np.float64))
+
+#end def promote_single_precision
+#-----------------------------------------------
+
+
 #===============================================
 def Read_GYSELALIBXX_results(ResuDir, cache = True):
     """ Read the result directory
@@ -62,6 +81,7 @@ def Read_GYSELALIBXX_results(ResuDir, cache = True):
     H = H5ut.loadHDF5(ResuFileList)
     Hinit = H5ut.loadHDF5(ResuDir+'/GYSELALIBXX_initstate.h5')
     H.append(Hinit)
+    promote_single_precision(H)
     H.dirname = ResuDir
 
     if cache:
@@ -3,6 +3,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
 
 #include <ddc/ddc.hpp>
 #include <ddc/pdi.hpp>
@@ -15,6 +16,7 @@
 #include "bsl_predcorr_second_order_explicit.hpp"
 #include "bsl_predcorr_second_order_implicit.hpp"
 #include "cartesian_to_circular.hpp"
+#include "cfl_time_step_controller.hpp"
 #include "circular_to_cartesian.hpp"
 #include "crank_nicolson.hpp"
 #include "ddc_alias_inline_functions.hpp"
@@ -32,6 +34,7 @@
 #include "poisson_like_rhs_function.hpp"
 #include "polar_spline_fem_poisson_like_solver.hpp"
 #include "quadrature.hpp"
+#include "region_profiler.hpp"
 #include "rk3.hpp"
 #include "rk4.hpp"
 #include "simulation_utils_tools.hpp"
@@ -76,6 +79,7 @@ int main(int argc, char** argv)
 
     Kokkos::ScopeGuard kokkos_scope(argc, argv);
     ddc::ScopeGuard ddc_scope(argc, argv);
+    start_region_profiling_if_requested();
 
     std::chrono::time_point<std::chrono::system_clock> start_simulation;
     std::chrono::time_point<std::chrono::system_clock> end_simulation;
@@ -93,6 +97,7 @@ int main(int argc, char** argv)
             SplineInterpPointsTheta>(conf_gyselalibxx, "theta");
     double const dt(PCpp_double(conf_gyselalibxx, ".Time.delta_t"));
     double const final_T(PCpp_double(conf_gyselalibxx, ".Time.final_T"));
+    bool const adaptive_dt(PCpp_bool(conf_gyselalibxx, ".Time.adaptive_delta_t"));
 
     IdxRangeRTheta const mesh_rtheta(mesh_r, mesh_theta);
 
@@ -138,7 +143,9 @@ int main(int argc, char** argv)
 
 #elif defined(CRANK_NICOLSON_METHOD)
     double const epsilon_CN = 1e-8;
-    CrankNicolsonBuilder const time_stepper(20, epsilon_CN);
+    // Accelerate the implicit iteration of each characteristic foot with the Anderson method
+    int const anderson_depth_CN = 1;
+    CrankNicolsonBuilder const time_stepper(20, epsilon_CN, anderson_depth_CN);
 
 #elif defined(RK3_METHOD)
     RK3Builder const time_stepper;
@@ -246,7 +253,10 @@ int main(int argc, char** argv)
 
     ddc::expose_to_pdi("delta_t", dt);
     ddc::expose_to_pdi("final_T", final_T);
-    ddc::expose_to_pdi("time_step_diag", PCpp_int(conf_gyselalibxx, ".Output.time_step_diag"));
+    int const time_step_diag_input(PCpp_int(conf_gyselalibxx, ".Output.time_step_diag"));
+    // With an adaptive time step the iteration PDI events are only triggered at output times
+    int const time_step_diag = adaptive_dt ? 1 : time_step_diag_input;
+    ddc::expose_to_pdi("time_step_diag", time_step_diag);
 
     ddc::expose_to_pdi("slope", exact_rho.get_slope());
 
@@ -302,7 +312,21 @@ int main(int argc, char** argv)
     // ================================================================================================
     // SIMULATION                                                                                     |
     // ================================================================================================
-    predcorr_operator(get_field(rho_alloc_host), dt, iter_nb);
+    if (adaptive_dt) {
+#if defined(IMPLICIT_PREDCORR)
+        CFLTimeStepController const time_step_controller(
+                PCpp_double(conf_gyselalibxx, ".Time.cfl"),
+                PCpp_double(conf_gyselalibxx, ".Time.delta_t_min"),
+                dt,
+                time_step_diag_input * dt);
+        predcorr_operator(get_field(rho_alloc_host), iter_nb * dt, time_step_controller);
+#else
+        throw std::runtime_error(
+                "Adaptive time stepping is only implemented for the implicit predictor-corrector.");
+#endif
+    } else {
+        predcorr_operator(get_field(rho_alloc_host), dt, iter_nb);
+    }
 
 
     end_simulation = std::chrono::system_clock::now();
@@ -310,6 +334,7 @@ int main(int argc, char** argv)
 
 
     PC_tree_destroy(&conf_pdi);
+    finalise_region_profiling();
     PDI_finalize();
     PC_tree_destroy(&conf_gyselalibxx);
 
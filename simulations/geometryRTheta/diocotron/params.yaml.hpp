@@ -13,6 +13,9 @@ constexpr char const* const params_yaml = R"PDI_CFG(SplineMesh:
 Time:
   delta_t: 0.1
   final_T: 100.
+  adaptive_delta_t: false
+  cfl: 0.5
+  delta_t_min: 0.01
   
 Perturbation:
   charge_Q: 0.
@@ -15,6 +15,7 @@
 #include "bsl_predcorr.hpp"
 #include "bsl_predcorr_second_order_explicit.hpp"
 #include "bsl_predcorr_second_order_implicit.hpp"
+#include "cfl_time_step_controller.hpp"
 #include "circular_to_cartesian.hpp"
 #include "crank_nicolson.hpp"
 #include "czarny_to_cartesian.hpp"
@@ -31,6 +32,7 @@
 #include "poisson_like_rhs_function.hpp"
 #include "polar_spline_fem_poisson_like_solver.hpp"
 #include "quadrature.hpp"
+#include "region_profiler.hpp"
 #include "rk3.hpp"
 #include "rk4.hpp"
 #include "simulation_utils_tools.hpp"
@@ -75,6 +77,7 @@ int main(int argc, char** argv)
 
     Kokkos::ScopeGuard kokkos_scope(argc, argv);
     ddc::ScopeGuard ddc_scope(argc, argv);
+    start_region_profiling_if_requested();
 
     std::chrono::time_point<std::chrono::system_clock> start_simulation;
     std::chrono::time_point<std::chrono::system_clock> end_simulation;
@@ -86,6 +89,7 @@ int main(int argc, char** argv)
     int const Nt(PCpp_int(conf_gyselalibxx, ".SplineMesh.theta_ncells"));
     double const dt(PCpp_double(conf_gyselalibxx, ".Time.delta_t"));
     double const final_T(PCpp_double(conf_gyselalibxx, ".Time.final_T"));
+    bool const adaptive_dt(PCpp_bool(conf_gyselalibxx, ".Time.adaptive_delta_t"));
 
     IdxRangeR const mesh_r = init_pseudo_uniform_spline_dependent_idx_range<
             GridR,
@@ -205,7 +209,10 @@ int main(int argc, char** argv)
 
     ddc::expose_to_pdi("delta_t", dt);
     ddc::expose_to_pdi("final_T", final_T);
-    ddc::expose_to_pdi("time_step_diag", PCpp_int(conf_gyselalibxx, ".Output.time_step_diag"));
+    int const time_step_diag_input(PCpp_int(conf_gyselalibxx, ".Output.time_step_diag"));
+    // With an adaptive time step the iteration PDI events are only triggered at output times
+    int const time_step_diag = adaptive_dt ? 1 : time_step_diag_input;
+    ddc::expose_to_pdi("time_step_diag", time_step_diag);
 
 
     // ================================================================================================
@@ -270,7 +277,16 @@ int main(int argc, char** argv)
     // ================================================================================================
     // SIMULATION                                                                                     |
     // ================================================================================================
-    predcorr_operator(get_field(rho_alloc_host), dt, iter_nb);
+    if (adaptive_dt) {
+        CFLTimeStepController const time_step_controller(
+                PCpp_double(conf_gyselalibxx, ".Time.cfl"),
+                PCpp_double(conf_gyselalibxx, ".Time.delta_t_min"),
+                dt,
+                time_step_diag_input * dt);
+        predcorr_operator(get_field(rho_alloc_host), iter_nb * dt, time_step_controller);
+    } else {
+        predcorr_operator(get_field(rho_alloc_host), dt, iter_nb);
+    }
 
 
     end_simulation = std::chrono::system_clock::now();
@@ -278,6 +294,7 @@ int main(int argc, char** argv)
 
 
     PC_tree_destroy(&conf_pdi);
+    finalise_region_profiling();
     PDI_finalize();
     PC_tree_destroy(&conf_gyselalibxx);
 
@@ -25,6 +25,7 @@
 #include "paraconfpp.hpp"
 #include "params.yaml.hpp"
 #include "pdi_out.yml.hpp"
+#include "region_profiler.hpp"
 #include "simpson_quadrature.hpp"
 #include "species_info.hpp"
 #include "species_init.hpp"
@@ -43,6 +44,7 @@ int main(int argc, char** argv)
 
     Kokkos::ScopeGuard kokkos_scope(argc, argv);
     ddc::ScopeGuard ddc_scope(argc, argv);
+    start_region_profiling_if_requested();
 
     // --------- INITIALISATION ---------
     // ---> Reading of the mesh configuration from input YAML file
@@ -154,6 +156,7 @@ int main(int argc, char** argv)
 
 
     // --------- FINALISATION ---------
+    finalise_region_profiling();
     PDI_finalize();
     PC_tree_destroy(&conf_pdi);
     PC_tree_destroy(&conf_collision);
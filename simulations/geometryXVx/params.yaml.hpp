@@ -23,7 +23,14 @@ Algorithm:
   equilibrium: "maxwellian"
   deltat: 0.125
   nbiter: 360
+  fused_predictor: false
+  adaptive_deltat: false
+  cfl: 0.5
+  deltat_min: 0.01
 
 Output:
   time_diag: 0.25
+  time_checkpoint: 10.0
+  insitu_diagnostics: true
+  fourier_modes: [1, 2]
 )PDI_CFG";
@@ -9,6 +9,7 @@ metadata:
   iter_start : int
   time_saved : double
   nbstep_diag: int
+  nbstep_checkpoint: int
   iter_saved : int
   MeshX_extents: { type: array, subtype: int64, size: 1 }
   MeshX:
@@ -37,19 +38,100 @@ metadata:
     subtype: double
     size: [ '$fdistribu_eq_extents[0]', '$fdistribu_eq_extents[1]' ]
 
+  #-- Parallel data
+  local_fdistribu_starts: { type: array, subtype: size_t, size: 3 }
+  local_fdistribu_extents: { type: array, subtype: size_t, size: 3 }
+
+  #-- In-situ diagnostics
+  diag_write_index: int
+  diag_n_records: int
+  diag_n_modes: int
+  diag_n_species: int
+  diag_n_x: int
+
 data:
-  fdistribu_extents: { type: array, subtype: int64, size: 3 }
   fdistribu:
     type: array
     subtype: double
-    size: [ '$fdistribu_extents[0]', '$fdistribu_extents[1]', '$fdistribu_extents[2]' ]
+    size: [ '$local_fdistribu_extents[0]', '$local_fdistribu_extents[1]', '$local_fdistribu_extents[2]' ]
   electrostatic_potential_extents: { type: array, subtype: int64, size: 1 }
   electrostatic_potential:
     type: array
     subtype: double
     size: [ '$electrostatic_potential_extents[0]' ]
+  diag_fourier_modes: { type: array, subtype: int, size: [ '$diag_n_modes' ] }
+  diag_time: { type: array, subtype: double, size: [ '$diag_n_records' ] }
+  diag_electrostatic_energy: { type: array, subtype: double, size: [ '$diag_n_records' ] }
+  diag_fourier_amplitudes: { type: array, subtype: double, size: [ '$diag_n_records', '$diag_n_modes' ] }
+  diag_mass: { type: array, subtype: double, size: [ '$diag_n_records', '$diag_n_species' ] }
+  diag_l1_norm: { type: array, subtype: double, size: [ '$diag_n_records', '$diag_n_species' ] }
+  diag_l2_norm: { type: array, subtype: double, size: [ '$diag_n_records', '$diag_n_species' ] }
+  diag_entropy: { type: array, subtype: double, size: [ '$diag_n_records', '$diag_n_species' ] }
+  diag_density: { type: array, subtype: double, size: [ '$diag_n_records', '$diag_n_species', '$diag_n_x' ] }
+  diag_mean_velocity: { type: array, subtype: double, size: [ '$diag_n_records', '$diag_n_species', '$diag_n_x' ] }
+  diag_temperature: { type: array, subtype: double, size: [ '$diag_n_records', '$diag_n_species', '$diag_n_x' ] }
+
+  #-- Region profiling (see finalise_region_profiling)
+  region_profiling_rank: int
+  region_profiling_step: int
+  region_profiling_step_names_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_step_names:
+    type: array
+    subtype: char
+    size: [ '$region_profiling_step_names_extents[0]' ]
+  region_profiling_step_times_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_step_times:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_step_times_extents[0]' ]
+  region_profiling_names_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_names:
+    type: array
+    subtype: char
+    size: [ '$region_profiling_names_extents[0]' ]
+  region_profiling_calls_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_calls:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_calls_extents[0]' ]
+  region_profiling_inclusive_min_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_inclusive_min:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_inclusive_min_extents[0]' ]
+  region_profiling_inclusive_max_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_inclusive_max:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_inclusive_max_extents[0]' ]
+  region_profiling_inclusive_mean_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_inclusive_mean:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_inclusive_mean_extents[0]' ]
+  region_profiling_exclusive_min_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_exclusive_min:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_exclusive_min_extents[0]' ]
+  region_profiling_exclusive_max_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_exclusive_max:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_exclusive_max_extents[0]' ]
+  region_profiling_exclusive_mean_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_exclusive_mean:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_exclusive_mean_extents[0]' ]
+  region_profiling_bytes_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_bytes:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_bytes_extents[0]' ]
 
 plugins:
+  mpi:
   set_value:
     on_init:
       - share:
@@ -64,14 +146,71 @@ plugins:
     - file: 'GYSELALIBXX_initstate.h5'
       on_event: [initial_state]
       collision_policy: replace_and_warn
-      write: [Nx_spline_cells, Nvx_spline_cells, MeshX, MeshVx, nbstep_diag, Nkinspecies, fdistribu_charges,fdistribu_masses, fdistribu_eq]
+      write: [Nx_spline_cells, Nvx_spline_cells, MeshX, MeshVx, nbstep_diag, nbstep_checkpoint, Nkinspecies, fdistribu_charges,fdistribu_masses, fdistribu_eq]
     - file: 'GYSELALIBXX_${iter_saved:05}.h5'
+      communicator: $MPI_COMM_WORLD
       on_event: [iteration, last_iteration]
       when: '${iter} % ${nbstep_diag} = 0'
       collision_policy: replace_and_warn
-      write: [time_saved, fdistribu, electrostatic_potential]
+      write: [time_saved, electrostatic_potential]
+    # The distribution function is only saved at the checkpoints and at the end of the simulation
+    - file: 'GYSELALIBXX_${iter_saved:05}.h5'
+      communicator: $MPI_COMM_WORLD
+      on_event: iteration
+      when: '${iter} % ${nbstep_checkpoint} = 0'
+      collision_policy: write_into
+      datasets:
+        fdistribu:
+          type: array
+          subtype: double
+          size: [ '$Nkinspecies', '$MeshX_extents[0]', '$MeshVx_extents[0]' ]
+      write:
+        fdistribu:
+          dataset_selection:
+            size: [ '$local_fdistribu_extents[0]', '$local_fdistribu_extents[1]', '$local_fdistribu_extents[2]' ]
+            start: [ '$local_fdistribu_starts[0]', '$local_fdistribu_starts[1]', '$local_fdistribu_starts[2]' ]
+    - file: 'GYSELALIBXX_${iter_saved:05}.h5'
+      communicator: $MPI_COMM_WORLD
+      on_event: last_iteration
+      when: '${iter} % ${nbstep_diag} = 0'
+      collision_policy: write_into
+      datasets:
+        fdistribu:
+          type: array
+          subtype: double
+          size: [ '$Nkinspecies', '$MeshX_extents[0]', '$MeshVx_extents[0]' ]
+      write:
+        fdistribu:
+          dataset_selection:
+            size: [ '$local_fdistribu_extents[0]', '$local_fdistribu_extents[1]', '$local_fdistribu_extents[2]' ]
+            start: [ '$local_fdistribu_starts[0]', '$local_fdistribu_starts[1]', '$local_fdistribu_starts[2]' ]
+    - file: 'GYSELALIBXX_diag_${diag_write_index:05}.h5'
+      on_event: insitu_diagnostics
+      collision_policy: replace_and_warn
+      write: [diag_fourier_modes, diag_time, diag_electrostatic_energy, diag_fourier_amplitudes, diag_mass, diag_l1_norm, diag_l2_norm, diag_entropy, diag_density, diag_mean_velocity, diag_temperature]
     - file: 'GYSELALIBXX_${iter_start:05}.h5'
+      communicator: $MPI_COMM_WORLD
       on_event: restart
-      read: [time_saved, fdistribu]
+      read:
+        time_saved: ~
+        fdistribu:
+          dataset_selection:
+            size: [ '$local_fdistribu_extents[0]', '$local_fdistribu_extents[1]', '$local_fdistribu_extents[2]' ]
+            start: [ '$local_fdistribu_starts[0]', '$local_fdistribu_starts[1]', '$local_fdistribu_starts[2]' ]
+    # The region profiling summary is identical on all ranks, it is only written by rank 0
+    - file: 'GYSELALIBXX_region_profiling.h5'
+      on_event: region_profiling_summary
+      when: '${region_profiling_rank} = 0'
+      collision_policy: replace_and_warn
+      write: [region_profiling_names, region_profiling_calls, region_profiling_inclusive_min, region_profiling_inclusive_max, region_profiling_inclusive_mean, region_profiling_exclusive_min, region_profiling_exclusive_max, region_profiling_exclusive_mean, region_profiling_bytes]
+    # The timings of each iteration are only exposed if GSLX_REGION_PROFILING_STREAM=1
+    - file: 'GYSELALIBXX_region_profiling_rank${region_profiling_rank:05}.h5'
+      on_event: region_profiling_iteration
+      collision_policy: write_into
+      write:
+        region_profiling_step_names:
+          dataset: 'step_${region_profiling_step:06}/names'
+        region_profiling_step_times:
+          dataset: 'step_${region_profiling_step:06}/times'
   #trace: ~
 )PDI_CFG";
@@ -1,39 +1,52 @@
 // SPDX-License-Identifier: MIT
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <cstdlib>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
 #include <string_view>
+#include <vector>
 
 #include <ddc/ddc.hpp>
 #include <ddc/kernels/fft.hpp>
 
+#include <mpi.h>
 #include <paraconf.h>
 #include <pdi.h>
 
 #include "bsl_advection_vx.hpp"
 #include "bsl_advection_x.hpp"
+#include "cfl_time_step_controller.hpp"
 #include "chargedensitycalculator.hpp"
 #include "ddc_alias_inline_functions.hpp"
 #include "fft_poisson_solver.hpp"
 #include "geometry_xvx.hpp"
 #include "input.hpp"
+#include "insitu_diagnostics.hpp"
 #include "maxwellianequilibrium.hpp"
+#include "mpichargedensitycalculator.hpp"
+#include "mpisplitvlasovsolver.hpp"
+#include "mpitransposealltoall.hpp"
 #include "neumann_spline_quadrature.hpp"
 #include "output.hpp"
+#include "pdi_helper.hpp"
 #include "paraconfpp.hpp"
 #include "params.yaml.hpp"
 #include "pdi_out.yml.hpp"
 #include "predcorr.hpp"
 #include "qnsolver.hpp"
+#include "region_profiler.hpp"
 #include "restartinitialisation.hpp"
 #include "singlemodeperturbinitialisation.hpp"
 #include "species_info.hpp"
 #include "species_init.hpp"
 #include "spline_definitions_xvx.hpp"
 #include "splitvlasovsolver.hpp"
+#include "trapezoid_quadrature.hpp"
 
 using std::cerr;
 using std::endl;
@@ -47,10 +60,17 @@ int main(int argc, char** argv)
     parse_executable_arguments(conf_gyselalibxx, iter_start, argc, argv, params_yaml);
     PC_tree_t conf_pdi = PC_parse_string(PDI_CFG);
     PC_errhandler(PC_NULL_HANDLER);
+    MPI_Init(&argc, &argv);
     PDI_init(conf_pdi);
 
     Kokkos::ScopeGuard kokkos_scope(argc, argv);
     ddc::ScopeGuard ddc_scope(argc, argv);
+    start_region_profiling_if_requested();
+
+    int rank;
+    int size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
 
     // Reading config
     // --> Mesh info
@@ -68,6 +88,12 @@ int main(int argc, char** argv)
     IdxRangeSpXVx const meshSpXVx(idx_range_kinsp, meshXVx);
     IdxRangeSpVx const meshSpVx(idx_range_kinsp, mesh_vx);
 
+    // The advections along x and the charge density are computed in the VxSplit layout,
+    // the advections along vx in the XSplit layout
+    MPITransposeAllToAll<XSplit, VxSplit> transpose(meshSpXVx, MPI_COMM_WORLD);
+    IdxRangeSpXVx const meshSpXVx_vxsplit(transpose.get_local_idx_range<VxSplit>());
+    IdxRangeVx const mesh_vx_vxsplit(meshSpXVx_vxsplit);
+
     SplineInterpolatorX spline_interpolation_x(mesh_x);
     SplineInterpolatorVx spline_interpolation_vx(mesh_vx);
 
@@ -78,8 +104,10 @@ int main(int argc, char** argv)
     (*init_fequilibrium)(get_field(allfequilibrium));
 
     ddc::expose_to_pdi("iter_start", iter_start);
+    // Save the local index range for the parallel input/output
+    PDI_expose_idx_range(meshSpXVx_vxsplit, "local_fdistribu");
 
-    DFieldMemSpXVx allfdistribu(meshSpXVx);
+    DFieldMemSpXVx allfdistribu(meshSpXVx_vxsplit);
     double time_start(0);
     if (iter_start == 0) {
         SingleModePerturbInitialisation const init
@@ -97,27 +125,81 @@ int main(int argc, char** argv)
     // --> Algorithm info
     double const deltat = PCpp_double(conf_gyselalibxx, ".Algorithm.deltat");
     int const nbiter = static_cast<int>(PCpp_int(conf_gyselalibxx, ".Algorithm.nbiter"));
+    bool const fused_predictor = PCpp_bool(conf_gyselalibxx, ".Algorithm.fused_predictor");
+    bool const adaptive_deltat = PCpp_bool(conf_gyselalibxx, ".Algorithm.adaptive_deltat");
+    if (adaptive_deltat && size > 1) {
+        // The CFL condition would be evaluated on the local species and velocities
+        throw std::runtime_error("Adaptive time stepping is not available with several MPI ranks.");
+    }
 
     // --> Output info
     double const time_diag = PCpp_double(conf_gyselalibxx, ".Output.time_diag");
-    int const nbstep_diag = int(time_diag / deltat);
+    // With an adaptive timestep the iteration PDI events are only triggered at output times
+    int const nbstep_diag = adaptive_deltat ? 1 : int(time_diag / deltat);
+    // The full distribution function is only saved every time_checkpoint
+    double const time_checkpoint = PCpp_double(conf_gyselalibxx, ".Output.time_checkpoint");
+    int const nbstep_checkpoint
+            = nbstep_diag * std::max(1l, std::lround(time_checkpoint / time_diag));
+    bool const insitu_diagnostics = PCpp_bool(conf_gyselalibxx, ".Output.insitu_diagnostics");
+    std::vector<int> fourier_modes(PCpp_len(conf_gyselalibxx, ".Output.fourier_modes"));
+    for (std::size_t i(0); i < fourier_modes.size(); ++i) {
+        fourier_modes[i] = static_cast<int>(
+                PCpp_int(conf_gyselalibxx, ".Output.fourier_modes[%d]", static_cast<int>(i)));
+    }
 
     // Creating operators
     BslAdvectionSpatial<GeometryXVx, SplineInterpolatorX> const advection_x(spline_interpolation_x);
     BslAdvectionVelocity<GeometryXVx, SplineInterpolatorVx> const advection_vx(
             spline_interpolation_vx);
 
-    SplitVlasovSolver const vlasov(advection_x, advection_vx);
+    // On a single rank the distribution function is not transposed
+    std::unique_ptr<IBoltzmannSolver> vlasov;
+    if (size == 1) {
+        vlasov = std::make_unique<SplitVlasovSolver>(advection_x, advection_vx);
+    } else {
+        vlasov = std::make_unique<MpiSplitVlasovSolver>(advection_x, advection_vx, transpose);
+    }
 
     DFieldMemVx const quadrature_coeffs(
             neumann_spline_quadrature_coefficients<
                     Kokkos::DefaultExecutionSpace>(mesh_vx, spline_interpolation_vx.get_builder()));
-
-    ChargeDensityCalculator rhs(get_field(quadrature_coeffs));
+    DFieldMemVx local_quadrature_coeffs(mesh_vx_vxsplit);
+    ddc::parallel_deepcopy(
+            get_field(local_quadrature_coeffs),
+            quadrature_coeffs[mesh_vx_vxsplit]);
+
+    ChargeDensityCalculator const rhs_local(get_const_field(local_quadrature_coeffs));
+    // On a single rank the charge density is not reduced over the ranks
+    std::unique_ptr<IChargeDensityCalculator const> rhs_mpi;
+    if (size > 1) {
+        rhs_mpi = std::make_unique<MpiChargeDensityCalculator>(MPI_COMM_WORLD, rhs_local);
+    }
+    IChargeDensityCalculator const& rhs = rhs_mpi ? *rhs_mpi : rhs_local;
     FFTPoissonSolver<IdxRangeX> fft_poisson_solver(mesh_x);
     QNSolver const poisson(fft_poisson_solver, rhs);
 
-    PredCorr const predcorr(vlasov, poisson);
+    DFieldMemX const quadrature_coeffs_x
+            = trapezoid_quadrature_coefficients_1d<Kokkos::DefaultExecutionSpace>(mesh_x);
+    std::unique_ptr<InSituDiagnostics> diagnostics;
+    if (insitu_diagnostics) {
+        diagnostics = std::make_unique<InSituDiagnostics>(
+                MPI_COMM_WORLD,
+                idx_range_kinsp,
+                get_const_field(quadrature_coeffs_x),
+                get_const_field(local_quadrature_coeffs),
+                fourier_modes,
+                std::max(1, int(time_diag / deltat)));
+    }
+
+    PredCorr const predcorr
+            = fused_predictor
+                      ? PredCorr(*vlasov,
+                                 poisson,
+                                 fft_poisson_solver,
+                                 get_const_field(local_quadrature_coeffs),
+                                 diagnostics.get(),
+                                 nbstep_checkpoint)
+                      : PredCorr(*vlasov, poisson, diagnostics.get(), nbstep_checkpoint);
 
     // Starting the code
     ddc::expose_to_pdi("Nx_spline_cells", ddc::discrete_space<BSplinesX>().ncells());
@@ -125,6 +207,7 @@ int main(int argc, char** argv)
     expose_mesh_to_pdi("MeshX", mesh_x);
     expose_mesh_to_pdi("MeshVx", mesh_vx);
     ddc::expose_to_pdi("nbstep_diag", nbstep_diag);
+    ddc::expose_to_pdi("nbstep_checkpoint", nbstep_checkpoint);
     ddc::expose_to_pdi("Nkinspecies", idx_range_kinsp.size());
     ddc::expose_to_pdi(
             "fdistribu_charges",
@@ -132,11 +215,26 @@ int main(int argc, char** argv)
     ddc::expose_to_pdi(
             "fdistribu_masses",
             ddc::discrete_space<Species>().masses()[idx_range_kinsp]);
-    ddc::PdiEvent("initial_state").with("fdistribu_eq", allfequilibrium_host);
+    if (rank == 0) {
+        ddc::PdiEvent("initial_state").with("fdistribu_eq", allfequilibrium_host);
+    }
 
     steady_clock::time_point const start = steady_clock::now();
 
-    predcorr(get_field(allfdistribu), time_start, deltat, nbiter);
+    if (adaptive_deltat) {
+        // deltat is the largest timestep allowed
+        CFLTimeStepController const time_step_controller(
+                PCpp_double(conf_gyselalibxx, ".Algorithm.cfl"),
+                PCpp_double(conf_gyselalibxx, ".Algorithm.deltat_min"),
+                deltat,
+                time_diag);
+        predcorr(get_field(allfdistribu),
+                 time_start,
+                 time_start + nbiter * deltat,
+                 time_step_controller);
+    } else {
+        predcorr(get_field(allfdistribu), time_start, deltat, nbiter);
+    }
 
     steady_clock::time_point const end = steady_clock::now();
 
@@ -145,8 +243,11 @@ int main(int argc, char** argv)
 
     PC_tree_destroy(&conf_pdi);
 
+    finalise_region_profiling();
     PDI_finalize();
 
+    MPI_Finalize();
+
     PC_tree_destroy(&conf_gyselalibxx);
 
     return EXIT_SUCCESS;
@@ -14,6 +14,8 @@
 #include "../spline_definitions_xy.hpp"
 
 #include "bsl_advection_1d.hpp"
+#include "bsl_advection_2d.hpp"
+#include "cfl_time_step_controller.hpp"
 #include "ddc_alias_inline_functions.hpp"
 #include "euler.hpp"
 #include "fft_poisson_solver.hpp"
@@ -26,6 +28,8 @@
 #include "params.yaml.hpp"
 #include "pdi_out.yml.hpp"
 #include "predcorr_RK2.hpp"
+#include "region_profiler.hpp"
+#include "rk2.hpp"
 #include "simulation_utils_tools.hpp"
 #include "vector_field.hpp"
 #include "vector_field_mem.hpp"
@@ -49,6 +53,7 @@ int main(int argc, char** argv)
 
     Kokkos::ScopeGuard kokkos_scope(argc, argv);
     ddc::ScopeGuard ddc_scope(argc, argv);
+    start_region_profiling_if_requested();
 
     // CREATING MESH AND SUPPORTS ----------------------------------------------------------------
     IdxRangeX const interpolation_idx_range_x = init_spline_dependent_idx_range<
@@ -69,9 +74,13 @@ int main(int argc, char** argv)
     double const delta_t = PCpp_double(conf_gyselalibxx, ".Algorithm.delta_t");
     double const final_time = PCpp_double(conf_gyselalibxx, ".Algorithm.final_time");
     int const nbiter = int(final_time / delta_t);
+    bool const adaptive_delta_t = PCpp_bool(conf_gyselalibxx, ".Algorithm.adaptive_delta_t");
+    bool const split_advection = PCpp_bool(conf_gyselalibxx, ".Algorithm.split_advection");
 
     // --> Output info
-    int const nbstep_diag = PCpp_int(conf_gyselalibxx, ".Output.nbstep_diag");
+    int const nbstep_diag_input = PCpp_int(conf_gyselalibxx, ".Output.nbstep_diag");
+    // With an adaptive time step the iteration PDI events are only triggered at output times
+    int const nbstep_diag = adaptive_delta_t ? 1 : nbstep_diag_input;
 
     // --> Initial function infos
     double const epsilon = PCpp_double(conf_gyselalibxx, ".PerturbationInfo.perturb_amplitude");
@@ -79,42 +88,15 @@ int main(int argc, char** argv)
 
 
     // DEFINING OPERATORS ------------------------------------------------------------------------
-    // Create spline builderss ---
-    SplineXInterpolator interpolator_x(interpolation_idx_range_x);
-    SplineYInterpolator interpolator_y(interpolation_idx_range_y);
-
     // Create Poisson solver ---
     FFTPoissonSolver<IdxRangeXY> const poisson_solver(meshXY);
 
-    // Create advection operators ---
-    EulerBuilder euler;
-    BslAdvection1D<
-            GridX,
-            IdxRangeXY,
-            IdxRangeXY,
-            SplineXInterpolator,
-            SplineXInterpolator,
-            EulerBuilder>
-            advection_x(interpolator_x, euler);
-
-    BslAdvection1D<
-            GridY,
-            IdxRangeXY,
-            IdxRangeXY,
-            SplineYInterpolator,
-            SplineYInterpolator,
-            EulerBuilder>
-            advection_y(interpolator_y, euler);
-
+    // Only the advection operator selected by split_advection is created (see SIMULATION).
 
     // Create an initialiser ---
     KelvinHelmholtzInstabilityInitialisation initialise(epsilon, mode_k);
 
 
-    // Create predcorr operator: predictor-corrector method based on RK2 ---
-    PredCorrRK2XY predictor_corrector(poisson_solver, advection_x, advection_y);
-
-
     // INITIALISATION ----------------------------------------------------------------------------
     // Initialisation of the distributed function
     DFieldMemXY allfdistribu_equilibrium_alloc(meshXY);
@@ -172,16 +154,79 @@ int main(int argc, char** argv)
             .with("electric_field_y", electric_field_y_host);
 
     // // SIMULATION --------------------------------------------------------------------------------
-    std::chrono::time_point<std::chrono::system_clock> const start
-            = std::chrono::system_clock::now();
-
-    predictor_corrector(allfdistribu, delta_t, nbiter);
-
-    std::chrono::time_point<std::chrono::system_clock> const end = std::chrono::system_clock::now();
-
-    display_time_difference("Simulation time: ", start, end);
+    auto run_simulation = [&](auto& predictor_corrector) {
+        std::chrono::time_point<std::chrono::system_clock> const start
+                = std::chrono::system_clock::now();
+
+        if (adaptive_delta_t) {
+            // delta_t is the largest time step allowed
+            CFLTimeStepController const time_step_controller(
+                    PCpp_double(conf_gyselalibxx, ".Algorithm.cfl"),
+                    PCpp_double(conf_gyselalibxx, ".Algorithm.delta_t_min"),
+                    delta_t,
+                    nbstep_diag_input * delta_t);
+            predictor_corrector(allfdistribu, nbiter * delta_t, time_step_controller);
+        } else {
+            predictor_corrector(allfdistribu, delta_t, nbiter);
+        }
+
+        std::chrono::time_point<std::chrono::system_clock> const end
+                = std::chrono::system_clock::now();
+
+        display_time_difference("Simulation time: ", start, end);
+    };
+
+    if (split_advection) {
+        // Create spline interpolators ---
+        SplineXInterpolator interpolator_x(interpolation_idx_range_x);
+        SplineYInterpolator interpolator_y(interpolation_idx_range_y);
+
+        // Create advection operators ---
+        EulerBuilder euler;
+        BslAdvection1D<
+                GridX,
+                IdxRangeXY,
+                IdxRangeXY,
+                SplineXInterpolator,
+                SplineXInterpolator,
+                EulerBuilder>
+                advection_x(interpolator_x, euler);
+
+        BslAdvection1D<
+                GridY,
+                IdxRangeXY,
+                IdxRangeXY,
+                SplineYInterpolator,
+                SplineYInterpolator,
+                EulerBuilder>
+                advection_y(interpolator_y, euler);
+
+        // Create predcorr operator: predictor-corrector method based on RK2 ---
+        PredCorrRK2XY predictor_corrector(poisson_solver, advection_x, advection_y);
+        run_simulation(predictor_corrector);
+    } else {
+        // Create the 2D spline builder and evaluator ---
+        SplineXYBuilder const builder_xy(meshXY);
+        ddc::PeriodicExtrapolationRule<X> extrapolation_rule_x;
+        ddc::PeriodicExtrapolationRule<Y> extrapolation_rule_y;
+        SplineXYEvaluator const evaluator_xy(
+                extrapolation_rule_x,
+                extrapolation_rule_x,
+                extrapolation_rule_y,
+                extrapolation_rule_y);
+
+        // Create advection operator ---
+        RK2Builder rk2;
+        BslAdvection2D<IdxRangeXY, SplineXYBuilder, SplineXYEvaluator, RK2Builder>
+                advection_xy(builder_xy, evaluator_xy, rk2);
+
+        // Create predcorr operator: predictor-corrector method based on RK2 ---
+        PredCorrRK2XY predictor_corrector(poisson_solver, advection_xy);
+        run_simulation(predictor_corrector);
+    }
 
     PC_tree_destroy(&conf_pdi);
+    finalise_region_profiling();
     PDI_finalize();
     PC_tree_destroy(&conf_gyselalibxx);
 
@@ -17,6 +17,10 @@ PerturbationInfo:
 Algorithm:
   delta_t: 0.05
   final_time: 30
+  adaptive_delta_t: false
+  split_advection: true
+  cfl: 0.5
+  delta_t_min: 0.005
 
 Output:
   nbstep_diag: 4
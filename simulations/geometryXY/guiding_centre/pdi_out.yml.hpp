@@ -60,6 +60,64 @@ data:
     subtype: double
     size: [ '$electric_field_y_extents[0]', '$electric_field_y_extents[1]' ]
 
+  #-- Region profiling (see finalise_region_profiling)
+  region_profiling_rank: int
+  region_profiling_step: int
+  region_profiling_step_names_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_step_names:
+    type: array
+    subtype: char
+    size: [ '$region_profiling_step_names_extents[0]' ]
+  region_profiling_step_times_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_step_times:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_step_times_extents[0]' ]
+  region_profiling_names_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_names:
+    type: array
+    subtype: char
+    size: [ '$region_profiling_names_extents[0]' ]
+  region_profiling_calls_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_calls:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_calls_extents[0]' ]
+  region_profiling_inclusive_min_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_inclusive_min:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_inclusive_min_extents[0]' ]
+  region_profiling_inclusive_max_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_inclusive_max:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_inclusive_max_extents[0]' ]
+  region_profiling_inclusive_mean_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_inclusive_mean:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_inclusive_mean_extents[0]' ]
+  region_profiling_exclusive_min_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_exclusive_min:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_exclusive_min_extents[0]' ]
+  region_profiling_exclusive_max_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_exclusive_max:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_exclusive_max_extents[0]' ]
+  region_profiling_exclusive_mean_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_exclusive_mean:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_exclusive_mean_extents[0]' ]
+  region_profiling_bytes_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_bytes:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_bytes_extents[0]' ]
 
 plugins:
   set_value:
@@ -84,5 +142,20 @@ plugins:
       when: '${iter} % ${nbstep_diag} = 0'
       collision_policy: replace_and_warn
       write: [iter, time_saved, fdistribu, electrostatic_potential, electric_field_x, electric_field_y]
+    # The region profiling summary is identical on all ranks, it is only written by rank 0
+    - file: 'output/GYSELALIBXX_region_profiling.h5'
+      on_event: region_profiling_summary
+      when: '${region_profiling_rank} = 0'
+      collision_policy: replace_and_warn
+      write: [region_profiling_names, region_profiling_calls, region_profiling_inclusive_min, region_profiling_inclusive_max, region_profiling_inclusive_mean, region_profiling_exclusive_min, region_profiling_exclusive_max, region_profiling_exclusive_mean, region_profiling_bytes]
+    # The timings of each iteration are only exposed if GSLX_REGION_PROFILING_STREAM=1
+    - file: 'output/GYSELALIBXX_region_profiling_rank${region_profiling_rank:05}.h5'
+      on_event: region_profiling_iteration
+      collision_policy: write_into
+      write:
+        region_profiling_step_names:
+          dataset: 'step_${region_profiling_step:06}/names'
+        region_profiling_step_times:
+          dataset: 'step_${region_profiling_step:06}/times'
   #trace: ~
 )PDI_CFG";
@@ -59,6 +59,31 @@ using SplineYInterpolator = SplineInterpolator<
         SplineYBoundary,
         SplineYBoundary>;
 
+using SplineXYBuilder = ddc::SplineBuilder2D<
+        Kokkos::DefaultExecutionSpace,
+        typename Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesX,
+        BSplinesY,
+        GridX,
+        GridY,
+        SplineXBoundary,
+        SplineXBoundary,
+        SplineYBoundary,
+        SplineYBoundary,
+        ddc::SplineSolver::LAPACK>;
+
+using SplineXYEvaluator = ddc::SplineEvaluator2D<
+        Kokkos::DefaultExecutionSpace,
+        typename Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesX,
+        BSplinesY,
+        GridX,
+        GridY,
+        ddc::PeriodicExtrapolationRule<X>,
+        ddc::PeriodicExtrapolationRule<X>,
+        ddc::PeriodicExtrapolationRule<Y>,
+        ddc::PeriodicExtrapolationRule<Y>>;
+
 // Spline index range
 using IdxRangeBSX = IdxRange<BSplinesX>;
 using IdxRangeBSY = IdxRange<BSplinesY>;
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ddc/ddc.hpp>
+
+#include "ddc_aliases.hpp"
+#include "geometry_xyvxvy.hpp"
+#include "lagrange_basis_uniform.hpp"
+#include "lagrange_evaluator.hpp"
+
+/*
+ * Definitions used by the halo exchange parallel mode where the spatial dimensions are
+ * distributed across MPI ranks. The spatial advections interpolate the distribution
+ * function with Lagrange polynomials defined on the local grid extended by a halo.
+ * These grids do not cover the whole periodic domain so they are defined on
+ * non-periodic dimensions whose coordinates coincide with the coordinates of X and Y.
+ */
+
+/// @brief A class which describes the first spatial direction on a halo-extended local block.
+struct XHalo
+{
+    /// @brief A boolean indicating if the dimension is periodic.
+    static bool constexpr PERIODIC = false;
+};
+
+/// @brief A class which describes the second spatial direction on a halo-extended local block.
+struct YHalo
+{
+    /// @brief A boolean indicating if the dimension is periodic.
+    static bool constexpr PERIODIC = false;
+};
+
+std::size_t constexpr LagrangeDegreeXYHalo = 5;
+
+struct GridXHalo : UniformGridBase<XHalo>
+{
+};
+struct GridYHalo : UniformGridBase<YHalo>
+{
+};
+
+struct LagrangeBasisXHalo : UniformLagrangeBasis<XHalo, LagrangeDegreeXYHalo>
+{
+};
+struct LagrangeBasisYHalo : UniformLagrangeBasis<YHalo, LagrangeDegreeXYHalo>
+{
+};
+
+using LagrangeEvaluatorXHalo = LagrangeEvaluator<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        double,
+        LagrangeBasisXHalo,
+        GridXHalo,
+        ddc::NullExtrapolationRule,
+        ddc::NullExtrapolationRule>;
+using LagrangeEvaluatorYHalo = LagrangeEvaluator<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        double,
+        LagrangeBasisYHalo,
+        GridYHalo,
+        ddc::NullExtrapolationRule,
+        ddc::NullExtrapolationRule>;
+
+/// The distribution of the spatial dimensions used by the halo exchange parallel mode.
+using XY2DSplitVxVyXY = MPILayout<IdxRangeSpVxVyXY, GridX, GridY>;
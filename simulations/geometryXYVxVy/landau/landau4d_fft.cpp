@@ -5,6 +5,8 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
+#include <string>
 #include <string_view>
 
 #include <ddc/ddc.hpp>
@@ -13,17 +15,22 @@
 #include <paraconf.h>
 #include <pdi.h>
 
+#include "../halo_definitions_xyvxvy.hpp"
 #include "../spline_definitions_xyvxvy.hpp"
 
 #include "bsl_advection_vx.hpp"
 #include "bsl_advection_x.hpp"
 #include "chargedensitycalculator.hpp"
 #include "ddc_alias_inline_functions.hpp"
+#include "ddc_helper.hpp"
 #include "fft_poisson_solver.hpp"
+#include "first_touch.hpp"
 #include "geometry_xyvxvy.hpp"
 #include "input.hpp"
 #include "maxwellianequilibrium.hpp"
+#include "mpi_bsl_advection_x.hpp"
 #include "mpichargedensitycalculator.hpp"
+#include "mpigatherpoissonsolver.hpp"
 #include "mpisplitvlasovsolver.hpp"
 #include "mpitransposealltoall.hpp"
 #include "neumann_spline_quadrature.hpp"
@@ -33,9 +40,14 @@
 #include "pdi_out.yml.hpp"
 #include "predcorr.hpp"
 #include "qnsolver.hpp"
+#include "region_profiler.hpp"
 #include "singlemodeperturbinitialisation.hpp"
+#include "splitting_scheme.hpp"
+#include "splitvlasovsolver.hpp"
 #include "species_info.hpp"
 #include "species_init.hpp"
+#include "thread_binding.hpp"
+#include "transpose.hpp"
 
 using std::cerr;
 using std::endl;
@@ -52,9 +64,13 @@ int main(int argc, char** argv)
 
     Kokkos::ScopeGuard kokkos_scope(argc, argv);
     ddc::ScopeGuard ddc_scope(argc, argv);
+    start_region_profiling_if_requested();
 
     int rank;
+    int size;
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    print_thread_binding();
 
     // Reading config
     // --> Mesh info
@@ -104,7 +120,6 @@ int main(int argc, char** argv)
             = MaxwellianEquilibrium::init_from_input(idx_range_kinsp, conf_gyselalibxx);
     init_fequilibrium(get_field(allfequilibrium));
     DFieldMemSpXYVxVy allfdistribu_x2D_split(idxrange_spxyvxvy_x2Dsplit);
-    DFieldMemSpVxVyXY allfdistribu_v2D_split(idxrange_spvxvyxy_v2Dsplit);
     SingleModePerturbInitialisation const init = SingleModePerturbInitialisation::
             init_from_input(get_const_field(allfequilibrium), idx_range_kinsp, conf_gyselalibxx);
     init(get_field(allfdistribu_x2D_split));
@@ -112,37 +127,47 @@ int main(int argc, char** argv)
     // --> Algorithm info
     double const deltat = PCpp_double(conf_gyselalibxx, ".Algorithm.deltat");
     int const nbiter = static_cast<int>(PCpp_int(conf_gyselalibxx, ".Algorithm.nbiter"));
+    bool const single_precision_fdistribu
+            = PCpp_bool(conf_gyselalibxx, ".Algorithm.single_precision_fdistribu");
+    bool const fused_predictor = PCpp_bool(conf_gyselalibxx, ".Algorithm.fused_predictor");
+    std::string const splitting = PCpp_string(conf_gyselalibxx, ".Algorithm.splitting");
+    SplittingMethod splitting_method;
+    if (splitting == "strang") {
+        splitting_method = SplittingMethod::Strang;
+    } else if (splitting == "forest_ruth") {
+        splitting_method = SplittingMethod::ForestRuth;
+    } else if (splitting == "blanes_moan") {
+        splitting_method = SplittingMethod::BlanesMoan;
+    } else {
+        throw std::runtime_error("Unrecognised splitting scheme requested : " + splitting);
+    }
+    std::string const parallel_mode = PCpp_string(conf_gyselalibxx, ".Algorithm.parallel_mode");
+    if (parallel_mode != "transpose" && parallel_mode != "halo") {
+        throw std::runtime_error("Unrecognised parallel mode requested : " + parallel_mode);
+    }
 
     // --> Output info
     double const time_diag = PCpp_double(conf_gyselalibxx, ".Output.time_diag");
     int const nbstep_diag = int(time_diag / deltat);
-
-    // Create advection operator
-    BslAdvectionSpatial<GeometryVxVyXY, SplineInterpolatorX> const advection_x(interpolator_x);
-    BslAdvectionSpatial<GeometryVxVyXY, SplineInterpolatorY> const advection_y(interpolator_y);
-    BslAdvectionVelocity<GeometryXYVxVy, SplineInterpolatorVx> const advection_vx(interpolator_vx);
-    BslAdvectionVelocity<GeometryXYVxVy, SplineInterpolatorVy> const advection_vy(interpolator_vy);
-
-    MpiSplitVlasovSolver const
-            vlasov(advection_x, advection_y, advection_vx, advection_vy, transpose);
+    // The layout of the fdistribu datasets (raw: contiguous, compressed: chunked and deflated)
+    std::string const fdistribu_output_profile
+            = PCpp_string(conf_gyselalibxx, ".Output.fdistribu_output_profile");
+    if (fdistribu_output_profile != "raw" && fdistribu_output_profile != "compressed") {
+        throw std::runtime_error(
+                "Unrecognised fdistribu output profile requested : " + fdistribu_output_profile);
+    }
+    int const fdistribu_deflate_level
+            = static_cast<int>(PCpp_int(conf_gyselalibxx, ".Output.fdistribu_deflate_level"));
+    bool const single_precision_output
+            = PCpp_bool(conf_gyselalibxx, ".Output.single_precision_output");
 
     DFieldMemVxVy const quadrature_coeffs(
             neumann_spline_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(
                     idxrange_vxvy,
                     interpolator_vx.get_builder(),
                     interpolator_vy.get_builder()));
-    DFieldMemVxVy local_quadrature_coeffs(idxrange_vxvy_v2Dsplit);
-    ddc::parallel_deepcopy(
-            get_field(local_quadrature_coeffs),
-            quadrature_coeffs[idxrange_vxvy_v2Dsplit]);
 
     FFTPoissonSolver<IdxRangeXY> fft_poisson_solver(idxrange_xy);
-    ChargeDensityCalculator const rhs_local(get_const_field(local_quadrature_coeffs));
-    MpiChargeDensityCalculator const rhs(MPI_COMM_WORLD, rhs_local);
-    QNSolver const poisson(fft_poisson_solver, rhs);
-
-    // Create predcorr operator
-    PredCorr const predcorr(vlasov, poisson);
 
     // Starting the code
     ddc::expose_to_pdi("Nx_spline_cells", ddc::discrete_space<BSplinesX>().ncells());
@@ -154,6 +179,9 @@ int main(int argc, char** argv)
     expose_mesh_to_pdi("MeshVx", idxrange_vx);
     expose_mesh_to_pdi("MeshVy", idxrange_vy);
     ddc::expose_to_pdi("nbstep_diag", nbstep_diag);
+    ddc::expose_to_pdi("fdistribu_compressed", int(fdistribu_output_profile == "compressed"));
+    ddc::expose_to_pdi("fdistribu_deflate_level", fdistribu_deflate_level);
+    ddc::expose_to_pdi("single_precision_output", int(single_precision_output));
     ddc::expose_to_pdi("Nkinspecies", idx_range_kinsp.size());
     ddc::expose_to_pdi(
             "fdistribu_charges",
@@ -168,16 +196,150 @@ int main(int argc, char** argv)
 
     steady_clock::time_point const start = steady_clock::now();
 
-    transpose(
-            Kokkos::DefaultExecutionSpace(),
-            get_field(allfdistribu_v2D_split),
-            get_const_field(allfdistribu_x2D_split));
-
-    // Save the output index range
-    IdxRangeSpXYVxVy idxrange_spxyvxvy_v2Dsplit(idxrange_spvxvyxy_v2Dsplit);
-    PDI_expose_idx_range(idxrange_spxyvxvy_v2Dsplit, "local_fdistribu");
-
-    predcorr(get_field(allfdistribu_v2D_split), deltat, nbiter);
+    // Copy the initial distribution function to the layout of the Vlasov solver and
+    // run the simulation in the requested precision
+    auto const run_simulation = [&](PredCorr const& predcorr,
+                                    IdxRangeSpVxVyXY const idxrange_spvxvyxy_local,
+                                    auto const& change_layout) {
+        // Save the output index range
+        PDI_expose_idx_range(IdxRangeSpXYVxVy(idxrange_spvxvyxy_local), "local_fdistribu");
+        PDI_expose_idx_range(IdxRangeXY(idxrange_spvxvyxy_local), "local_potential");
+
+        if (single_precision_fdistribu) {
+            FieldMemSpVxVyXY<float> allfdistribu_local(idxrange_spvxvyxy_local);
+            first_touch(Kokkos::DefaultExecutionSpace(), get_field(allfdistribu_local));
+            {
+                FieldMemSpXYVxVy<float> allfdistribu_x2D_split_float(idxrange_spxyvxvy_x2Dsplit);
+                ddcHelper::convert_deepcopy(
+                        Kokkos::DefaultExecutionSpace(),
+                        get_field(allfdistribu_x2D_split_float),
+                        get_const_field(allfdistribu_x2D_split));
+                change_layout(
+                        get_field(allfdistribu_local),
+                        get_const_field(allfdistribu_x2D_split_float));
+            }
+            predcorr(get_field(allfdistribu_local), deltat, nbiter);
+        } else {
+            DFieldMemSpVxVyXY allfdistribu_local(idxrange_spvxvyxy_local);
+            first_touch(Kokkos::DefaultExecutionSpace(), get_field(allfdistribu_local));
+            change_layout(get_field(allfdistribu_local), get_const_field(allfdistribu_x2D_split));
+            predcorr(get_field(allfdistribu_local), deltat, nbiter);
+        }
+    };
+
+    if (parallel_mode == "transpose") {
+        // The spatial advections are carried out on the X2DSplit layout and the velocity
+        // advections on the V2DSplit layout. The layouts are changed with MPI transposes.
+        BslAdvectionSpatial<GeometryVxVyXY, SplineInterpolatorX> const advection_x(
+                interpolator_x);
+        BslAdvectionSpatial<GeometryVxVyXY, SplineInterpolatorY> const advection_y(
+                interpolator_y);
+        BslAdvectionVelocity<GeometryXYVxVy, SplineInterpolatorVx> const advection_vx(
+                interpolator_vx);
+        BslAdvectionVelocity<GeometryXYVxVy, SplineInterpolatorVy> const advection_vy(
+                interpolator_vy);
+
+        MpiSplitVlasovSolver const vlasov(
+                advection_x,
+                advection_y,
+                advection_vx,
+                advection_vy,
+                transpose,
+                splitting_method);
+
+        DFieldMemVxVy local_quadrature_coeffs(idxrange_vxvy_v2Dsplit);
+        ddc::parallel_deepcopy(
+                get_field(local_quadrature_coeffs),
+                quadrature_coeffs[idxrange_vxvy_v2Dsplit]);
+
+        ChargeDensityCalculator const rhs_local(get_const_field(local_quadrature_coeffs));
+        MpiChargeDensityCalculator const rhs(MPI_COMM_WORLD, rhs_local);
+        QNSolver const poisson(fft_poisson_solver, rhs);
+
+        // Create predcorr operator
+        PredCorr const predcorr
+                = fused_predictor
+                          ? PredCorr(vlasov,
+                                     poisson,
+                                     fft_poisson_solver,
+                                     get_const_field(local_quadrature_coeffs),
+                                     single_precision_output)
+                          : PredCorr(vlasov, poisson, single_precision_output);
+
+        run_simulation(
+                predcorr,
+                idxrange_spvxvyxy_v2Dsplit,
+                [&](auto fdistribu, auto fdistribu_x2D_split) {
+                    transpose(Kokkos::DefaultExecutionSpace(), fdistribu, fdistribu_x2D_split);
+                });
+    } else {
+        // The spatial dimensions remain distributed. The spatial advections only
+        // communicate with the neighbouring ranks to fill the halos and the field
+        // solves only communicate spatial (2D) quantities.
+        IdxRangeSpVxVyXY const idxrange_spvxvyxy_xy2Dsplit = XY2DSplitVxVyXY::distribute_idx_range(
+                IdxRangeSpVxVyXY(idxrange_glob_spxyvxvy),
+                size,
+                rank);
+        IdxRangeX const idxrange_x_local(idxrange_spvxvyxy_xy2Dsplit);
+        IdxRangeY const idxrange_y_local(idxrange_spvxvyxy_xy2Dsplit);
+
+        // The halos must contain the characteristic feet of the largest advection (dt)
+        using AdvectionXHalo
+                = MpiBslAdvectionSpatial<GeometryVxVyXY, GridX, LagrangeEvaluatorXHalo>;
+        using AdvectionYHalo
+                = MpiBslAdvectionSpatial<GeometryVxVyXY, GridY, LagrangeEvaluatorYHalo>;
+        int const halo_width_x
+                = AdvectionXHalo::get_required_halo_width(idxrange_x, idxrange_vx, deltat);
+        int const halo_width_y
+                = AdvectionYHalo::get_required_halo_width(idxrange_y, idxrange_vy, deltat);
+        init_halo_lagrange_basis<LagrangeBasisXHalo, GridXHalo>(idxrange_x_local, halo_width_x);
+        init_halo_lagrange_basis<LagrangeBasisYHalo, GridYHalo>(idxrange_y_local, halo_width_y);
+
+        AdvectionXHalo::halo_exchange_type const
+                halo_exchange_x(MPI_COMM_WORLD, idxrange_spvxvyxy_xy2Dsplit, halo_width_x);
+        AdvectionYHalo::halo_exchange_type const
+                halo_exchange_y(MPI_COMM_WORLD, idxrange_spvxvyxy_xy2Dsplit, halo_width_y);
+        ddc::NullExtrapolationRule const extrapolation_rule;
+        LagrangeEvaluatorXHalo const evaluator_x(extrapolation_rule, extrapolation_rule);
+        LagrangeEvaluatorYHalo const evaluator_y(extrapolation_rule, extrapolation_rule);
+
+        AdvectionXHalo const advection_x(halo_exchange_x, evaluator_x);
+        AdvectionYHalo const advection_y(halo_exchange_y, evaluator_y);
+        BslAdvectionVelocity<GeometryVxVyXY, SplineInterpolatorVx> const advection_vx(
+                interpolator_vx);
+        BslAdvectionVelocity<GeometryVxVyXY, SplineInterpolatorVy> const advection_vy(
+                interpolator_vy);
+
+        SplitVlasovSolver const
+                vlasov(advection_x, advection_y, advection_vx, advection_vy, splitting_method);
+
+        MpiGatherPoissonSolver const gather_poisson_solver(
+                MPI_COMM_WORLD,
+                fft_poisson_solver,
+                idxrange_xy);
+        ChargeDensityCalculator const rhs(get_const_field(quadrature_coeffs));
+        QNSolver const poisson(gather_poisson_solver, rhs);
+
+        // Create predcorr operator
+        PredCorr const predcorr = fused_predictor
+                                          ? PredCorr(vlasov,
+                                                     poisson,
+                                                     gather_poisson_solver,
+                                                     get_const_field(quadrature_coeffs),
+                                                     single_precision_output)
+                                          : PredCorr(vlasov, poisson, single_precision_output);
+
+        // The X2DSplit and the XY2DSplitVxVyXY layouts distribute the same blocks
+        run_simulation(
+                predcorr,
+                idxrange_spvxvyxy_xy2Dsplit,
+                [&](auto fdistribu, auto fdistribu_x2D_split) {
+                    transpose_layout(
+                            Kokkos::DefaultExecutionSpace(),
+                            fdistribu,
+                            fdistribu_x2D_split);
+                });
+    }
 
     steady_clock::time_point const end = steady_clock::now();
 
@@ -186,6 +348,7 @@ int main(int argc, char** argv)
 
     PC_tree_destroy(&conf_pdi);
 
+    finalise_region_profiling();
     PDI_finalize();
 
     MPI_Finalize();
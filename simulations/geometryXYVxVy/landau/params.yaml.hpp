@@ -28,7 +28,14 @@ SpeciesInfo:
 Algorithm:
   deltat: 0.12
   nbiter: 140
+  single_precision_fdistribu: false
+  fused_predictor: false
+  splitting: strang
+  parallel_mode: transpose
 
 Output:
   time_diag: 0.24
+  fdistribu_output_profile: raw
+  fdistribu_deflate_level: 4
+  single_precision_output: false
 )PDI_CFG";
@@ -10,6 +10,9 @@ metadata:
   iter : int
   time_saved : double
   nbstep_diag: int
+  fdistribu_compressed: int
+  fdistribu_deflate_level: int
+  single_precision_output: int
   iter_saved : int
   MeshX_extents: { type: array, subtype: int64, size: 1 }
   MeshX:
@@ -51,6 +54,8 @@ metadata:
   #-- Parallel data
   local_fdistribu_starts: { type: array, subtype: size_t, size: 5 }
   local_fdistribu_extents: { type: array, subtype: size_t, size: 5 }
+  local_potential_starts: { type: array, subtype: size_t, size: 2 }
+  local_potential_extents: { type: array, subtype: size_t, size: 2 }
 
 
 data:
@@ -58,12 +63,75 @@ data:
     type: array
     subtype: double
     size: [ '$local_fdistribu_extents[0]', '$local_fdistribu_extents[1]', '$local_fdistribu_extents[2]', '$local_fdistribu_extents[3]', '$local_fdistribu_extents[4]' ]
+  fdistribu_float:
+    type: array
+    subtype: float
+    size: [ '$local_fdistribu_extents[0]', '$local_fdistribu_extents[1]', '$local_fdistribu_extents[2]', '$local_fdistribu_extents[3]', '$local_fdistribu_extents[4]' ]
   electrostatic_potential_extents: { type: array, subtype: int64, size: 2 }
   electrostatic_potential:
     type: array
     subtype: double
     size: [ '$electrostatic_potential_extents[0]', '$electrostatic_potential_extents[1]' ]
 
+  #-- Region profiling (see finalise_region_profiling)
+  region_profiling_rank: int
+  region_profiling_step: int
+  region_profiling_step_names_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_step_names:
+    type: array
+    subtype: char
+    size: [ '$region_profiling_step_names_extents[0]' ]
+  region_profiling_step_times_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_step_times:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_step_times_extents[0]' ]
+  region_profiling_names_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_names:
+    type: array
+    subtype: char
+    size: [ '$region_profiling_names_extents[0]' ]
+  region_profiling_calls_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_calls:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_calls_extents[0]' ]
+  region_profiling_inclusive_min_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_inclusive_min:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_inclusive_min_extents[0]' ]
+  region_profiling_inclusive_max_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_inclusive_max:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_inclusive_max_extents[0]' ]
+  region_profiling_inclusive_mean_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_inclusive_mean:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_inclusive_mean_extents[0]' ]
+  region_profiling_exclusive_min_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_exclusive_min:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_exclusive_min_extents[0]' ]
+  region_profiling_exclusive_max_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_exclusive_max:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_exclusive_max_extents[0]' ]
+  region_profiling_exclusive_mean_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_exclusive_mean:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_exclusive_mean_extents[0]' ]
+  region_profiling_bytes_extents: { type: array, subtype: int64, size: 1 }
+  region_profiling_bytes:
+    type: array
+    subtype: double
+    size: [ '$region_profiling_bytes_extents[0]' ]
+
 plugins:
   mpi:
   set_value:
@@ -86,17 +154,99 @@ plugins:
       on_event: [iteration, last_iteration]
       when: '${iter} % ${nbstep_diag} = 0'
       collision_policy: replace_and_warn
+      datasets:
+        electrostatic_potential:
+          type: array
+          subtype: double
+          size: [ '$MeshX_extents[0]', '$MeshY_extents[0]' ]
+      write:
+        time_saved: ~
+        electrostatic_potential:
+          dataset_selection:
+            size: [ '$local_potential_extents[0]', '$local_potential_extents[1]' ]
+            start: [ '$local_potential_starts[0]', '$local_potential_starts[1]' ]
+    # The distribution function is written with the selected output profile and precision.
+    # The compressed profile uses one chunk per MPI rank.
+    - file: 'GYSELALIBXX_${iter_saved:05}.h5'
+      communicator: $MPI_COMM_WORLD
+      on_event: [iteration, last_iteration]
+      when: '${iter} % ${nbstep_diag} = 0 & ${fdistribu_compressed} = 0 & ${single_precision_output} = 0'
+      collision_policy: write_into
       datasets:
         fdistribu:
           type: array
           subtype: double
           size: [ '$Nkinspecies', '$MeshX_extents[0]', '$MeshY_extents[0]', '$MeshVx_extents[0]', '$MeshVy_extents[0]' ]
       write:
-        time_saved: ~
         fdistribu:
           dataset_selection:
             size: [ '$local_fdistribu_extents[0]', '$local_fdistribu_extents[1]', '$local_fdistribu_extents[2]', '$local_fdistribu_extents[3]', '$local_fdistribu_extents[4]' ]
             start: [ '$local_fdistribu_starts[0]', '$local_fdistribu_starts[1]', '$local_fdistribu_starts[2]', '$local_fdistribu_starts[3]', '$local_fdistribu_starts[4]' ]
-        electrostatic_potential: ~
+    - file: 'GYSELALIBXX_${iter_saved:05}.h5'
+      communicator: $MPI_COMM_WORLD
+      on_event: [iteration, last_iteration]
+      when: '${iter} % ${nbstep_diag} = 0 & ${fdistribu_compressed} = 0 & ${single_precision_output} = 1'
+      collision_policy: write_into
+      datasets:
+        fdistribu:
+          type: array
+          subtype: float
+          size: [ '$Nkinspecies', '$MeshX_extents[0]', '$MeshY_extents[0]', '$MeshVx_extents[0]', '$MeshVy_extents[0]' ]
+      write:
+        fdistribu_float:
+          dataset: fdistribu
+          dataset_selection:
+            size: [ '$local_fdistribu_extents[0]', '$local_fdistribu_extents[1]', '$local_fdistribu_extents[2]', '$local_fdistribu_extents[3]', '$local_fdistribu_extents[4]' ]
+            start: [ '$local_fdistribu_starts[0]', '$local_fdistribu_starts[1]', '$local_fdistribu_starts[2]', '$local_fdistribu_starts[3]', '$local_fdistribu_starts[4]' ]
+    - file: 'GYSELALIBXX_${iter_saved:05}.h5'
+      communicator: $MPI_COMM_WORLD
+      on_event: [iteration, last_iteration]
+      when: '${iter} % ${nbstep_diag} = 0 & ${fdistribu_compressed} = 1 & ${single_precision_output} = 0'
+      collision_policy: write_into
+      datasets:
+        fdistribu:
+          type: array
+          subtype: double
+          size: [ '$Nkinspecies', '$MeshX_extents[0]', '$MeshY_extents[0]', '$MeshVx_extents[0]', '$MeshVy_extents[0]' ]
+          chunking: [ '$local_fdistribu_extents[0]', '$local_fdistribu_extents[1]', '$local_fdistribu_extents[2]', '$local_fdistribu_extents[3]', '$local_fdistribu_extents[4]' ]
+          deflate: '$fdistribu_deflate_level'
+      write:
+        fdistribu:
+          dataset_selection:
+            size: [ '$local_fdistribu_extents[0]', '$local_fdistribu_extents[1]', '$local_fdistribu_extents[2]', '$local_fdistribu_extents[3]', '$local_fdistribu_extents[4]' ]
+            start: [ '$local_fdistribu_starts[0]', '$local_fdistribu_starts[1]', '$local_fdistribu_starts[2]', '$local_fdistribu_starts[3]', '$local_fdistribu_starts[4]' ]
+    - file: 'GYSELALIBXX_${iter_saved:05}.h5'
+      communicator: $MPI_COMM_WORLD
+      on_event: [iteration, last_iteration]
+      when: '${iter} % ${nbstep_diag} = 0 & ${fdistribu_compressed} = 1 & ${single_precision_output} = 1'
+      collision_policy: write_into
+      datasets:
+        fdistribu:
+          type: array
+          subtype: float
+          size: [ '$Nkinspecies', '$MeshX_extents[0]', '$MeshY_extents[0]', '$MeshVx_extents[0]', '$MeshVy_extents[0]' ]
+          chunking: [ '$local_fdistribu_extents[0]', '$local_fdistribu_extents[1]', '$local_fdistribu_extents[2]', '$local_fdistribu_extents[3]', '$local_fdistribu_extents[4]' ]
+          deflate: '$fdistribu_deflate_level'
+      write:
+        fdistribu_float:
+          dataset: fdistribu
+          dataset_selection:
+            size: [ '$local_fdistribu_extents[0]', '$local_fdistribu_extents[1]', '$local_fdistribu_extents[2]', '$local_fdistribu_extents[3]', '$local_fdistribu_extents[4]' ]
+            start: [ '$local_fdistribu_starts[0]', '$local_fdistribu_starts[1]', '$local_fdistribu_starts[2]', '$local_fdistribu_starts[3]', '$local_fdistribu_starts[4]' ]
+    # The region profiling summary is identical on all ranks, it is only written by rank 0
+    - file: 'GYSELALIBXX_region_profiling.h5'
+      on_event: region_profiling_summary
+      when: '${region_profiling_rank} = 0'
+      collision_policy: replace_and_warn
+      write: [region_profiling_names, region_profiling_calls, region_profiling_inclusive_min, region_profiling_inclusive_max, region_profiling_inclusive_mean, region_profiling_exclusive_min, region_profiling_exclusive_max, region_profiling_exclusive_mean, region_profiling_bytes]
+    # The timings of each iteration are only exposed if GSLX_REGION_PROFILING_STREAM=1
+    - file: 'GYSELALIBXX_region_profiling_rank${region_profiling_rank:05}.h5'
+      on_event: region_profiling_iteration
+      collision_policy: write_into
+      write:
+        region_profiling_step_names:
+          dataset: 'step_${region_profiling_step:06}/names'
+        region_profiling_step_times:
+          dataset: 'step_${region_profiling_step:06}/times'
   #trace: ~
 )PDI_CFG";
@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <cassert>
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/splines.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "ddc_helper.hpp"
+#include "euler.hpp"
+#include "itimestepper.hpp"
+#include "vector_field.hpp"
+#include "vector_field_mem.hpp"
+
+
+/**
+ * @brief A class which computes the advection on a 2D Cartesian plane without splitting.
+ *
+ * This operator solves the following equation type
+ *
+ * @f$ \partial_t f(t,x) + A(t, x) \cdot \nabla_{x_1, x_2} f(t, x) = 0, \qquad x\in \Omega @f$
+ *
+ * with
+ *
+ *  * @f$ f @f$, a function defined on a domain @f$ \Omega @f$ containing the
+ *    @f$ (x_1, x_2) @f$ plane, possibly batched over other dimensions;
+ *  * @f$ A = (A_1, A_2) @f$, an advection field defined on @f$ \Omega @f$.
+ *
+ * The function and the two components of the advection field are each represented by a
+ * single 2D tensor-product spline. The 2D characteristic equation is solved with a time
+ * integration method (ITimeStepper) and the function is evaluated once at the 2D feet.
+ * Compared to a Strang splitting made of three 1D advections, this builds one spline of
+ * the function instead of three and does not introduce a splitting error.
+ *
+ * @tparam IdxRangeFunction
+ *          The index range of @f$ \Omega @f$ where allfdistribu and the advection
+ *          field are defined.
+ * @tparam Builder2D
+ *          The type of the 2D spline builder on the advection plane (see ddc::SplineBuilder2D).
+ *          It must not require derivatives at the boundaries.
+ * @tparam Evaluator2D
+ *          The type of the 2D spline evaluator on the advection plane
+ *          (see ddc::SplineEvaluator2D).
+ * @tparam TimeStepperBuilder
+ *          A time stepper builder indicating which time integration method should be
+ *          applied to solve the characteristic equation.
+ */
+template <
+        class IdxRangeFunction,
+        class Builder2D,
+        class Evaluator2D,
+        class TimeStepperBuilder = EulerBuilder>
+class BslAdvection2D
+{
+    static_assert(is_timestepper_builder_v<TimeStepperBuilder>);
+    static_assert(std::is_same_v<
+                  typename Builder2D::memory_space,
+                  typename Evaluator2D::memory_space>);
+    static_assert(
+            Builder2D::builder_type1::s_nbe_xmin == 0 && Builder2D::builder_type1::s_nbe_xmax == 0
+                    && Builder2D::builder_type2::s_nbe_xmin == 0
+                    && Builder2D::builder_type2::s_nbe_xmax == 0,
+            "This class is designed to work with a spline builder which does not require "
+            "additional information at the boundaries (e.g. Hermite boundary conditions require "
+            "information about the derivatives and therefore will not work with this class).");
+
+private:
+    using Dim1 = typename Builder2D::continuous_dimension_type1;
+    using Dim2 = typename Builder2D::continuous_dimension_type2;
+    using Grid1 = typename Builder2D::interpolation_discrete_dimension_type1;
+    using Grid2 = typename Builder2D::interpolation_discrete_dimension_type2;
+
+    using ExecSpace = typename Builder2D::exec_space;
+    using MemorySpace = typename Builder2D::memory_space;
+
+    // Advection plane:
+    using IdxAdvection = Idx<Grid1, Grid2>;
+    using CoordAdvection = Coord<Dim1, Dim2>;
+    using VectorIndexSetAdvection = VectorIndexSet<Dim1, Dim2>;
+
+    // Full index range and batch dimensions:
+    using IdxFunction = typename IdxRangeFunction::discrete_element_type;
+    using IdxRangeBatch = ddc::remove_dims_of_t<IdxRangeFunction, Grid1, Grid2>;
+    using IdxBatch = typename IdxRangeBatch::discrete_element_type;
+
+    using FunctionField = DField<IdxRangeFunction, MemorySpace>;
+    using AdvectionConstField
+            = DVectorConstField<IdxRangeFunction, VectorIndexSetAdvection, MemorySpace>;
+
+    // Type for the spline representations of the function and the advection field
+    using IdxRangeBS = typename Builder2D::template batched_spline_domain_type<IdxRangeFunction>;
+    using SplineCoeffsMem = DFieldMem<IdxRangeBS, MemorySpace>;
+    using SplineCoeffsConstField = DConstField<IdxRangeBS, MemorySpace>;
+    using AdvecFieldSplineMem = DVectorFieldMem<IdxRangeBS, VectorIndexSetAdvection, MemorySpace>;
+    using AdvecFieldSplineCoeffs = DVectorField<IdxRangeBS, VectorIndexSetAdvection, MemorySpace>;
+
+    using TimeStepper = typename TimeStepperBuilder::
+            template time_stepper_t<CoordAdvection, DVector<Dim1, Dim2>>;
+
+    Builder2D const& m_builder;
+    Evaluator2D const& m_evaluator;
+
+    TimeStepperBuilder const& m_time_stepper_builder;
+
+public:
+    /**
+     * @brief Instantiate an advection operator.
+     *
+     * @param[in] builder 2D spline builder used to build the spline representations of the
+     *          advected function and of the advection field.
+     * @param[in] evaluator 2D spline evaluator used to evaluate the advection field along the
+     *          characteristics and the advected function at the characteristic feet.
+     * @param[in] time_stepper_builder A builder for the time integration method used
+     *          for the characteristic equation.
+     */
+    explicit BslAdvection2D(
+            Builder2D const& builder,
+            Evaluator2D const& evaluator,
+            TimeStepperBuilder const& time_stepper_builder)
+        : m_builder(builder)
+        , m_evaluator(evaluator)
+        , m_time_stepper_builder(time_stepper_builder)
+    {
+    }
+
+    ~BslAdvection2D() = default;
+
+    /**
+     * @brief Advects allfdistribu on the (Dim1, Dim2) plane for a duration dt.
+     *
+     * @param[in, out] allfdistribu Reference to the advected function, allocated on the device.
+     * @param[in] advection_field Reference to the advection field, allocated on the device.
+     * @param[in] dt Time step.
+     *
+     * @return A reference to the allfdistribu array after advection on dt.
+     */
+    FunctionField operator()(
+            FunctionField const allfdistribu,
+            AdvectionConstField const advection_field,
+            double const dt) const
+    {
+        Kokkos::Profiling::pushRegion("(GSLX) BslAdvection2D");
+        IdxRangeFunction const idx_range = get_idx_range(allfdistribu);
+        assert(get_idx_range(advection_field) == idx_range);
+
+        // Build the spline representations ......................................................
+        AdvecFieldSplineMem advection_field_coefs_alloc(
+                "advection_field_coefs (BslAdvection2D::operator())",
+                m_builder.batched_spline_domain(idx_range));
+        AdvecFieldSplineCoeffs advection_field_coefs = get_field(advection_field_coefs_alloc);
+        m_builder(
+                ddcHelper::get<Dim1>(advection_field_coefs),
+                ddcHelper::get<Dim1>(advection_field));
+        m_builder(
+                ddcHelper::get<Dim2>(advection_field_coefs),
+                ddcHelper::get<Dim2>(advection_field));
+        SplineCoeffsConstField advection_field_coefs_1
+                = get_const_field(ddcHelper::get<Dim1>(advection_field_coefs));
+        SplineCoeffsConstField advection_field_coefs_2
+                = get_const_field(ddcHelper::get<Dim2>(advection_field_coefs));
+
+        SplineCoeffsMem function_coefs_alloc(
+                "function_coefs (BslAdvection2D::operator())",
+                m_builder.batched_spline_domain(idx_range));
+        m_builder(get_field(function_coefs_alloc), get_const_field(allfdistribu));
+        SplineCoeffsConstField function_coefs = get_const_field(function_coefs_alloc);
+
+        // Compute the characteristic feet and evaluate the function .............................
+        TimeStepper time_stepper = m_time_stepper_builder.template preallocate<TimeStepper>();
+
+        Evaluator2D const& evaluator_proxy = m_evaluator;
+        const std::source_location location = std::source_location::current();
+        ddc::parallel_for_each(
+                location.function_name(),
+                ExecSpace(),
+                idx_range,
+                KOKKOS_LAMBDA(IdxFunction const idx) {
+                    IdxBatch const idx_batch(idx);
+                    CoordAdvection foot = ddc::coordinate(IdxAdvection(idx));
+
+                    // Solve the characteristic equation with a time integration method
+                    time_stepper
+                            .update(foot,
+                                    -dt,
+                                    [&](DVector<Dim1, Dim2>& updated_advection_field,
+                                        CoordAdvection const& foot) {
+                                        ddcHelper::get<Dim1>(updated_advection_field)
+                                                = evaluator_proxy(
+                                                        foot,
+                                                        advection_field_coefs_1[idx_batch]);
+                                        ddcHelper::get<Dim2>(updated_advection_field)
+                                                = evaluator_proxy(
+                                                        foot,
+                                                        advection_field_coefs_2[idx_batch]);
+                                    });
+                    allfdistribu(idx) = evaluator_proxy(foot, function_coefs[idx_batch]);
+                });
+
+        Kokkos::Profiling::popRegion();
+        return allfdistribu;
+    }
+};
@@ -102,6 +102,9 @@ class BslAdvectionPolar
             = DVectorFieldMem<IdxRangeBatch, CartesianBasis, MemorySpace>;
     using DVectorFieldAdvectionXYOnBatch = DVectorField<IdxRangeBatch, CartesianBasis, MemorySpace>;
 
+    using DVectorConstFieldAdvectionXYOnRTheta
+            = DVectorConstField<IdxRangeRTheta, CartesianBasis, MemorySpace>;
+
     using DVectorFieldAdvectionRTheta
             = DVectorField<IdxRangeBatched, CurvilinearBasis, MemorySpace>;
     using DVectorConstFieldAdvectionRTheta
@@ -116,6 +119,13 @@ private:
 
     LogicalToPhysicalMapping const& m_logical_to_physical_mapping;
 
+private:
+    /// Get the index range containing only the first index of each dimension.
+    template <class... Grids>
+    static IdxRange<Grids...> get_first_slice(IdxRange<Grids...> const idx_range)
+    {
+        return IdxRange<Grids...>(ddc::select<Grids>(idx_range).take_first(IdxStep<Grids>(1))...);
+    }
 
 public:
     /**
@@ -203,6 +213,91 @@ public:
         return allfdistribu;
     }
 
+    /**
+     * @brief Advect a batched function over a time step dt with an advection field
+     * along the physical directions which is identical for all the batch indices.
+     *
+     * The feet of the characteristics are only computed on one @f$(r, \theta)@f$ slice and
+     * are shared by all the slices of the function. The splines of all the slices are
+     * built in one batched call and evaluated at the shared feet in one kernel.
+     *
+     * @param [in, out] allfdistribu
+     *      A Field containing the values of the function we want to advect.
+     * @param [in] advection_field_xy
+     *      A field of vectors defined on the Cartesian basis containing the values
+     *      of the advection field at each point on the logical @f$(r, \theta)@f$ grid.
+     * @param [in] dt
+     *      A time step used.
+     *
+     * @return A Field to allfdistribu advected on the time step given.
+     */
+    DFieldFDistribu operator()(
+            DFieldFDistribu allfdistribu,
+            DVectorConstFieldAdvectionXYOnRTheta advection_field_xy,
+            double dt) const
+        requires(ddc::type_seq_size_v<ddc::to_type_seq_t<IdxRangeBatch>> > 0)
+    {
+        IdxRangeBatched const idx_range(get_idx_range(allfdistribu));
+        IdxRangeRTheta const idx_range_rtheta(idx_range);
+        IdxRangeBatched const idx_range_slice(
+                idx_range_rtheta,
+                get_first_slice(IdxRangeBatch(idx_range)));
+        IdxBatch const idx_batch_slice(IdxRangeBatch(idx_range_slice).front());
+        assert(get_idx_range(advection_field_xy) == idx_range_rtheta);
+
+        // Pre-allocate spline coefficient storage
+        DFieldMem<IdxRangeBSRTheta, MemorySpace> coefs_alloc(
+                m_builder_2d.batched_spline_domain(idx_range));
+        DConstField<IdxRangeBSRTheta, MemorySpace> coefs = get_const_field(coefs_alloc);
+
+        // Initialise the feet and the advection field on a single slice
+        DVectorFieldMemAdvectionXY advection_field_slice_alloc(
+                "advection_field_xy (BslAdvectionPolar::operator())",
+                idx_range_slice);
+        DVectorFieldAdvectionXY advection_field_slice = get_field(advection_field_slice_alloc);
+        CFieldMemFeetRTheta feet_rtheta_alloc(
+                "feet_rtheta (BslAdvectionPolar::operator())",
+                idx_range_slice);
+        CFieldFeetRTheta feet_rtheta = get_field(feet_rtheta_alloc);
+        const std::source_location location = std::source_location::current();
+        ddc::parallel_for_each(
+                location.function_name(),
+                ExecSpace(),
+                idx_range_slice,
+                KOKKOS_LAMBDA(IdxBatched const idx) {
+                    IdxRTheta const irtheta(idx);
+                    feet_rtheta(idx) = ddc::coordinate(irtheta);
+                    ddcHelper::get<DimX>(advection_field_slice)(idx)
+                            = ddcHelper::get<DimX>(advection_field_xy)(irtheta);
+                    ddcHelper::get<DimY>(advection_field_slice)(idx)
+                            = ddcHelper::get<DimY>(advection_field_xy)(irtheta);
+                });
+
+        // Compute the feet of the characteristics at tn -----------------------------------------
+        Kokkos::Profiling::pushRegion("(GSLX) BslAdvectionPolar/FootFinder");
+        m_find_feet(feet_rtheta, get_const_field(advection_field_slice), dt);
+        Kokkos::Profiling::popRegion();
+
+        // Interpolate all the slices on the shared feet of the characteristics. -----------------
+        Kokkos::Profiling::pushRegion("(GSLX) BslAdvectionPolar/Interpolation");
+        m_builder_2d(get_field(coefs_alloc), get_const_field(allfdistribu));
+        Evaluator2D const& evaluator_proxy = m_evaluator_2d;
+        ddc::parallel_for_each(
+                location.function_name(),
+                ExecSpace(),
+                idx_range,
+                KOKKOS_LAMBDA(IdxBatched const idx) {
+                    IdxBatch const idx_batch(idx);
+                    IdxRTheta const irtheta(idx);
+                    allfdistribu(idx) = evaluator_proxy(
+                            feet_rtheta(irtheta, idx_batch_slice),
+                            coefs[idx_batch]);
+                });
+        Kokkos::Profiling::popRegion();
+
+        return allfdistribu;
+    }
+
 
     /**
      * @brief Advect a function over a time step dt with the given advection field
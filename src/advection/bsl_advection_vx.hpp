@@ -33,12 +33,10 @@ class BslAdvectionVelocity
     using IdxSpatial = typename IdxRangeSpatial::discrete_element_type;
     using IdxV = Idx<GridV>;
     using DimV = typename GridV::continuous_dimension_type;
-    using IdxRangeSpaceVelocity
-            = ddc::remove_dims_of_t<typename Geometry::IdxRangeFdistribu, Species>;
 
 private:
     using IdxRangeFunctionBasis = typename InterpolationBuilderTraits<
-            FunctionBuilder>::template batched_basis_idx_range_type<IdxRangeSpaceVelocity>;
+            FunctionBuilder>::template batched_basis_idx_range_type<IdxRangeFdistribu>;
 
     FunctionBuilder const& m_function_builder;
     FunctionEvaluator const& m_function_evaluator;
@@ -84,54 +82,48 @@ public:
             ConstField<DataType, IdxRangeSpatial> const electric_field,
             DataType const dt) const override
     {
-        using IdxRangeBatch = ddc::remove_dims_of_t<IdxRangeFdistribu, Species, GridV>;
+        using IdxRangeBatch = ddc::remove_dims_of_t<IdxRangeFdistribu, GridV>;
         using IdxBatch = typename IdxRangeBatch::discrete_element_type;
 
 
         Kokkos::Profiling::pushRegion("(GSLX) BslAdvectionVelocity");
         IdxRangeFdistribu const idx_range = get_idx_range(allfdistribu);
         IdxRange<GridV> const idx_range_v = ddc::select<GridV>(idx_range);
-        IdxRange<Species> const idx_range_sp = ddc::select<Species>(idx_range);
 
-        IdxRangeSpaceVelocity batched_feet_idx_range(idx_range);
-
-        // pre-allocate some memory to prevent allocation later in loop
-        FieldMem<Coord<DimV>, IdxRangeSpaceVelocity> feet_coords_alloc(
+        // All the species are advected together so the memory is allocated for all of them
+        FieldMem<Coord<DimV>, IdxRangeFdistribu> feet_coords_alloc(
                 "feet_coords (BslAdvectionVelocity::operator())",
-                batched_feet_idx_range);
-        Field<Coord<DimV>, IdxRangeSpaceVelocity> feet_coords(get_field(feet_coords_alloc));
+                idx_range);
+        Field<Coord<DimV>, IdxRangeFdistribu> feet_coords(get_field(feet_coords_alloc));
         DFieldMem<IdxRangeFunctionBasis> function_coefs_alloc(
                 "function_coefs (BslAdvectionVelocity::operator())",
-                batched_basis_idx_range(m_function_builder, batched_feet_idx_range));
+                batched_basis_idx_range(m_function_builder, idx_range));
 
         IdxRangeBatch batch_idx_range(idx_range);
 
-        ddc::host_for_each(idx_range_sp, [&](IdxSp const isp) {
-            DataType const charge_proxy
-                    = charge(isp); // TODO: consider proper way to access charge from device
-            DataType const sqrt_me_on_mspecies = std::sqrt(mass(ielec()) / mass(isp));
-            const std::source_location location = std::source_location::current();
-            ddc::parallel_for_each(
-                    location.function_name(),
-                    Kokkos::DefaultExecutionSpace(),
-                    batch_idx_range,
-                    KOKKOS_LAMBDA(IdxBatch const ib) {
-                        IdxSpatial const ix(ib);
-                        // compute the displacement
-                        DataType const dvx
-                                = charge_proxy * sqrt_me_on_mspecies * dt * electric_field(ix);
-
-                        // compute the coordinates of the feet
-                        for (IdxV const iv : idx_range_v) {
-                            feet_coords(iv, ib) = Coord<DimV>(ddc::coordinate(iv) - dvx);
-                        }
-                    });
-            m_function_builder(get_field(function_coefs_alloc), get_const_field(allfdistribu[isp]));
-            m_function_evaluator(
-                    allfdistribu[isp],
-                    get_const_field(feet_coords),
-                    get_const_field(function_coefs_alloc));
-        });
+        const std::source_location location = std::source_location::current();
+        ddc::parallel_for_each(
+                location.function_name(),
+                Kokkos::DefaultExecutionSpace(),
+                batch_idx_range,
+                KOKKOS_LAMBDA(IdxBatch const ib) {
+                    IdxSp const isp(ib);
+                    IdxSpatial const ix(ib);
+                    // compute the displacement
+                    DataType const charge_isp = charge(isp);
+                    DataType const sqrt_me_on_mspecies = sqrt_me_on_mass(isp);
+                    DataType const dvx = charge_isp * sqrt_me_on_mspecies * dt * electric_field(ix);
+
+                    // compute the coordinates of the feet
+                    for (IdxV const iv : idx_range_v) {
+                        feet_coords(iv, ib) = Coord<DimV>(ddc::coordinate(iv) - dvx);
+                    }
+                });
+        m_function_builder(get_field(function_coefs_alloc), get_const_field(allfdistribu));
+        m_function_evaluator(
+                allfdistribu,
+                get_const_field(feet_coords),
+                get_const_field(function_coefs_alloc));
 
         Kokkos::Profiling::popRegion();
         return allfdistribu;
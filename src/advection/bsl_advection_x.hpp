@@ -8,6 +8,7 @@
 #include "ddc_aliases.hpp"
 #include "i_interpolation.hpp"
 #include "iadvectionx.hpp"
+#include "quadrature.hpp"
 #include "species_info.hpp"
 
 /**
@@ -35,6 +36,8 @@ class BslAdvectionSpatial
     using DimV = typename GridV::continuous_dimension_type;
     using IdxRangeSpaceVelocity
             = ddc::remove_dims_of_t<typename Geometry::IdxRangeFdistribu, Species>;
+    using IdxRangeSpatial = typename Geometry::IdxRangeSpatial;
+    using IdxRangeVelocity = typename Geometry::IdxRangeVelocity;
 
 private:
     using IdxRangeFunctionBasis = typename InterpolationBuilderTraits<
@@ -103,7 +106,7 @@ public:
         IdxRangeBatch batch_idx_range(idx_range);
 
         for (IdxSp const isp : sp_idx_range) {
-            DataType const sqrt_me_on_mspecies = std::sqrt(mass(ielec()) / mass(isp));
+            DataType const sqrt_me_on_mspecies = sqrt_me_on_mass(isp);
             const std::source_location location = std::source_location::current();
             ddc::parallel_for_each(
                     location.function_name(),
@@ -130,4 +133,77 @@ public:
         Kokkos::Profiling::popRegion();
         return allfdistribu;
     }
+
+    /**
+     * @brief Computes the charge density of fdistribu advected along GridX for a duration dt.
+     *
+     * The interpolation representation of each species is built as in operator() but,
+     * instead of being written back to allfdistribu, the values at the characteristic feet
+     * are directly multiplied by the quadrature coefficients and summed over the velocity
+     * space.
+     *
+     * @param[out] charge_density The charge density of the advected distribution function.
+     * @param[in] allfdistribu Reference to the whole distribution function before the
+     *          advection, allocated on the device.
+     * @param[in] quadrature_coeffs The coefficients of the quadrature over the velocity space.
+     * @param[in] dt Time step
+     * @return A reference to the charge density.
+     */
+    Field<DataType, IdxRangeSpatial> charge_density_after_transport(
+            Field<DataType, IdxRangeSpatial> const charge_density,
+            ConstField<DataType, IdxRangeFdistrib> const allfdistribu,
+            ConstField<DataType, IdxRangeVelocity> const quadrature_coeffs,
+            DataType const dt) const override
+    {
+        using IdxRangeBatch = ddc::remove_dims_of_t<IdxRangeFdistrib, Species, GridX>;
+        using IdxBatch = typename IdxRangeBatch::discrete_element_type;
+        using IdxSpaceVelocity = typename IdxRangeSpaceVelocity::discrete_element_type;
+        using IdxSpatial = typename IdxRangeSpatial::discrete_element_type;
+
+        Kokkos::Profiling::pushRegion("(GSLX) BslAdvectionSpatial");
+        IdxRangeFdistrib const idx_range = get_idx_range(allfdistribu);
+        IdxRange<Species> const sp_idx_range = ddc::select<Species>(idx_range);
+        IdxRangeSpatial const spatial_idx_range = get_idx_range(charge_density);
+
+        IdxRangeSpaceVelocity const space_velocity_idx_range(idx_range);
+        DFieldMem<IdxRangeFunctionBasis> function_coefs_alloc(
+                "function_coefs (BslAdvectionSpatial::charge_density_after_transport())",
+                batched_basis_idx_range(m_function_builder, space_velocity_idx_range));
+        DFieldMem<IdxRangeSpatial> density_alloc(
+                "density (BslAdvectionSpatial::charge_density_after_transport())",
+                spatial_idx_range);
+        DConstField<IdxRangeFunctionBasis> function_coefs = get_const_field(function_coefs_alloc);
+        DField<IdxRangeSpatial> density = get_field(density_alloc);
+
+        Quadrature<IdxRangeVelocity, IdxRangeSpaceVelocity> const integrate_v(quadrature_coeffs);
+        FunctionEvaluator const& function_evaluator_proxy = m_function_evaluator;
+
+        ddc::parallel_fill(charge_density, 0.0);
+
+        for (IdxSp const isp : sp_idx_range) {
+            DataType const sqrt_me_on_mspecies = sqrt_me_on_mass(isp);
+            DataType const charge_isp = charge(isp);
+            m_function_builder(get_field(function_coefs_alloc), allfdistribu[isp]);
+            // Evaluate the function at the feet and integrate over the velocity space
+            integrate_v(
+                    Kokkos::DefaultExecutionSpace(),
+                    density,
+                    KOKKOS_LAMBDA(IdxSpaceVelocity const idx) {
+                        DataType const dx = sqrt_me_on_mspecies * dt * ddc::coordinate(IdxV(idx));
+                        Coord<DimX> const foot(ddc::coordinate(IdxX(idx)) - dx);
+                        return function_evaluator_proxy(foot, function_coefs[IdxBatch(idx)]);
+                    });
+            const std::source_location location = std::source_location::current();
+            ddc::parallel_for_each(
+                    location.function_name(),
+                    Kokkos::DefaultExecutionSpace(),
+                    spatial_idx_range,
+                    KOKKOS_LAMBDA(IdxSpatial const ispace) {
+                        charge_density(ispace) += charge_isp * density(ispace);
+                    });
+        }
+
+        Kokkos::Profiling::popRegion();
+        return charge_density;
+    }
 };
@@ -27,4 +27,28 @@ public:
     virtual Field<DataType, typename Geometry::IdxRangeFdistribu> operator()(
             Field<DataType, typename Geometry::IdxRangeFdistribu> allfdistribu,
             DataType dt) const = 0;
+
+    /**
+     * @brief Computes the charge density of the transported distribution function without
+     * storing the transported distribution function.
+     *
+     * The distribution function is transported along GridX for a duration dt and the result
+     * is integrated over the velocity space in the same kernel which evaluates it at the
+     * feet of the characteristics:
+     * @f$ \rho(x) = \sum_s q_s \int f_s(x - v dt, v) dv @f$.
+     * If the velocity space is distributed over MPI ranks then only the contribution of
+     * the local velocities is computed.
+     *
+     * @param[out] charge_density The charge density of the transported distribution function.
+     * @param[in] allfdistribu The distribution function before the transport. It is not modified.
+     * @param[in] quadrature_coeffs The coefficients of the quadrature over the velocity space.
+     * @param[in] dt time step.
+     *
+     * @return A reference to the charge density.
+     */
+    virtual Field<DataType, typename Geometry::IdxRangeSpatial> charge_density_after_transport(
+            Field<DataType, typename Geometry::IdxRangeSpatial> charge_density,
+            ConstField<DataType, typename Geometry::IdxRangeFdistribu> allfdistribu,
+            ConstField<DataType, typename Geometry::IdxRangeVelocity> quadrature_coeffs,
+            DataType dt) const = 0;
 };
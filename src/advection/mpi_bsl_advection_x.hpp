@@ -0,0 +1,286 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "iadvectionx.hpp"
+#include "mpihaloexchange.hpp"
+#include "quadrature.hpp"
+#include "species_info.hpp"
+
+/**
+ * @brief A class which computes the spatial advection along the dimension of interest GridX
+ * when GridX is distributed across MPI ranks.
+ *
+ * Each rank only owns a block of GridX. The distribution function is interpolated locally
+ * using Lagrange polynomials. The stencils of the Lagrange polynomials at the characteristic
+ * feet cover at most the local block extended by a halo whose width is the degree of the
+ * polynomials plus the largest displacement (in cells) of the characteristics. The halo is
+ * filled by an MPIHaloExchange before each advection.
+ *
+ * The Lagrange basis is defined on the halo-extended local grid. It must be initialised
+ * on each rank with init_halo_lagrange_basis. As this grid does not cover the whole periodic
+ * domain, the basis must be defined on a non-periodic dimension whose coordinates coincide
+ * with the coordinates of GridX.
+ *
+ * @tparam Geometry The geometry of the distribution function.
+ * @tparam GridX The spatial dimension along which the advection is carried out.
+ * @tparam FunctionEvaluator A LagrangeEvaluator defined on the halo-extended local grid.
+ * @tparam DataType The data type of the distribution function.
+ */
+template <class Geometry, class GridX, class FunctionEvaluator, class DataType = double>
+class MpiBslAdvectionSpatial : public IAdvectionSpatial<Geometry, GridX, DataType>
+{
+    static_assert(std::is_floating_point_v<DataType>);
+    static_assert(std::is_same_v<typename FunctionEvaluator::data_type, DataType>);
+    static_assert(!FunctionEvaluator::lagrange_basis_type::is_periodic());
+
+    using GridV = typename Geometry::template velocity_dim_for<GridX>;
+    using IdxRangeFdistrib = typename Geometry::IdxRangeFdistribu;
+    using IdxX = Idx<GridX>;
+    using IdxV = Idx<GridV>;
+    using DimXHalo = typename FunctionEvaluator::continuous_dimension_type;
+    using KnotGrid = typename FunctionEvaluator::coeff_grid_type;
+    using IdxRangeSpaceVelocity
+            = ddc::remove_dims_of_t<typename Geometry::IdxRangeFdistribu, Species>;
+    using IdxRangeSpatial = typename Geometry::IdxRangeSpatial;
+    using IdxRangeVelocity = typename Geometry::IdxRangeVelocity;
+
+public:
+    /// The type of the operator which fills the halo.
+    using halo_exchange_type = MPIHaloExchange<GridX, KnotGrid>;
+
+private:
+    using IdxRangeFdistribHalo =
+            typename halo_exchange_type::template halo_idx_range_type<IdxRangeFdistrib>;
+
+    halo_exchange_type const& m_halo_exchange;
+    FunctionEvaluator const& m_function_evaluator;
+
+public:
+    /**
+     * @brief Constructor
+     * @param[in] halo_exchange The operator which fills the halo along GridX.
+     * @param[in] function_evaluator Evaluator of the Lagrange polynomials defined on the
+     *          halo-extended local grid.
+     */
+    MpiBslAdvectionSpatial(
+            halo_exchange_type const& halo_exchange,
+            FunctionEvaluator const& function_evaluator)
+        : m_halo_exchange(halo_exchange)
+        , m_function_evaluator(function_evaluator)
+    {
+    }
+
+    ~MpiBslAdvectionSpatial() override = default;
+
+    /**
+     * @brief Get the width of the halo required to advect the distribution function.
+     *
+     * @param[in] idx_range_x The index range of the grid along GridX.
+     * @param[in] idx_range_v The index range of the velocity grid associated with GridX.
+     * @param[in] max_dt The largest time step (in absolute value) used for an advection.
+     *
+     * @return The width of the halo.
+     */
+    static int get_required_halo_width(
+            IdxRange<GridX> idx_range_x,
+            IdxRange<GridV> idx_range_v,
+            double max_dt)
+    {
+        double const dx = double(
+                ddc::coordinate(idx_range_x.front() + 1) - ddc::coordinate(idx_range_x.front()));
+        double const max_v = std::max(
+                std::abs(double(ddc::coordinate(idx_range_v.front()))),
+                std::abs(double(ddc::coordinate(idx_range_v.back()))));
+        double max_sqrt_me_on_mspecies = 0.0;
+        for (IdxSp const isp : get_idx_range(ddc::host_discrete_space<Species>().masses())) {
+            max_sqrt_me_on_mspecies
+                    = std::max(max_sqrt_me_on_mspecies, sqrt_me_on_mass(isp));
+        }
+        double const max_shift = max_sqrt_me_on_mspecies * max_v * std::abs(max_dt) / dx;
+        return FunctionEvaluator::lagrange_basis_type::degree()
+               + static_cast<int>(std::ceil(max_shift));
+    }
+
+    /**
+     * @brief Advects fdistribu along GridX for a duration dt.
+     * @param[in, out] allfdistribu Reference to the local block of the distribution function, allocated on the device.
+     * @param[in] dt Time step
+     * @return A reference to the allfdistribu array containing the value of the function at the coordinates.
+     */
+    Field<DataType, IdxRangeFdistrib> operator()(
+            Field<DataType, IdxRangeFdistrib> const allfdistribu,
+            DataType const dt) const override
+    {
+        using IdxRangeBatch = ddc::remove_dims_of_t<IdxRangeFdistrib, Species, GridX>;
+        using IdxBatch = typename IdxRangeBatch::discrete_element_type;
+        using IdxSpaceVelocity = typename IdxRangeSpaceVelocity::discrete_element_type;
+
+        Kokkos::Profiling::pushRegion("(GSLX) MpiBslAdvectionSpatial");
+        IdxRangeFdistrib const idx_range = get_idx_range(allfdistribu);
+        IdxRange<Species> const sp_idx_range = ddc::select<Species>(idx_range);
+        IdxRangeSpaceVelocity const space_velocity_idx_range(idx_range);
+        check_halo_width(idx_range, dt);
+
+        FieldMem<DataType, IdxRangeFdistribHalo> function_halo_alloc(
+                "function_halo (MpiBslAdvectionSpatial::operator())",
+                m_halo_exchange.get_halo_idx_range(idx_range));
+        m_halo_exchange(
+                Kokkos::DefaultExecutionSpace(),
+                get_field(function_halo_alloc),
+                get_const_field(allfdistribu));
+
+        FunctionEvaluator const& function_evaluator_proxy = m_function_evaluator;
+
+        for (IdxSp const isp : sp_idx_range) {
+            DataType const sqrt_me_on_mspecies = sqrt_me_on_mass(isp);
+            auto const function_halo = get_const_field(function_halo_alloc[isp]);
+            auto const fdistribu = allfdistribu[isp];
+            const std::source_location location = std::source_location::current();
+            ddc::parallel_for_each(
+                    location.function_name(),
+                    Kokkos::DefaultExecutionSpace(),
+                    space_velocity_idx_range,
+                    KOKKOS_LAMBDA(IdxSpaceVelocity const idx) {
+                        DataType const dx = sqrt_me_on_mspecies * dt * ddc::coordinate(IdxV(idx));
+                        Coord<DimXHalo> const foot(double(ddc::coordinate(IdxX(idx))) - dx);
+                        fdistribu(idx)
+                                = function_evaluator_proxy(foot, function_halo[IdxBatch(idx)]);
+                    });
+        }
+
+        Kokkos::Profiling::popRegion();
+        return allfdistribu;
+    }
+
+    /**
+     * @brief Computes the charge density of fdistribu advected along GridX for a duration dt.
+     *
+     * The halo is filled as in operator() but, instead of being written back to allfdistribu,
+     * the values at the characteristic feet are directly multiplied by the quadrature
+     * coefficients and summed over the velocity space.
+     *
+     * @param[out] charge_density The charge density of the advected distribution function
+     *          on the local spatial index range.
+     * @param[in] allfdistribu Reference to the local block of the distribution function before
+     *          the advection, allocated on the device.
+     * @param[in] quadrature_coeffs The coefficients of the quadrature over the velocity space.
+     * @param[in] dt Time step
+     * @return A reference to the charge density.
+     */
+    Field<DataType, IdxRangeSpatial> charge_density_after_transport(
+            Field<DataType, IdxRangeSpatial> const charge_density,
+            ConstField<DataType, IdxRangeFdistrib> const allfdistribu,
+            ConstField<DataType, IdxRangeVelocity> const quadrature_coeffs,
+            DataType const dt) const override
+    {
+        using IdxRangeBatch = ddc::remove_dims_of_t<IdxRangeFdistrib, Species, GridX>;
+        using IdxBatch = typename IdxRangeBatch::discrete_element_type;
+        using IdxSpaceVelocity = typename IdxRangeSpaceVelocity::discrete_element_type;
+        using IdxSpatial = typename IdxRangeSpatial::discrete_element_type;
+
+        Kokkos::Profiling::pushRegion("(GSLX) MpiBslAdvectionSpatial");
+        IdxRangeFdistrib const idx_range = get_idx_range(allfdistribu);
+        IdxRange<Species> const sp_idx_range = ddc::select<Species>(idx_range);
+        IdxRangeSpatial const spatial_idx_range = get_idx_range(charge_density);
+        check_halo_width(idx_range, dt);
+
+        FieldMem<DataType, IdxRangeFdistribHalo> function_halo_alloc(
+                "function_halo (MpiBslAdvectionSpatial::charge_density_after_transport())",
+                m_halo_exchange.get_halo_idx_range(idx_range));
+        DFieldMem<IdxRangeSpatial> density_alloc(
+                "density (MpiBslAdvectionSpatial::charge_density_after_transport())",
+                spatial_idx_range);
+        DField<IdxRangeSpatial> density = get_field(density_alloc);
+        m_halo_exchange(
+                Kokkos::DefaultExecutionSpace(),
+                get_field(function_halo_alloc),
+                allfdistribu);
+
+        Quadrature<IdxRangeVelocity, IdxRangeSpaceVelocity> const integrate_v(quadrature_coeffs);
+        FunctionEvaluator const& function_evaluator_proxy = m_function_evaluator;
+
+        ddc::parallel_fill(charge_density, 0.0);
+
+        for (IdxSp const isp : sp_idx_range) {
+            DataType const sqrt_me_on_mspecies = sqrt_me_on_mass(isp);
+            DataType const charge_isp = charge(isp);
+            auto const function_halo = get_const_field(function_halo_alloc[isp]);
+            // Evaluate the function at the feet and integrate over the velocity space
+            integrate_v(
+                    Kokkos::DefaultExecutionSpace(),
+                    density,
+                    KOKKOS_LAMBDA(IdxSpaceVelocity const idx) {
+                        DataType const dx = sqrt_me_on_mspecies * dt * ddc::coordinate(IdxV(idx));
+                        Coord<DimXHalo> const foot(double(ddc::coordinate(IdxX(idx))) - dx);
+                        return function_evaluator_proxy(foot, function_halo[IdxBatch(idx)]);
+                    });
+            const std::source_location location = std::source_location::current();
+            ddc::parallel_for_each(
+                    location.function_name(),
+                    Kokkos::DefaultExecutionSpace(),
+                    spatial_idx_range,
+                    KOKKOS_LAMBDA(IdxSpatial const ispace) {
+                        charge_density(ispace) += charge_isp * density(ispace);
+                    });
+        }
+
+        Kokkos::Profiling::popRegion();
+        return charge_density;
+    }
+
+private:
+    void check_halo_width(IdxRangeFdistrib idx_range, DataType dt) const
+    {
+        int const required_halo_width = get_required_halo_width(
+                ddc::select<GridX>(idx_range),
+                ddc::select<GridV>(idx_range),
+                dt);
+        if (required_halo_width > m_halo_exchange.get_halo_width()) {
+            std::ostringstream error_msg;
+            error_msg << "The halo is too narrow for the requested time step (a width of "
+                      << required_halo_width << " is required but the width is "
+                      << m_halo_exchange.get_halo_width() << ")";
+            throw std::runtime_error(error_msg.str());
+        }
+    }
+};
+
+/**
+ * @brief Initialise the Lagrange basis used by MpiBslAdvectionSpatial on the local grid
+ * extended by a halo.
+ *
+ * The grid GridXHalo and the Lagrange basis are defined on a non-periodic dimension
+ * whose coordinates coincide with the coordinates of GridX. This function must be called
+ * on each rank as the basis depends on the local index range.
+ *
+ * @tparam LagrangeBasis The uniform Lagrange basis on the halo-extended local grid.
+ * @tparam GridXHalo The uniform grid on which the basis is initialised.
+ * @param[in] local_idx_range_x The local index range along GridX.
+ * @param[in] halo_width The width of the halo.
+ */
+template <class LagrangeBasis, class GridXHalo, class GridX>
+void init_halo_lagrange_basis(IdxRange<GridX> local_idx_range_x, int halo_width)
+{
+    using DimXHalo = typename GridXHalo::continuous_dimension_type;
+    static_assert(!DimXHalo::PERIODIC);
+    double const dx = double(
+            ddc::coordinate(local_idx_range_x.front() + 1)
+            - ddc::coordinate(local_idx_range_x.front()));
+    Coord<DimXHalo> const halo_min(
+            double(ddc::coordinate(local_idx_range_x.front())) - halo_width * dx);
+    Coord<DimXHalo> const halo_max(
+            double(ddc::coordinate(local_idx_range_x.back())) + halo_width * dx);
+    IdxStep<GridXHalo> const halo_size(local_idx_range_x.size() + 2 * halo_width);
+    ddc::init_discrete_space<GridXHalo>(GridXHalo::init(halo_min, halo_max, halo_size));
+    ddc::init_discrete_space<LagrangeBasis>(
+            IdxRange<GridXHalo>(Idx<GridXHalo>(0), halo_size));
+}
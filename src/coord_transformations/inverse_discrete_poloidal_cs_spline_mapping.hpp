@@ -0,0 +1,555 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+#include <ddc/ddc.hpp>
+
+#include "coord_transformation_tools.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "discrete_poloidal_cs_spline_mapping.hpp"
+#include "tensor.hpp"
+#include "view.hpp"
+
+/**
+ * @brief A class describing the inverse of a DiscretePoloidalCSSplineMapping.
+ *
+ * The mapping @f$ (x,y) \mapsto (r,\theta) @f$ has no analytical expression. It is computed
+ * by solving @f$ F(r,\theta) = (x,y) @f$, with @f$ F @f$ the discrete mapping, using a damped
+ * Newton method:
+ *
+ * @f$ (r,\theta)^{k+1} = (r,\theta)^{k} + \alpha_k J^{-1}((r,\theta)^{k}) [(x,y) - F((r,\theta)^{k})] @f$,
+ *
+ * with @f$ J @f$ the Jacobian matrix of the discrete mapping and @f$ \alpha_k \in ]0,1] @f$ the
+ * largest damping coefficient of the form @f$ 2^{-n} @f$ which decreases the residual.
+ *
+ * The initial guess is read from a lookup table defined on a uniform Cartesian grid covering
+ * the physical domain. For each cell of this grid, the table contains the logical coordinate
+ * of the closest mapped point among a uniform sampling of the logical domain (see
+ * InverseDiscretePoloidalCSSplineMappingBuilder).
+ *
+ * This class does not own any memory. It should be created with an
+ * InverseDiscretePoloidalCSSplineMappingBuilder.
+ *
+ * @tparam DiscreteMapping The type of the DiscretePoloidalCSSplineMapping being inverted.
+ * @tparam MemorySpace The memory space where the lookup table is saved.
+ */
+template <class DiscreteMapping, class MemorySpace>
+class InverseDiscretePoloidalCSSplineMapping
+{
+public:
+    /// @brief Indicate the first physical coordinate.
+    using cartesian_tag_x = typename DiscreteMapping::cartesian_tag_x;
+    /// @brief Indicate the second physical coordinate.
+    using cartesian_tag_y = typename DiscreteMapping::cartesian_tag_y;
+    /// @brief Indicate the first logical coordinate.
+    using curvilinear_tag_r = typename DiscreteMapping::curvilinear_tag_r;
+    /// @brief Indicate the second logical coordinate.
+    using curvilinear_tag_theta = typename DiscreteMapping::curvilinear_tag_theta;
+
+    /// The type of the argument of the function described by this mapping
+    using CoordArg = Coord<cartesian_tag_x, cartesian_tag_y>;
+    /// The type of the result of the function described by this mapping
+    using CoordResult = Coord<curvilinear_tag_r, curvilinear_tag_theta>;
+
+    /// The type of the lookup table containing the initial guesses.
+    using LookupTable = Kokkos::View<const CoordResult**, Kokkos::LayoutRight, MemorySpace>;
+
+private:
+    using X = cartesian_tag_x;
+    using Y = cartesian_tag_y;
+    using R_cov = typename DiscreteMapping::R_cov;
+    using Theta_cov = typename DiscreteMapping::Theta_cov;
+
+private:
+    DiscreteMapping m_mapping;
+    LookupTable m_initial_guesses;
+    CoordArg m_lookup_min;
+    double m_lookup_dx;
+    double m_lookup_dy;
+    double m_r_min;
+    double m_r_max;
+    double m_theta_min;
+    double m_theta_period;
+    int m_max_iterations;
+    double m_tolerance;
+
+public:
+    /**
+     * @brief Instantiate an InverseDiscretePoloidalCSSplineMapping.
+     *
+     * @param[in] mapping The discrete mapping being inverted.
+     * @param[in] initial_guesses The lookup table of initial guesses on the uniform Cartesian grid.
+     * @param[in] lookup_min The Cartesian coordinate of the lower corner of the lookup grid.
+     * @param[in] lookup_dx The cell length of the lookup grid along the first physical dimension.
+     * @param[in] lookup_dy The cell length of the lookup grid along the second physical dimension.
+     * @param[in] r_min The minimum value of the first logical coordinate.
+     * @param[in] r_max The maximum value of the first logical coordinate.
+     * @param[in] theta_min The minimum value of the second (periodic) logical coordinate.
+     * @param[in] theta_period The period of the second logical coordinate.
+     * @param[in] max_iterations The maximum number of Newton iterations.
+     * @param[in] tolerance The tolerance on the Euclidean norm of the residual in the physical domain.
+     */
+    InverseDiscretePoloidalCSSplineMapping(
+            DiscreteMapping const& mapping,
+            LookupTable initial_guesses,
+            CoordArg lookup_min,
+            double lookup_dx,
+            double lookup_dy,
+            double r_min,
+            double r_max,
+            double theta_min,
+            double theta_period,
+            int max_iterations,
+            double tolerance)
+        : m_mapping(mapping)
+        , m_initial_guesses(initial_guesses)
+        , m_lookup_min(lookup_min)
+        , m_lookup_dx(lookup_dx)
+        , m_lookup_dy(lookup_dy)
+        , m_r_min(r_min)
+        , m_r_max(r_max)
+        , m_theta_min(theta_min)
+        , m_theta_period(theta_period)
+        , m_max_iterations(max_iterations)
+        , m_tolerance(tolerance)
+    {
+    }
+
+    /**
+     * @brief Convert the coordinate (x,y) to the equivalent @f$ (r, \theta) @f$ coordinate.
+     *
+     * A warning is printed if the Newton method does not reach the tolerance within the
+     * maximum number of iterations. The last iterate is then returned.
+     *
+     * @param[in] coord The coordinate to be converted.
+     *
+     * @return The equivalent coordinate.
+     */
+    KOKKOS_FUNCTION CoordResult operator()(CoordArg const& coord) const
+    {
+        CoordResult logical_coord;
+        if (!newton_solve(coord, logical_coord)) {
+            Kokkos::printf(
+                    "WARNING ! -> The inverse of the discrete mapping did not converge.\n");
+        }
+        return logical_coord;
+    }
+
+    /**
+     * @brief Convert a field of (x,y) coordinates to the equivalent @f$ (r, \theta) @f$ coordinates.
+     *
+     * All the coordinates are inverted in a single kernel. An exception is thrown if the
+     * Newton method does not converge for some of the coordinates.
+     *
+     * @param[in] exec_space The execution space where the calculation should be carried out.
+     * @param[out] logical_coords The equivalent @f$ (r, \theta) @f$ coordinates.
+     * @param[in] cartesian_coords The (x,y) coordinates to be converted.
+     */
+    template <class ExecSpace, class IdxRangeBatch>
+    void operator()(
+            ExecSpace exec_space,
+            Field<CoordResult, IdxRangeBatch, MemorySpace> logical_coords,
+            ConstField<CoordArg, IdxRangeBatch, MemorySpace> cartesian_coords) const
+    {
+        static_assert(Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible);
+        using IdxBatch = typename IdxRangeBatch::discrete_element_type;
+        assert(get_idx_range(logical_coords) == get_idx_range(cartesian_coords));
+        const std::source_location location = std::source_location::current();
+        int const n_not_converged = ddc::parallel_transform_reduce(
+                location.function_name(),
+                exec_space,
+                get_idx_range(logical_coords),
+                0,
+                ddc::reducer::sum<int>(),
+                KOKKOS_CLASS_LAMBDA(IdxBatch idx) {
+                    return newton_solve(cartesian_coords(idx), logical_coords(idx)) ? 0 : 1;
+                });
+        if (n_not_converged > 0) {
+            throw std::runtime_error(
+                    "The inverse of the discrete mapping did not converge for "
+                    + std::to_string(n_not_converged) + " coordinates.");
+        }
+    }
+
+    /**
+     * @brief Get the discrete mapping which is inverted by this class.
+     *
+     * @return The discrete mapping.
+     */
+    KOKKOS_INLINE_FUNCTION DiscreteMapping get_inverse_mapping() const
+    {
+        return m_mapping;
+    }
+
+private:
+    /**
+     * @brief Solve @f$ F(r,\theta) = (x,y) @f$ with the damped Newton method.
+     *
+     * @param[in] coord The coordinate (x,y) to be converted.
+     * @param[out] logical_coord The last iterate of the Newton method.
+     *
+     * @return True if the residual is below the tolerance, false otherwise.
+     */
+    KOKKOS_FUNCTION bool newton_solve(CoordArg const& coord, CoordResult& logical_coord) const
+    {
+        double const x = ddc::get<X>(coord);
+        double const y = ddc::get<Y>(coord);
+
+        logical_coord = get_initial_guess(coord);
+        CoordArg mapped_coord = m_mapping(logical_coord);
+        double residual_x = x - ddc::get<X>(mapped_coord);
+        double residual_y = y - ddc::get<Y>(mapped_coord);
+        double residual = Kokkos::sqrt(residual_x * residual_x + residual_y * residual_y);
+
+        for (int iter(0); (iter < m_max_iterations) && (residual > m_tolerance); ++iter) {
+            DTensor<VectorIndexSet<X, Y>, VectorIndexSet<R_cov, Theta_cov>> const J
+                    = m_mapping.jacobian_matrix(logical_coord);
+            double const j_xr = ddcHelper::get<X, R_cov>(J);
+            double const j_xtheta = ddcHelper::get<X, Theta_cov>(J);
+            double const j_yr = ddcHelper::get<Y, R_cov>(J);
+            double const j_ytheta = ddcHelper::get<Y, Theta_cov>(J);
+            double const det = j_xr * j_ytheta - j_xtheta * j_yr;
+            if (Kokkos::abs(det) < 1e-15) {
+                break;
+            }
+            double const delta_r = (j_ytheta * residual_x - j_xtheta * residual_y) / det;
+            double const delta_theta = (-j_yr * residual_x + j_xr * residual_y) / det;
+
+            // Damping: halve the step until the residual decreases.
+            bool step_accepted = false;
+            double alpha = 1.0;
+            for (int n_halvings(0); (n_halvings < s_max_halvings) && !step_accepted;
+                 ++n_halvings) {
+                CoordResult const candidate = get_admissible_coord(
+                        ddc::get<curvilinear_tag_r>(logical_coord) + alpha * delta_r,
+                        ddc::get<curvilinear_tag_theta>(logical_coord) + alpha * delta_theta);
+                CoordArg const candidate_mapped = m_mapping(candidate);
+                double const candidate_residual_x = x - ddc::get<X>(candidate_mapped);
+                double const candidate_residual_y = y - ddc::get<Y>(candidate_mapped);
+                double const candidate_residual = Kokkos::sqrt(
+                        candidate_residual_x * candidate_residual_x
+                        + candidate_residual_y * candidate_residual_y);
+                if (candidate_residual < residual) {
+                    logical_coord = candidate;
+                    residual_x = candidate_residual_x;
+                    residual_y = candidate_residual_y;
+                    residual = candidate_residual;
+                    step_accepted = true;
+                }
+                alpha *= 0.5;
+            }
+            if (!step_accepted) {
+                break;
+            }
+        }
+        return residual <= m_tolerance;
+    }
+
+    /// The maximum number of times that a Newton step is halved.
+    static constexpr int s_max_halvings = 8;
+
+    /// Get the initial guess stored in the cell of the lookup grid containing the coordinate.
+    KOKKOS_INLINE_FUNCTION CoordResult get_initial_guess(CoordArg const& coord) const
+    {
+        int const nx = m_initial_guesses.extent(0);
+        int const ny = m_initial_guesses.extent(1);
+        int ix = static_cast<int>(
+                Kokkos::floor((ddc::get<X>(coord) - ddc::get<X>(m_lookup_min)) / m_lookup_dx));
+        int iy = static_cast<int>(
+                Kokkos::floor((ddc::get<Y>(coord) - ddc::get<Y>(m_lookup_min)) / m_lookup_dy));
+        ix = Kokkos::clamp(ix, 0, nx - 1);
+        iy = Kokkos::clamp(iy, 0, ny - 1);
+        return m_initial_guesses(ix, iy);
+    }
+
+    /// Restrict r to the logical domain and wrap theta in its period.
+    KOKKOS_INLINE_FUNCTION CoordResult get_admissible_coord(double r, double theta) const
+    {
+        r = Kokkos::clamp(r, m_r_min, m_r_max);
+        theta = m_theta_min + Kokkos::fmod(theta - m_theta_min, m_theta_period);
+        if (theta < m_theta_min) {
+            theta += m_theta_period;
+        }
+        return CoordResult(r, theta);
+    }
+};
+
+
+/**
+ * @brief A class to create an InverseDiscretePoloidalCSSplineMapping instance from a
+ * DiscretePoloidalCSSplineMapping.
+ *
+ * This class creates and stores the lookup table used to find the initial guess of the
+ * Newton method. The lookup table is defined on a uniform Cartesian grid covering the
+ * bounding box of the mapped logical domain. It is computed on the execution space by
+ * sampling the discrete mapping on a uniform logical grid and by storing for each cell of
+ * the Cartesian grid the logical coordinate of the closest mapped sample.
+ *
+ * @tparam DiscreteMapping The type of the DiscretePoloidalCSSplineMapping being inverted.
+ * @tparam ExecSpace The execution space where the lookup table is computed.
+ */
+template <class DiscreteMapping, class ExecSpace = Kokkos::DefaultExecutionSpace>
+class InverseDiscretePoloidalCSSplineMappingBuilder
+{
+    static_assert(is_accessible_v<ExecSpace, DiscreteMapping>);
+
+public:
+    /// The memory space where the lookup table is saved.
+    using memory_space = typename ExecSpace::memory_space;
+
+    /// The type of the inverse mapping that will be created.
+    using MappingType = InverseDiscretePoloidalCSSplineMapping<DiscreteMapping, memory_space>;
+
+private:
+    using X = typename DiscreteMapping::cartesian_tag_x;
+    using Y = typename DiscreteMapping::cartesian_tag_y;
+    using R = typename DiscreteMapping::curvilinear_tag_r;
+    using Theta = typename DiscreteMapping::curvilinear_tag_theta;
+    using BSplineR = typename DiscreteMapping::BSplineR;
+    using BSplineTheta = typename DiscreteMapping::BSplineTheta;
+
+    using CoordXY = Coord<X, Y>;
+    using CoordRTheta = Coord<R, Theta>;
+
+private:
+    DiscreteMapping m_mapping;
+    Kokkos::View<CoordRTheta**, Kokkos::LayoutRight, memory_space> m_initial_guesses;
+    CoordXY m_lookup_min;
+    double m_lookup_dx;
+    double m_lookup_dy;
+    double m_r_min;
+    double m_r_max;
+    double m_theta_min;
+    double m_theta_period;
+    int m_max_iterations;
+    double m_tolerance;
+
+public:
+    /**
+     * @brief Create an instance of the class capable of providing an InverseDiscretePoloidalCSSplineMapping.
+     *
+     * @param[in] exec_space The execution space where the lookup table is computed.
+     * @param[in] mapping The discrete mapping to be inverted.
+     * @param[in] n_cells_x The number of cells of the lookup grid along the first physical dimension.
+     * @param[in] n_cells_y The number of cells of the lookup grid along the second physical dimension.
+     * @param[in] n_samples_r The number of samples of the logical domain along r.
+     * @param[in] n_samples_theta The number of samples of the logical domain along theta.
+     * @param[in] max_iterations The maximum number of Newton iterations.
+     * @param[in] tolerance The tolerance on the Euclidean norm of the residual in the physical domain.
+     */
+    InverseDiscretePoloidalCSSplineMappingBuilder(
+            ExecSpace exec_space,
+            DiscreteMapping const& mapping,
+            int n_cells_x = 32,
+            int n_cells_y = 32,
+            int n_samples_r = 64,
+            int n_samples_theta = 64,
+            int max_iterations = 10,
+            double tolerance = 1e-13)
+        : m_mapping(mapping)
+        , m_initial_guesses(
+                  "m_initial_guesses "
+                  "(InverseDiscretePoloidalCSSplineMappingBuilder::"
+                  "InverseDiscretePoloidalCSSplineMappingBuilder)",
+                  n_cells_x,
+                  n_cells_y)
+        , m_r_min(ddc::discrete_space<BSplineR>().rmin())
+        , m_r_max(ddc::discrete_space<BSplineR>().rmax())
+        , m_theta_min(ddc::discrete_space<BSplineTheta>().rmin())
+        , m_theta_period(
+                  ddc::discrete_space<BSplineTheta>().rmax()
+                  - ddc::discrete_space<BSplineTheta>().rmin())
+        , m_max_iterations(max_iterations)
+        , m_tolerance(tolerance)
+    {
+        assert(n_cells_x > 0 && n_cells_y > 0);
+        assert(n_samples_r > 1 && n_samples_theta > 0);
+
+        Kokkos::View<CoordRTheta**, Kokkos::LayoutRight, memory_space> logical_samples(
+                "logical_samples "
+                "(InverseDiscretePoloidalCSSplineMappingBuilder::"
+                "InverseDiscretePoloidalCSSplineMappingBuilder)",
+                n_samples_r,
+                n_samples_theta);
+        Kokkos::View<CoordXY**, Kokkos::LayoutRight, memory_space> mapped_samples(
+                "mapped_samples "
+                "(InverseDiscretePoloidalCSSplineMappingBuilder::"
+                "InverseDiscretePoloidalCSSplineMappingBuilder)",
+                n_samples_r,
+                n_samples_theta);
+
+        sample_mapping(exec_space, logical_samples, mapped_samples);
+        set_bounding_box(exec_space, mapped_samples, n_cells_x, n_cells_y);
+        set_initial_guesses(exec_space, logical_samples, mapped_samples);
+    }
+
+    /**
+     * @brief Get an InverseDiscretePoloidalCSSplineMapping class instance.
+     *
+     * @return An instance of the inverse mapping.
+     */
+    MappingType operator()() const
+    {
+        return MappingType(
+                m_mapping,
+                m_initial_guesses,
+                m_lookup_min,
+                m_lookup_dx,
+                m_lookup_dy,
+                m_r_min,
+                m_r_max,
+                m_theta_min,
+                m_theta_period,
+                m_max_iterations,
+                m_tolerance);
+    }
+
+    /**
+     * @brief Evaluate the mapping on a uniform sampling of the logical domain.
+     *
+     * This function should be private. It is not due to the inclusion of a KOKKOS_LAMBDA
+     *
+     * @param[in] exec_space The execution space where the calculation is carried out.
+     * @param[out] logical_samples The logical coordinates of the samples.
+     * @param[out] mapped_samples The physical coordinates of the samples.
+     */
+    void sample_mapping(
+            ExecSpace exec_space,
+            Kokkos::View<CoordRTheta**, Kokkos::LayoutRight, memory_space> logical_samples,
+            Kokkos::View<CoordXY**, Kokkos::LayoutRight, memory_space> mapped_samples) const
+    {
+        int const n_samples_r = logical_samples.extent(0);
+        int const n_samples_theta = logical_samples.extent(1);
+        double const dr = (m_r_max - m_r_min) / (n_samples_r - 1);
+        double const dtheta = m_theta_period / n_samples_theta;
+        double const r_min = m_r_min;
+        double const theta_min = m_theta_min;
+        DiscreteMapping const mapping = m_mapping;
+        Kokkos::parallel_for(
+                "sample_mapping (InverseDiscretePoloidalCSSplineMappingBuilder)",
+                Kokkos::MDRangePolicy<ExecSpace, Kokkos::Rank<2>>(
+                        exec_space,
+                        {0, 0},
+                        {n_samples_r, n_samples_theta}),
+                KOKKOS_LAMBDA(int const ir, int const itheta) {
+                    CoordRTheta const coord(r_min + ir * dr, theta_min + itheta * dtheta);
+                    logical_samples(ir, itheta) = coord;
+                    mapped_samples(ir, itheta) = mapping(coord);
+                });
+    }
+
+    /**
+     * @brief Compute the uniform Cartesian lookup grid covering the mapped samples.
+     *
+     * This function should be private. It is not due to the inclusion of a KOKKOS_LAMBDA
+     *
+     * @param[in] exec_space The execution space where the calculation is carried out.
+     * @param[in] mapped_samples The physical coordinates of the samples.
+     * @param[in] n_cells_x The number of cells of the lookup grid along the first physical dimension.
+     * @param[in] n_cells_y The number of cells of the lookup grid along the second physical dimension.
+     */
+    void set_bounding_box(
+            ExecSpace exec_space,
+            Kokkos::View<CoordXY**, Kokkos::LayoutRight, memory_space> mapped_samples,
+            int n_cells_x,
+            int n_cells_y)
+    {
+        int const n_samples_theta = mapped_samples.extent(1);
+        int const n_samples = mapped_samples.extent(0) * n_samples_theta;
+        double x_min;
+        double x_max;
+        double y_min;
+        double y_max;
+        Kokkos::parallel_reduce(
+                "set_bounding_box (InverseDiscretePoloidalCSSplineMappingBuilder)",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 0, n_samples),
+                KOKKOS_LAMBDA(
+                        int const i,
+                        double& local_x_min,
+                        double& local_x_max,
+                        double& local_y_min,
+                        double& local_y_max) {
+                    CoordXY const pt = mapped_samples(i / n_samples_theta, i % n_samples_theta);
+                    local_x_min = Kokkos::min(local_x_min, double(ddc::get<X>(pt)));
+                    local_x_max = Kokkos::max(local_x_max, double(ddc::get<X>(pt)));
+                    local_y_min = Kokkos::min(local_y_min, double(ddc::get<Y>(pt)));
+                    local_y_max = Kokkos::max(local_y_max, double(ddc::get<Y>(pt)));
+                },
+                Kokkos::Min<double>(x_min),
+                Kokkos::Max<double>(x_max),
+                Kokkos::Min<double>(y_min),
+                Kokkos::Max<double>(y_max));
+
+        m_lookup_min = CoordXY(x_min, y_min);
+        m_lookup_dx = (x_max - x_min) / n_cells_x;
+        m_lookup_dy = (y_max - y_min) / n_cells_y;
+    }
+
+    /**
+     * @brief Store in each cell of the lookup grid the logical coordinate of the
+     * mapped sample which is closest to the centre of the cell.
+     *
+     * This function should be private. It is not due to the inclusion of a KOKKOS_LAMBDA
+     *
+     * @param[in] exec_space The execution space where the calculation is carried out.
+     * @param[in] logical_samples The logical coordinates of the samples.
+     * @param[in] mapped_samples The physical coordinates of the samples.
+     */
+    void set_initial_guesses(
+            ExecSpace exec_space,
+            Kokkos::View<CoordRTheta**, Kokkos::LayoutRight, memory_space> logical_samples,
+            Kokkos::View<CoordXY**, Kokkos::LayoutRight, memory_space> mapped_samples)
+    {
+        int const n_cells_x = m_initial_guesses.extent(0);
+        int const n_cells_y = m_initial_guesses.extent(1);
+        int const n_samples_r = logical_samples.extent(0);
+        int const n_samples_theta = logical_samples.extent(1);
+        double const x_min = ddc::get<X>(m_lookup_min);
+        double const y_min = ddc::get<Y>(m_lookup_min);
+        double const dx = m_lookup_dx;
+        double const dy = m_lookup_dy;
+        Kokkos::View<CoordRTheta**, Kokkos::LayoutRight, memory_space> initial_guesses
+                = m_initial_guesses;
+        Kokkos::parallel_for(
+                "set_initial_guesses (InverseDiscretePoloidalCSSplineMappingBuilder)",
+                Kokkos::MDRangePolicy<ExecSpace, Kokkos::Rank<2>>(
+                        exec_space,
+                        {0, 0},
+                        {n_cells_x, n_cells_y}),
+                KOKKOS_LAMBDA(int const ix, int const iy) {
+                    double const x_centre = x_min + (ix + 0.5) * dx;
+                    double const y_centre = y_min + (iy + 0.5) * dy;
+                    double min_dist2 = Kokkos::Experimental::infinity_v<double>;
+                    CoordRTheta closest_sample = logical_samples(0, 0);
+                    for (int ir(0); ir < n_samples_r; ++ir) {
+                        for (int itheta(0); itheta < n_samples_theta; ++itheta) {
+                            CoordXY const pt = mapped_samples(ir, itheta);
+                            double const diff_x = ddc::get<X>(pt) - x_centre;
+                            double const diff_y = ddc::get<Y>(pt) - y_centre;
+                            double const dist2 = diff_x * diff_x + diff_y * diff_y;
+                            if (dist2 < min_dist2) {
+                                min_dist2 = dist2;
+                                closest_sample = logical_samples(ir, itheta);
+                            }
+                        }
+                    }
+                    initial_guesses(ix, iy) = closest_sample;
+                });
+    }
+};
+
+
+namespace mapping_detail {
+template <class DiscreteMapping, class MemorySpace, class ExecSpace>
+struct MappingAccessibility<
+        ExecSpace,
+        InverseDiscretePoloidalCSSplineMapping<DiscreteMapping, MemorySpace>>
+{
+    static constexpr bool value = Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible
+                                  && is_accessible_v<ExecSpace, DiscreteMapping>;
+};
+
+} // namespace mapping_detail
@@ -187,6 +187,7 @@ public:
         // Iteration loop
         start_time = std::chrono::system_clock::now();
         for (int iter(0); iter < steps; ++iter) {
+            Kokkos::Profiling::pushRegion("(GSLX) Time step");
             time_stepper
                     .update(Kokkos::DefaultExecutionSpace(),
                             density,
@@ -205,6 +206,7 @@ public:
                     .with("time", iter * dt)
                     .with("density", density_host)
                     .with("electrical_potential", electrical_potential_host);
+            Kokkos::Profiling::popRegion();
         }
         end_time = std::chrono::system_clock::now();
 
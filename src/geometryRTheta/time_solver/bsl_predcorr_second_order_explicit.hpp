@@ -218,6 +218,7 @@ public:
         // --- Parameter for linearisation of advection field: --------------------------------------------
         start_time = std::chrono::system_clock::now();
         for (int iter(0); iter < steps; ++iter) {
+            Kokkos::Profiling::pushRegion("(GSLX) Time step");
             double const time = iter * dt;
 
             // STEP 1: From rho^n, we compute phi^n: Poisson equation
@@ -316,6 +317,7 @@ public:
                     });
 
             m_advection_solver(get_field(density), get_const_field(advection_field), dt);
+            Kokkos::Profiling::popRegion();
         }
 
         // STEP 1: From rho^n, we compute phi^n: Poisson equation
@@ -1,21 +1,26 @@
 // SPDX-License-Identifier: MIT
 
 #pragma once
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <limits>
 
 #include <ddc/ddc.hpp>
 #include <ddc/pdi.hpp>
 
 #include "advection_field_rtheta.hpp"
 #include "bsl_advection_polar.hpp"
+#include "cfl_time_step_controller.hpp"
 #include "ddc_alias_inline_functions.hpp"
 #include "ddc_aliases.hpp"
 #include "euler.hpp"
 #include "geometry_r_theta.hpp"
 #include "itimesolver.hpp"
+#include "l_norm_tools.hpp"
 #include "poisson_like_rhs_function.hpp"
 #include "polar_spline_fem_poisson_like_solver.hpp"
 #include "spline_definitions_r_theta.hpp"
@@ -53,6 +58,8 @@
  *      - the characteristic feet @f$X^C@f$ is such that @f$X^C = X^k@f$ with @f$X^k@f$ the result of the implicit method:
  *          - @f$\partial_t X^k = A^P(X^n) + A^P(X^{k-1}) @f$,
  *
+ * The time step can either be fixed or chosen at each iteration from a CFL condition
+ * on the advection field @f$A^n@f$ (see CFLTimeStepController).
  *
  * @tparam LogicalToPhysicalMapping
  *      A class describing a mapping from curvilinear coordinates to Cartesian coordinates.
@@ -147,6 +154,55 @@ public:
             host_t<DFieldRTheta> density_host,
             double const dt,
             int const steps) const final
+    {
+        return solve(density_host, dt, steps, steps * dt, nullptr);
+    }
+
+    /**
+     * @brief Solves on @f$ [0, T] @f$ the equations system with a time step
+     * chosen at each iteration from a CFL condition.
+     *
+     * The outputs are saved at each output time of the controller.
+     *
+     * @param[in, out] density_host
+     *      On input: the initial condition.
+     *      On output: the solution at @f$ T @f$.
+     * @param[in] final_time
+     *      The final time @f$ T @f$.
+     * @param[in] time_step_controller
+     *      The object which chooses the time step.
+     *
+     * @return The electron density at @f$ T @f$.
+     */
+    host_t<DFieldRTheta> operator()(
+            host_t<DFieldRTheta> density_host,
+            double const final_time,
+            CFLTimeStepController const& time_step_controller) const
+    {
+        return solve(density_host, 0., 0, final_time, &time_step_controller);
+    }
+
+    /**
+     * @brief Solves the equations system with either a fixed or an adaptive time step.
+     *
+     * This function should be private. It is not due to the inclusion of a KOKKOS_LAMBDA.
+     *
+     * @param[in, out] density_host The density, on input the initial condition and on
+     *          output the solution at the final time.
+     * @param[in] dt The time step (only used if time_step_controller is null).
+     * @param[in] steps The number of iterations (only used if time_step_controller is null).
+     * @param[in] final_time The final time.
+     * @param[in] time_step_controller The object which chooses the time step, or a null
+     *          pointer to use a fixed time step.
+     *
+     * @return The electron density at the final time.
+     */
+    host_t<DFieldRTheta> solve(
+            host_t<DFieldRTheta> density_host,
+            double const dt,
+            int const steps,
+            double const final_time,
+            CFLTimeStepController const* time_step_controller) const
     {
         std::chrono::time_point<std::chrono::system_clock> start_time;
         std::chrono::time_point<std::chrono::system_clock> end_time;
@@ -223,8 +279,23 @@ public:
 
         ddc::parallel_deepcopy(density, get_const_field(density_host));
 
+        double min_cell_width = 0.;
+        if (time_step_controller) {
+            min_cell_width = get_min_cell_width(grid);
+        }
+
+        int iter = 0;
+        int output_iter = 0;
+        double time = 0.;
+        double next_output_time = 0.;
+
         start_time = std::chrono::system_clock::now();
-        for (int iter(0); iter < steps; ++iter) {
+        while (time_step_controller ? time < final_time : iter < steps) {
+            Kokkos::Profiling::pushRegion("(GSLX) Time step");
+            if (!time_step_controller) {
+                time = iter * dt;
+            }
+
             // STEP 1: From rho^n, we compute phi^n: Poisson equation
             m_builder(density_coef, get_const_field(density));
             m_poisson_solver(electrostatic_potential_coef, charge_density);
@@ -233,16 +304,25 @@ public:
                     get_field(electrical_potential_alloc),
                     get_const_field(electrostatic_potential_coef));
 
-            ddc::parallel_deepcopy(
-                    get_field(electrical_potential_alloc_host),
-                    get_const_field(electrical_potential_alloc));
-            ddc::parallel_deepcopy(density_host, get_const_field(density));
-
-            ddc::PdiEvent("iteration")
-                    .with("iter", iter)
-                    .with("time", iter * dt)
-                    .with("density", density_host)
-                    .with("electrical_potential", electrical_potential_alloc_host);
+            if (!time_step_controller || time == next_output_time) {
+                ddc::parallel_deepcopy(
+                        get_field(electrical_potential_alloc_host),
+                        get_const_field(electrical_potential_alloc));
+                ddc::parallel_deepcopy(density_host, get_const_field(density));
+
+                ddc::PdiEvent("iteration")
+                        .with("iter", time_step_controller ? output_iter : iter)
+                        .with("time", time)
+                        .with("density", density_host)
+                        .with("electrical_potential", electrical_potential_alloc_host);
+
+                if (time_step_controller) {
+                    output_iter++;
+                    next_output_time = std::min(
+                            time + time_step_controller->get_output_period(),
+                            final_time);
+                }
+            }
 
             ddc::parallel_deepcopy(
                     electrostatic_potential_coef_host,
@@ -253,6 +333,16 @@ public:
 
             ddcHelper::deepcopy(advection_field, get_const_field(advection_field_host));
 
+            double step_dt = dt;
+            if (time_step_controller) {
+                double const max_advection = norm_inf(
+                        Kokkos::DefaultExecutionSpace(),
+                        get_const_field(advection_field));
+                step_dt = time_step_controller->get_time_step(
+                        max_advection / min_cell_width,
+                        next_output_time - time);
+            }
+
             // STEP 3: From rho^n and A^n, we compute rho^P: Vlasov equation
             m_builder(
                     ddcHelper::get<X>(advection_field_coefs_k),
@@ -276,7 +366,7 @@ public:
                     advection_field,
                     get_const_field(advection_field_coefs_k),
                     feet_coords,
-                    dt / 4.,
+                    step_dt / 4.,
                     tau);
 
             // Evaluate A^n at X^P:
@@ -305,7 +395,7 @@ public:
             // X^P = X^n - dt/2 * ( E^n(X^n) + E^n(X^P) )/2:
             // --- Copy rho^n because it will be modified:
             ddc::parallel_deepcopy(density_predicted, density);
-            m_advection_solver(density_predicted, get_const_field(advection_field_k), dt / 2.);
+            m_advection_solver(density_predicted, get_const_field(advection_field_k), step_dt / 2.);
 
             // --- advect also the feet because it is needed for the next step
             ddc::parallel_for_each(
@@ -315,7 +405,7 @@ public:
                     KOKKOS_LAMBDA(IdxRTheta const irtheta) {
                         feet_coords(irtheta) = ddc::coordinate(irtheta);
                     });
-            m_foot_finder(feet_coords, get_const_field(advection_field_k_tot), dt / 2.);
+            m_foot_finder(feet_coords, get_const_field(advection_field_k_tot), step_dt / 2.);
 
 
             // STEP 4: From rho^P, we compute phi^P: Poisson equation
@@ -354,7 +444,7 @@ public:
                     advection_field,
                     get_const_field(advection_field_coefs_k),
                     get_field(feet_coords_alloc),
-                    dt / 2.,
+                    step_dt / 2.,
                     tau);
 
             // Evaluate A^P at X^P:
@@ -379,7 +469,13 @@ public:
                                 (advection_field(irtheta) + advection_field_k(irtheta)) / 2.);
                     });
             // X^k = X^n - dt * ( A^P(X^n) + A^P(X^P) )/2
-            m_advection_solver(density, get_const_field(advection_field_k_tot), dt);
+            m_advection_solver(density, get_const_field(advection_field_k_tot), step_dt);
+
+            if (time_step_controller) {
+                time = (step_dt == next_output_time - time) ? next_output_time : time + step_dt;
+            }
+            iter++;
+            Kokkos::Profiling::popRegion();
         }
 
         // STEP 1: From rho^n, we compute phi^n: Poisson equation
@@ -390,8 +486,8 @@ public:
                 get_const_field(electrical_potential_alloc));
 
         ddc::PdiEvent("last_iteration")
-                .with("iter", steps)
-                .with("time", steps * dt)
+                .with("iter", time_step_controller ? output_iter : steps)
+                .with("time", final_time)
                 .with("density", density_host)
                 .with("electrical_potential", electrical_potential_alloc_host);
 
@@ -498,4 +594,41 @@ public:
 
         } while ((square_difference_feet > tau * tau) and (count < max_count));
     }
+
+private:
+    /**
+     * @brief Get the smallest physical distance between two neighbouring points of the grid.
+     *
+     * The points which are mapped onto the same physical point (e.g. at the O-point) are ignored.
+     *
+     * @param[in] grid The index range on which the functions are defined.
+     *
+     * @return The smallest distance.
+     */
+    double get_min_cell_width(IdxRangeRTheta const& grid) const
+    {
+        IdxRangeR const grid_r = ddc::select<GridR>(grid);
+        IdxRangeTheta const grid_theta = ddc::select<GridTheta>(grid);
+        double min_width = std::numeric_limits<double>::max();
+        auto update_min_width = [&](IdxRTheta const irtheta_1, IdxRTheta const irtheta_2) {
+            DVector<X, Y> distance(
+                    m_logical_to_physical(ddc::coordinate(irtheta_1))
+                    - m_logical_to_physical(ddc::coordinate(irtheta_2)));
+            double const width = std::sqrt(scalar_product(distance, distance));
+            if (width > 0) {
+                min_width = std::min(min_width, width);
+            }
+        };
+        ddc::host_for_each(grid, [&](IdxRTheta const irtheta) {
+            IdxR const ir(irtheta);
+            IdxTheta const itheta(irtheta);
+            if (ir != grid_r.back()) {
+                update_min_width(irtheta, IdxRTheta(ir + 1, itheta));
+            }
+            if (itheta != grid_theta.back()) {
+                update_min_width(irtheta, IdxRTheta(ir, itheta + 1));
+            }
+        });
+        return min_width;
+    }
 };
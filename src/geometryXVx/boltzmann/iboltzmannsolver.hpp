@@ -23,4 +23,27 @@ public:
      */
     virtual DFieldSpXVx operator()(DFieldSpXVx allfdistribu, DConstFieldX efield, double dt)
             const = 0;
+
+    /**
+     * @brief Computes the charge density of the solution of the Boltzmann equation after one
+     * timestep without modifying the distribution function.
+     *
+     * Solvers whose last operation is an advection along x compute the charge density
+     * directly from the values at the feet of the characteristics so that the advanced
+     * distribution function is never stored.
+     *
+     * @param[out] charge_density The charge density of the distribution function at the end
+     *                              of the timestep.
+     * @param[in] allfdistribu The value of the distribution function at the start of the timestep.
+     * @param[in] efield The electric field computed at every spatial position.
+     * @param[in] quadrature_coeffs The coefficients of the quadrature over the velocity space.
+     * @param[in] dt The timestep.
+     * @return The charge density at the end of the timestep.
+     */
+    virtual DFieldX charge_density_after_step(
+            DFieldX charge_density,
+            DConstFieldSpXVx allfdistribu,
+            DConstFieldX efield,
+            DConstFieldVx quadrature_coeffs,
+            double dt) const = 0;
 };
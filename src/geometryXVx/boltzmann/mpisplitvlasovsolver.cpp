@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: MIT
+
+#include <utility>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "first_touch.hpp"
+#include "mpisplitvlasovsolver.hpp"
+#include "mpitools.hpp"
+
+MpiSplitVlasovSolver::MpiSplitVlasovSolver(
+        IAdvectionSpatial<GeometryXVx, GridX> const& advec_x,
+        IAdvectionVelocity<GeometryXVx, GridVx> const& advec_vx,
+        MPITransposeAllToAll<XSplit, VxSplit> const& transpose,
+        std::vector<std::reference_wrapper<IRightHandSide const>> rhs)
+    : m_advec_x(advec_x)
+    , m_advec_vx(advec_vx)
+    , m_transpose(transpose)
+    , m_rhs(std::move(rhs))
+    , m_allfdistribu_xsplit_alloc(
+              "allfdistribu_xsplit (MpiSplitVlasovSolver)",
+              transpose.get_local_idx_range<XSplit>())
+    , m_local_electric_field_alloc(
+              "local_electric_field (MpiSplitVlasovSolver)",
+              IdxRangeX(transpose.get_local_idx_range<XSplit>()))
+{
+    // This buffer may be written directly by MPI so it is touched in parallel beforehand
+    first_touch(Kokkos::DefaultExecutionSpace(), get_field(m_allfdistribu_xsplit_alloc));
+}
+
+void MpiSplitVlasovSolver::advect_velocity(
+        DFieldSpXVx const allfdistribu_vxsplit,
+        DConstFieldX const electric_field,
+        double const dt) const
+{
+    DFieldSpXVx allfdistribu_xsplit = get_field(m_allfdistribu_xsplit_alloc);
+
+    // Contiguous memory space containing the relevant section of the electric field
+    DFieldX local_electric_field = get_field(m_local_electric_field_alloc);
+    ddc::parallel_deepcopy(
+            local_electric_field,
+            electric_field[get_idx_range(local_electric_field)]);
+
+    // Swap to vx contiguous layout
+    m_transpose.transpose_to<XSplit>(
+            Kokkos::DefaultExecutionSpace(),
+            allfdistribu_xsplit,
+            get_const_field(allfdistribu_vxsplit));
+    // All the velocities are local so the sources can be applied
+    m_rhs(allfdistribu_xsplit, dt / 2);
+    m_advec_vx(allfdistribu_xsplit, get_const_field(local_electric_field), dt);
+    m_rhs(allfdistribu_xsplit, dt / 2);
+    // Swap back to the layout with all the spatial positions
+    m_transpose.transpose_to<VxSplit>(
+            Kokkos::DefaultExecutionSpace(),
+            allfdistribu_vxsplit,
+            get_const_field(allfdistribu_xsplit));
+}
+
+DFieldSpXVx MpiSplitVlasovSolver::operator()(
+        DFieldSpXVx const allfdistribu_vxsplit,
+        DConstFieldX const electric_field,
+        double const dt) const
+{
+    m_advec_x(allfdistribu_vxsplit, dt / 2);
+    advect_velocity(allfdistribu_vxsplit, electric_field, dt);
+    m_advec_x(allfdistribu_vxsplit, dt / 2);
+    return allfdistribu_vxsplit;
+}
+
+DFieldX MpiSplitVlasovSolver::charge_density_after_step(
+        DFieldX const charge_density,
+        DConstFieldSpXVx const allfdistribu_vxsplit,
+        DConstFieldX const electric_field,
+        DConstFieldVx const quadrature_coeffs,
+        double const dt) const
+{
+    // The transposes act on all the species so the advected values are stored for all species
+    DFieldMemSpXVx allfdistribu_advected_alloc(
+            "allfdistribu_advected (MpiSplitVlasovSolver::charge_density_after_step())",
+            get_idx_range(allfdistribu_vxsplit));
+    DFieldSpXVx allfdistribu_advected = get_field(allfdistribu_advected_alloc);
+    DFieldMemX charge_density_local_alloc(
+            "charge_density_local (MpiSplitVlasovSolver::charge_density_after_step())",
+            get_idx_range(charge_density));
+    DFieldX charge_density_local = get_field(charge_density_local_alloc);
+
+    ddc::parallel_deepcopy(allfdistribu_advected, allfdistribu_vxsplit);
+    m_advec_x(allfdistribu_advected, dt / 2);
+    advect_velocity(allfdistribu_advected, electric_field, dt);
+    // The last advection only computes the charge density
+    m_advec_x.charge_density_after_transport(
+            charge_density_local,
+            get_const_field(allfdistribu_advected),
+            quadrature_coeffs,
+            dt / 2);
+
+    Kokkos::DefaultExecutionSpace().fence("Fence local charge density");
+
+    // Sum the contributions of the species and velocities on the other ranks
+    MPI_Allreduce(
+            charge_density_local.data_handle(),
+            charge_density.data_handle(),
+            charge_density.size(),
+            MPI_type_descriptor_t<double>,
+            MPI_SUM,
+            m_transpose.get_comm());
+    return charge_density;
+}
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "composite_right_hand_side.hpp"
+#include "geometry_xvx.hpp"
+#include "iadvectionvx.hpp"
+#include "iadvectionx.hpp"
+#include "iboltzmannsolver.hpp"
+#include "irighthandside.hpp"
+#include "mpitransposealltoall.hpp"
+
+/**
+ * @brief A class that solves a Vlasov equation (or a Boltzmann equation if source terms
+ * are provided) using Strang's splitting on an MPI distributed mesh.
+ *
+ * The Vlasov equation is split between two advection equations
+ * along the X and Vx directions. The splitting involves solving
+ * the x-direction advection first on a time interval of length dt/2,
+ * then the vx-direction advection on a time dt, and then x-direction
+ * again on dt/2.
+ *
+ * The distribution function is provided in the VxSplit layout (distributed over
+ * the species and the velocities) where the advections along X are local. It is
+ * transposed to the XSplit layout (distributed over the species and the spatial
+ * positions) for the advection along Vx and transposed back, so each timestep
+ * requires two transposes.
+ *
+ * Source terms (collisions, Krook and kinetic sources) may also be provided. They
+ * integrate the distribution function over the velocities so they are applied in the
+ * XSplit layout where all the velocities are local. The sources are applied on dt/2
+ * before and after the advection along vx. This is a symmetric splitting of the advection
+ * along x and of the split (sources, advection along vx) operator so it remains second
+ * order accurate without any additional transposes. The sources must be created on the
+ * local index range of the XSplit layout.
+ */
+class MpiSplitVlasovSolver : public IBoltzmannSolver
+{
+    /** Member advection operator in the x direction*/
+    IAdvectionSpatial<GeometryXVx, GridX> const& m_advec_x;
+
+    /** Member advection operator in the vx direction*/
+    IAdvectionVelocity<GeometryXVx, GridVx> const& m_advec_vx;
+
+    /** MPI transpose operator */
+    MPITransposeAllToAll<XSplit, VxSplit> const& m_transpose;
+
+    /** Member applying the source terms in the XSplit layout. */
+    CompositeRightHandSide m_rhs;
+
+    /** Buffer for the distribution function in the XSplit layout. */
+    mutable DFieldMemSpXVx m_allfdistribu_xsplit_alloc;
+
+    /** Buffer for the electric field on the local spatial positions of the XSplit layout. */
+    mutable DFieldMemX m_local_electric_field_alloc;
+
+public:
+    /**
+     * @brief Creates an instance of the split vlasov solver class.
+     * @param[in] advec_x An advection operator along the x direction.
+     * @param[in] advec_vx An advection operator along the vx direction.
+     * @param[in] transpose A MPI transpose operator to move between layouts.
+     * @param[in] rhs A vector containing the source terms of the Boltzmann equation. They
+     *                  are applied to the local part of the distribution function in the
+     *                  XSplit layout.
+     */
+    MpiSplitVlasovSolver(
+            IAdvectionSpatial<GeometryXVx, GridX> const& advec_x,
+            IAdvectionVelocity<GeometryXVx, GridVx> const& advec_vx,
+            MPITransposeAllToAll<XSplit, VxSplit> const& transpose,
+            std::vector<std::reference_wrapper<IRightHandSide const>> rhs = {});
+
+    ~MpiSplitVlasovSolver() override = default;
+
+    /**
+     * @brief Solves a Vlasov equation on a timestep dt.
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function
+     *                              in the VxSplit layout.
+     *                              On output : the value of the distribution function after
+     *                              solving the Vlasov equation.
+     * @param[in] electric_field The electric field computed at all spatial positions. 
+     * @param[in] dt The timestep. 
+     * @return The distribution function after solving the Vlasov equation.
+     */
+    DFieldSpXVx operator()(DFieldSpXVx allfdistribu, DConstFieldX electric_field, double dt)
+            const override;
+
+    /**
+     * @brief Computes the charge density of the solution of the Vlasov equation after a
+     * timestep dt without modifying the distribution function.
+     *
+     * The advections are applied to a copy of the distribution function. The last
+     * advection along x is fused with the integral over the local velocities and the
+     * result is summed over the MPI ranks.
+     *
+     * @param[out] charge_density The charge density of the distribution function at the end
+     *                              of the timestep.
+     * @param[in] allfdistribu The value of the distribution function at the start of the
+     *                              timestep in the VxSplit layout.
+     * @param[in] electric_field The electric field computed at all spatial positions.
+     * @param[in] quadrature_coeffs The coefficients of the quadrature over the local
+     *                              velocities of the VxSplit layout.
+     * @param[in] dt The timestep.
+     * @return The charge density at the end of the timestep.
+     */
+    DFieldX charge_density_after_step(
+            DFieldX charge_density,
+            DConstFieldSpXVx allfdistribu,
+            DConstFieldX electric_field,
+            DConstFieldVx quadrature_coeffs,
+            double dt) const override;
+
+private:
+    /**
+     * @brief Carry out the advection along vx and the sources in the XSplit layout.
+     *
+     * @param[in, out] allfdistribu_vxsplit The distribution function in the VxSplit layout.
+     * @param[in] electric_field The electric field computed at all spatial positions.
+     * @param[in] dt The timestep.
+     */
+    void advect_velocity(DFieldSpXVx allfdistribu_vxsplit, DConstFieldX electric_field, double dt)
+            const;
+};
@@ -3,9 +3,13 @@
 #include <utility>
 #include <vector>
 
+#include "composite_right_hand_side.hpp"
+#include "ddc_alias_inline_functions.hpp"
 #include "geometry_xvx.hpp"
 #include "iboltzmannsolver.hpp"
 #include "irighthandside.hpp"
+#include "quadrature.hpp"
+#include "species_info.hpp"
 #include "splitrighthandsidesolver.hpp"
 
 SplitRightHandSideSolver::SplitRightHandSideSolver(
@@ -21,13 +25,38 @@ DFieldSpXVx SplitRightHandSideSolver::operator()(
         DConstFieldX const electric_field,
         double const dt) const
 {
-    for (IRightHandSide const& rhsit : m_rhs) {
-        rhsit(allfdistribu, dt / 2.);
-    }
+    m_rhs(allfdistribu, dt / 2.);
     m_boltzmann_solver(allfdistribu, electric_field, dt);
-    for (IRightHandSide const& rhsit : m_rhs) {
-        rhsit(allfdistribu, dt / 2.);
-    }
+    m_rhs(allfdistribu, dt / 2.);
 
     return allfdistribu;
 }
+
+DFieldX SplitRightHandSideSolver::charge_density_after_step(
+        DFieldX const charge_density,
+        DConstFieldSpXVx const allfdistribu,
+        DConstFieldX const electric_field,
+        DConstFieldVx const quadrature_coeffs,
+        double const dt) const
+{
+    DFieldMemSpXVx allfdistribu_advanced_alloc(
+            "allfdistribu_advanced (SplitRightHandSideSolver::charge_density_after_step())",
+            get_idx_range(allfdistribu));
+    DFieldSpXVx allfdistribu_advanced = get_field(allfdistribu_advanced_alloc);
+    ddc::parallel_deepcopy(allfdistribu_advanced, allfdistribu);
+    (*this)(allfdistribu_advanced, electric_field, dt);
+
+    IdxRangeSp const kin_species_idx_range = get_idx_range<Species>(allfdistribu);
+    Quadrature<IdxRangeVx, IdxRangeXVx> const integrate_v(quadrature_coeffs);
+    integrate_v(
+            Kokkos::DefaultExecutionSpace(),
+            charge_density,
+            KOKKOS_LAMBDA(IdxXVx const ixvx) {
+                double sum = 0.0;
+                for (IdxSp const isp : kin_species_idx_range) {
+                    sum += charge(isp) * allfdistribu_advanced(isp, ixvx);
+                }
+                return sum;
+            });
+    return charge_density;
+}
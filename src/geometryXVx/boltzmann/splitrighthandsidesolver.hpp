@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "composite_right_hand_side.hpp"
 #include "geometry_xvx.hpp"
 #include "iboltzmannsolver.hpp"
 #include "irighthandside.hpp"
@@ -19,14 +20,18 @@
  * source terms on a dt/2 timestep, then solving the advections on a dt
  * timestep using a Vlasov solver, then solving the sources again on dt/2
  * in reverse order. 
+ *
+ * The source terms are applied through a CompositeRightHandSide, so consecutive
+ * sources which act pointwise (Krook sources, kinetic sources) are applied in a
+ * single pass over the distribution function.
  */
 class SplitRightHandSideSolver : public IBoltzmannSolver
 {
     /** Member solver for the Vlasov equation. */
     IBoltzmannSolver const& m_boltzmann_solver;
 
-    /** Member vector containing the source terms. */
-    std::vector<std::reference_wrapper<IRightHandSide const>> m_rhs;
+    /** Member applying the source terms. */
+    CompositeRightHandSide m_rhs;
 
 public:
     /**
@@ -53,4 +58,26 @@ public:
      */
     DFieldSpXVx operator()(DFieldSpXVx allfdistribu, DConstFieldX electric_field, double dt)
             const override;
+
+    /**
+     * @brief Computes the charge density of the solution of the Boltzmann equation after a
+     * timestep dt without modifying the distribution function.
+     *
+     * The last operation of the splitting is a source term, not an advection, so the
+     * distribution function is advanced on a copy before its charge density is computed.
+     *
+     * @param[out] charge_density The charge density of the distribution function at the end
+     *                              of the timestep.
+     * @param[in] allfdistribu The value of the distribution function at the start of the timestep.
+     * @param[in] electric_field The electric field computed at all spatial positions.
+     * @param[in] quadrature_coeffs The coefficients of the quadrature over the velocity space.
+     * @param[in] dt The timestep.
+     * @return The charge density at the end of the timestep.
+     */
+    DFieldX charge_density_after_step(
+            DFieldX charge_density,
+            DConstFieldSpXVx allfdistribu,
+            DConstFieldX electric_field,
+            DConstFieldVx quadrature_coeffs,
+            double dt) const override;
 };
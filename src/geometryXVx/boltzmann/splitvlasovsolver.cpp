@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: MIT
 
+#include "ddc_alias_inline_functions.hpp"
 #include "iadvectionvx.hpp"
 #include "iadvectionx.hpp"
 #include "splitvlasovsolver.hpp"
@@ -22,3 +23,41 @@ DFieldSpXVx SplitVlasovSolver::operator()(
     m_advec_x(allfdistribu, dt / 2);
     return allfdistribu;
 }
+
+DFieldX SplitVlasovSolver::charge_density_after_step(
+        DFieldX const charge_density,
+        DConstFieldSpXVx const allfdistribu,
+        DConstFieldX const electric_field,
+        DConstFieldVx const quadrature_coeffs,
+        double const dt) const
+{
+    IdxRangeXVx const idx_range_xvx(get_idx_range(allfdistribu));
+    DFieldMem<IdxRangeXVx> fdistribu_species_alloc(
+            "fdistribu_species (SplitVlasovSolver::charge_density_after_step())",
+            idx_range_xvx);
+    DFieldMemX charge_density_species_alloc(
+            "charge_density_species (SplitVlasovSolver::charge_density_after_step())",
+            get_idx_range(charge_density));
+    DFieldX charge_density_species = get_field(charge_density_species_alloc);
+
+    ddc::parallel_fill(charge_density, 0.0);
+    for (IdxSp const isp : get_idx_range<Species>(allfdistribu)) {
+        IdxRangeSpXVx const idx_range_isp(IdxRangeSp(isp, IdxStepSp(1)), idx_range_xvx);
+        DFieldSpXVx fdistribu_isp(fdistribu_species_alloc.data_handle(), idx_range_isp);
+        ddc::parallel_deepcopy(fdistribu_isp, allfdistribu[idx_range_isp]);
+        m_advec_x(fdistribu_isp, dt / 2);
+        m_advec_vx(fdistribu_isp, electric_field, dt);
+        m_advec_x.charge_density_after_transport(
+                charge_density_species,
+                get_const_field(fdistribu_isp),
+                quadrature_coeffs,
+                dt / 2);
+        const std::source_location location = std::source_location::current();
+        ddc::parallel_for_each(
+                location.function_name(),
+                Kokkos::DefaultExecutionSpace(),
+                get_idx_range(charge_density),
+                KOKKOS_LAMBDA(IdxX const ix) { charge_density(ix) += charge_density_species(ix); });
+    }
+    return charge_density;
+}
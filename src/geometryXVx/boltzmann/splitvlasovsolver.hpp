@@ -47,4 +47,27 @@ public:
      */
     DFieldSpXVx operator()(DFieldSpXVx allfdistribu, DConstFieldX electric_field, double dt)
             const override;
+
+    /**
+     * @brief Computes the charge density of the solution of the Vlasov equation after a
+     * timestep dt without modifying the distribution function.
+     *
+     * Each species is copied into a buffer where the first two advections are applied.
+     * The last advection along x is fused with the velocity integral so the distribution
+     * function at the end of the timestep is never stored.
+     *
+     * @param[out] charge_density The charge density of the distribution function at the end
+     *                              of the timestep.
+     * @param[in] allfdistribu The value of the distribution function at the start of the timestep.
+     * @param[in] electric_field The electric field computed at all spatial positions.
+     * @param[in] quadrature_coeffs The coefficients of the quadrature over the velocity space.
+     * @param[in] dt The timestep.
+     * @return The charge density at the end of the timestep.
+     */
+    DFieldX charge_density_after_step(
+            DFieldX charge_density,
+            DConstFieldSpXVx allfdistribu,
+            DConstFieldX electric_field,
+            DConstFieldVx quadrature_coeffs,
+            double dt) const override;
 };
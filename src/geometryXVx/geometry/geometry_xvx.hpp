@@ -7,6 +7,7 @@
 #include "ddc_aliases.hpp"
 #include "ddc_helper.hpp"
 #include "moments.hpp"
+#include "mpilayout.hpp"
 #include "non_uniform_interpolation_points.hpp"
 #include "species_info.hpp"
 
@@ -253,6 +254,10 @@ using DConstFieldSpVx = ConstFieldSpVx<double>;
 
 using DConstFieldSpXVx = ConstFieldSpXVx<double>;
 
+/// The MPI layout used for the advections along Vx (the Vx dimension is not distributed).
+using XSplit = MPILayout<IdxRangeSpXVx, Species, GridX>;
+/// The MPI layout used for the advections along X (the X dimension is not distributed).
+using VxSplit = MPILayout<IdxRangeSpXVx, Species, GridVx>;
 
 /**
  * @brief A class providing aliases for useful subindex ranges of the geometry. It is used as template parameter for generic dimensionality-agnostic operators such as advections.
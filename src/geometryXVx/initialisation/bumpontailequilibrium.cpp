@@ -19,23 +19,35 @@ DFieldSpVx BumpontailEquilibrium::operator()(DFieldSpVx const allfequilibrium) c
     IdxRangeVx const gridvx = get_idx_range<GridVx>(allfequilibrium);
     IdxRangeSp const gridsp = get_idx_range<Species>(allfequilibrium);
 
-    // Initialisation of the maxwellian
-    DFieldMemVx maxwellian_alloc("maxwellian (BumpontailEquilibrium::operator())", gridvx);
-    DFieldVx maxwellian = get_field(maxwellian_alloc);
-    ddc::host_for_each(gridsp, [&](IdxSp const isp) {
-        compute_twomaxwellian(
-                maxwellian,
-                m_epsilon_bot(isp),
-                m_temperature_bot(isp),
-                m_mean_velocity_bot(isp));
+    // The parameters of all the species are copied to the device so the distribution
+    // functions of all the species are computed in a single kernel
+    auto epsilon_bot_alloc = ddc::create_mirror_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            get_const_field(m_epsilon_bot));
+    auto temperature_bot_alloc = ddc::create_mirror_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            get_const_field(m_temperature_bot));
+    auto mean_velocity_bot_alloc = ddc::create_mirror_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            get_const_field(m_mean_velocity_bot));
+    DConstFieldSp epsilon_bot = get_const_field(epsilon_bot_alloc);
+    DConstFieldSp temperature_bot = get_const_field(temperature_bot_alloc);
+    DConstFieldSp mean_velocity_bot = get_const_field(mean_velocity_bot_alloc);
 
-        const std::source_location location = std::source_location::current();
-        ddc::parallel_for_each(
-                location.function_name(),
-                Kokkos::DefaultExecutionSpace(),
-                gridvx,
-                KOKKOS_LAMBDA(IdxVx const ivx) { allfequilibrium(isp, ivx) = maxwellian(ivx); });
-    });
+    const std::source_location location = std::source_location::current();
+    ddc::parallel_for_each(
+            location.function_name(),
+            Kokkos::DefaultExecutionSpace(),
+            IdxRangeSpVx(gridsp, gridvx),
+            KOKKOS_LAMBDA(IdxSpVx const ispvx) {
+                IdxSp const isp(ispvx);
+                CoordVx const vx = ddc::coordinate(IdxVx(ispvx));
+                allfequilibrium(ispvx) = twomaxwellian(
+                        vx,
+                        epsilon_bot(isp),
+                        temperature_bot(isp),
+                        mean_velocity_bot(isp));
+            });
     return allfequilibrium;
 }
 
@@ -68,8 +80,6 @@ void BumpontailEquilibrium::compute_twomaxwellian(
         double const temperature_bot,
         double const mean_velocity_bot) const
 {
-    double const inv_sqrt_2pi = 1. / sqrt(2. * M_PI);
-    double const norm_f2 = inv_sqrt_2pi / sqrt(temperature_bot);
     IdxRangeVx const gridvx = get_idx_range(fMaxwellian);
     const std::source_location location = std::source_location::current();
     ddc::parallel_for_each(
@@ -78,14 +88,7 @@ void BumpontailEquilibrium::compute_twomaxwellian(
             gridvx,
             KOKKOS_LAMBDA(IdxVx const ivx) {
                 CoordVx const vx = ddc::coordinate(ivx);
-                // bulk plasma particles
-                double const f1_v = (1. - epsilon_bot) * inv_sqrt_2pi * Kokkos::exp(-0.5 * vx * vx);
-                // beam
-                double const f2_v = epsilon_bot * norm_f2
-                                    * (Kokkos::exp(
-                                            -(vx - mean_velocity_bot) * (vx - mean_velocity_bot)
-                                            / (2. * temperature_bot)));
-                // fM(v) = f1(v) + f2(v)
-                fMaxwellian(ivx) = f1_v + f2_v;
+                fMaxwellian(ivx)
+                        = twomaxwellian(vx, epsilon_bot, temperature_bot, mean_velocity_bot);
             });
 }
@@ -47,6 +47,32 @@ public:
             double epsilon_bot,
             double temperature_bot,
             double mean_velocity_bot) const;
+
+    /**
+     * @brief Evaluate the sum of two Maxwellians defined in compute_twomaxwellian.
+     * @param[in] vx The velocity at which the distribution function is evaluated.
+     * @param[in] epsilon_bot A parameter that represents the density of the bump-on-tail Maxwellian. 
+     * @param[in] temperature_bot A parameter that represents the temperature of the bump-on-tail Maxwellian. 
+     * @param[in] mean_velocity_bot A parameter that represents the mean velocity of the bump-on-tail Maxwellian. 
+     * @return The value of the distribution function at vx.
+     */
+    static KOKKOS_INLINE_FUNCTION double twomaxwellian(
+            double const vx,
+            double const epsilon_bot,
+            double const temperature_bot,
+            double const mean_velocity_bot)
+    {
+        double const inv_sqrt_2pi = 1. / Kokkos::sqrt(2. * M_PI);
+        // bulk plasma particles
+        double const f1_v = (1. - epsilon_bot) * inv_sqrt_2pi * Kokkos::exp(-0.5 * vx * vx);
+        // beam
+        double const f2_v = epsilon_bot * inv_sqrt_2pi / Kokkos::sqrt(temperature_bot)
+                            * Kokkos::exp(
+                                    -(vx - mean_velocity_bot) * (vx - mean_velocity_bot)
+                                    / (2. * temperature_bot));
+        // fM(v) = f1(v) + f2(v)
+        return f1_v + f2_v;
+    }
     /**
      * @brief Creates an instance of the BumpontailEquilibrium class.
      * @param[in] epsilon_bot A parameter that represents the density of the bump-on-tail Maxwellian for each species. 
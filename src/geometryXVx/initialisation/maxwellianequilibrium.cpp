@@ -19,23 +19,35 @@ DFieldSpVx MaxwellianEquilibrium::operator()(DFieldSpVx const allfequilibrium) c
     IdxRangeVx const gridvx = get_idx_range<GridVx>(allfequilibrium);
     IdxRangeSp const gridsp = get_idx_range<Species>(allfequilibrium);
 
-    // Initialisation of the maxwellian
-    DFieldMemVx maxwellian_alloc("maxwellian (MaxwellianEquilibrium::operator())", gridvx);
-    DFieldVx maxwellian = get_field(maxwellian_alloc);
-    ddc::host_for_each(gridsp, [&](IdxSp const isp) {
-        compute_maxwellian(
-                maxwellian,
-                m_density_eq(isp),
-                m_temperature_eq(isp),
-                m_mean_velocity_eq(isp));
+    // The parameters of all the species are copied to the device so the Maxwellians of all
+    // the species are computed in a single kernel
+    auto density_eq_alloc = ddc::create_mirror_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            get_const_field(m_density_eq));
+    auto temperature_eq_alloc = ddc::create_mirror_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            get_const_field(m_temperature_eq));
+    auto mean_velocity_eq_alloc = ddc::create_mirror_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            get_const_field(m_mean_velocity_eq));
+    DConstFieldSp density_eq = get_const_field(density_eq_alloc);
+    DConstFieldSp temperature_eq = get_const_field(temperature_eq_alloc);
+    DConstFieldSp mean_velocity_eq = get_const_field(mean_velocity_eq_alloc);
 
-        const std::source_location location = std::source_location::current();
-        ddc::parallel_for_each(
-                location.function_name(),
-                Kokkos::DefaultExecutionSpace(),
-                gridvx,
-                KOKKOS_LAMBDA(IdxVx const ivx) { allfequilibrium(isp, ivx) = maxwellian(ivx); });
-    });
+    const std::source_location location = std::source_location::current();
+    ddc::parallel_for_each(
+            location.function_name(),
+            Kokkos::DefaultExecutionSpace(),
+            IdxRangeSpVx(gridsp, gridvx),
+            KOKKOS_LAMBDA(IdxSpVx const ispvx) {
+                IdxSp const isp(ispvx);
+                CoordVx const vx = ddc::coordinate(IdxVx(ispvx));
+                allfequilibrium(ispvx) = maxwellian(
+                        vx,
+                        density_eq(isp),
+                        temperature_eq(isp),
+                        mean_velocity_eq(isp));
+            });
     return allfequilibrium;
 }
 
@@ -47,7 +59,6 @@ void MaxwellianEquilibrium::compute_maxwellian(
         double const temperature,
         double const mean_velocity)
 {
-    double const inv_sqrt_2piT = 1. / Kokkos::sqrt(2. * M_PI * temperature);
     IdxRangeVx const gridvx = get_idx_range(fMaxwellian);
     const std::source_location location = std::source_location::current();
     ddc::parallel_for_each(
@@ -56,10 +67,7 @@ void MaxwellianEquilibrium::compute_maxwellian(
             gridvx,
             KOKKOS_LAMBDA(IdxVx const ivx) {
                 CoordVx const vx = ddc::coordinate(ivx);
-                fMaxwellian(ivx) = density * inv_sqrt_2piT
-                                   * Kokkos::exp(
-                                           -(vx - mean_velocity) * (vx - mean_velocity)
-                                           / (2. * temperature));
+                fMaxwellian(ivx) = maxwellian(vx, density, temperature, mean_velocity);
             });
 }
 
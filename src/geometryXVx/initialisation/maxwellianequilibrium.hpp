@@ -71,6 +71,24 @@ public:
             double const temperature,
             double const mean_velocity);
 
+    /**
+     * @brief Evaluate the Maxwellian distribution function defined in compute_maxwellian.
+     * @param[in] vx The velocity at which the Maxwellian is evaluated.
+     * @param[in] density The density of the Maxwellian.
+     * @param[in] temperature The temperature of the Maxwellian.
+     * @param[in] mean_velocity The mean velocity of the Maxwellian.
+     * @return The value of the Maxwellian at vx.
+     */
+    static KOKKOS_INLINE_FUNCTION double maxwellian(
+            double const vx,
+            double const density,
+            double const temperature,
+            double const mean_velocity)
+    {
+        return density / Kokkos::sqrt(2. * M_PI * temperature)
+               * Kokkos::exp(-(vx - mean_velocity) * (vx - mean_velocity) / (2. * temperature));
+    }
+
     /**
      * @brief A method for accessing the m_density_eq member variable of the class.
      * @return A view containing the m_density_eq value. 
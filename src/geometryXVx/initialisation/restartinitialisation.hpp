@@ -15,6 +15,10 @@
  * a distribution function saved in a hdf5 file. These
  * values are copied to the field that represents the 
  * distribution function. 
+ *
+ * Only the part of the saved distribution function on the local index range
+ * of allfdistribu is read so the simulation can be restarted on a different
+ * number of MPI processes.
  */
 class RestartInitialisation : public IInitialisation
 {
@@ -18,37 +18,39 @@ SingleModePerturbInitialisation::SingleModePerturbInitialisation(
 
 DFieldSpXVx SingleModePerturbInitialisation::operator()(DFieldSpXVx const allfdistribu) const
 {
-    IdxRangeSp const gridsp = get_idx_range<Species>(allfdistribu);
     IdxRangeX const gridx = get_idx_range<GridX>(allfdistribu);
-    IdxRangeXVx const gridxvx = get_idx_range<GridX, GridVx>(allfdistribu);
+    double const Lx = ddcHelper::total_interval_length(gridx);
 
-    // Initialisation of the perturbation
-    DFieldMemX
-            perturbation_alloc("perturbation (SingleModePerturbInitialisation::operator())", gridx);
+    // The parameters of all the species are copied to the device so the distribution
+    // functions of all the species are initialised in a single kernel
+    auto init_perturb_mode_alloc = ddc::create_mirror_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            get_const_field(m_init_perturb_mode));
+    auto init_perturb_amplitude_alloc = ddc::create_mirror_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            get_const_field(m_init_perturb_amplitude));
+    ConstFieldSp<int> init_perturb_mode = get_const_field(init_perturb_mode_alloc);
+    DConstFieldSp init_perturb_amplitude = get_const_field(init_perturb_amplitude_alloc);
     DConstFieldSpVx fequilibrium_proxy = get_const_field(m_fequilibrium);
-    DFieldX perturbation_proxy = get_field(perturbation_alloc);
-    ddc::host_for_each(gridsp, [&](IdxSp const isp) {
-        perturbation_initialisation(
-                perturbation_proxy,
-                m_init_perturb_mode(isp),
-                m_init_perturb_amplitude(isp));
-        // Initialisation of the distribution function --> fill values
-        const std::source_location location = std::source_location::current();
-        ddc::parallel_for_each(
-                location.function_name(),
-                Kokkos::DefaultExecutionSpace(),
-                gridxvx,
-                KOKKOS_LAMBDA(IdxXVx const ixvx) {
-                    IdxX const ix = ddc::select<GridX>(ixvx);
-                    IdxVx const ivx = ddc::select<GridVx>(ixvx);
-                    double fdistribu_val
-                            = fequilibrium_proxy(isp, ivx) * (1. + perturbation_proxy(ix));
-                    if (fdistribu_val < 1.e-60) {
-                        fdistribu_val = 1.e-60;
-                    }
-                    allfdistribu(isp, ix, ivx) = fdistribu_val;
-                });
-    });
+
+    // Initialisation of the distribution function --> fill values
+    const std::source_location location = std::source_location::current();
+    ddc::parallel_for_each(
+            location.function_name(),
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(allfdistribu),
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                IdxSp const isp(ispxvx);
+                CoordX const x = ddc::coordinate(IdxX(ispxvx));
+                double const kx = init_perturb_mode(isp) * 2. * M_PI / Lx;
+                double const perturbation = init_perturb_amplitude(isp) * Kokkos::cos(kx * x);
+                double fdistribu_val
+                        = fequilibrium_proxy(isp, IdxVx(ispxvx)) * (1. + perturbation);
+                if (fdistribu_val < 1.e-60) {
+                    fdistribu_val = 1.e-60;
+                }
+                allfdistribu(ispxvx) = fdistribu_val;
+            });
     return allfdistribu;
 }
 
@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: MIT
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "mpichargedensitycalculator.hpp"
+#include "mpitools.hpp"
+
+MpiChargeDensityCalculator::MpiChargeDensityCalculator(
+        MPI_Comm comm,
+        IChargeDensityCalculator const& local_charge_density_calculator)
+    : m_local_charge_density_calculator(local_charge_density_calculator)
+    , m_comm(comm)
+{
+}
+
+DFieldX MpiChargeDensityCalculator::operator()(
+        DFieldX const rho,
+        DConstFieldSpXVx const allfdistribu) const
+{
+    Kokkos::Profiling::pushRegion("(GSLX) MpiChargeDensityCalculator");
+
+    DFieldMemX rho_local_alloc(
+            "rho_local (MpiChargeDensityCalculator::operator())",
+            get_idx_range(rho));
+    DFieldX rho_local = get_field(rho_local_alloc);
+
+    m_local_charge_density_calculator(rho_local, allfdistribu);
+
+    Kokkos::DefaultExecutionSpace().fence("Fence local ChargeDensityCalculator");
+
+    MPI_Allreduce(
+            rho_local.data_handle(),
+            rho.data_handle(),
+            rho.size(),
+            MPI_type_descriptor_t<double>,
+            MPI_SUM,
+            m_comm);
+
+    Kokkos::Profiling::popRegion();
+
+    return rho;
+}
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <mpi.h>
+
+#include <ddc/ddc.hpp>
+
+#include "geometry_xvx.hpp"
+#include "ichargedensitycalculator.hpp"
+
+/**
+ * @brief A class which computes the charge density of a distribution function
+ * distributed across MPI ranks.
+ *
+ * A class which computes charges density by solving the equation:
+ * @f$ \sum_s \int_{v} q_s f_s(x,v) dv @f$
+ * where @f$ q_s @f$ is the charge of the species @f$ s @f$ and
+ * @f$ f_s(x,v) @f$ is the distribution function.
+ * Each rank computes the contribution of its species and velocities with a local
+ * charge density calculator and the contributions are summed across the ranks.
+ * The spatial dimension must not be distributed (e.g. VxSplit layout).
+ */
+class MpiChargeDensityCalculator : public IChargeDensityCalculator
+{
+private:
+    IChargeDensityCalculator const& m_local_charge_density_calculator;
+    MPI_Comm m_comm;
+
+public:
+    /**
+     * @brief Create a MpiChargeDensityCalculator object.
+     * @param[in] comm The MPI communicator across which the calculation is carried out.
+     * @param[in] local_charge_density_calculator
+     *                 An operator which calculates the density locally
+     *                 on a given MPI node. The results from this operator
+     *                 will then be combined using MPI.
+     */
+    MpiChargeDensityCalculator(
+            MPI_Comm comm,
+            IChargeDensityCalculator const& local_charge_density_calculator);
+
+    /**
+     * @brief Computes the charge density rho from the distribution function.
+     * @param[in, out] rho
+     * @param[in] allfdistribu 
+     *
+     * @return rho The charge density.
+     */
+    DFieldX operator()(DFieldX rho, DConstFieldSpXVx allfdistribu) const final;
+};
@@ -7,13 +7,46 @@
 #include "collisions_utils.hpp"
 #include "fluid_moments.hpp"
 #include "maxwellianequilibrium.hpp"
-#include "rk2.hpp"
+#include "species_info.hpp"
 
-CollisionsInter::CollisionsInter(IdxRangeSpXVx const& mesh, double nustar0)
+CollisionsInter::CollisionsInter(
+        IdxRangeSpXVx const& mesh,
+        double nustar0,
+        CollisionsInterMethod method,
+        int nb_substeps)
     : m_nustar0(nustar0)
+    , m_method(method)
+    , m_nb_substeps(nb_substeps)
     , m_nustar_profile_alloc(
               "m_nustar_profile (CollisionsInter::CollisionsInter)",
               ddc::select<Species, GridX>(mesh))
+    , m_quadrature_coeffs_alloc(trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(
+              ddc::select<GridVx>(mesh)))
+    , m_timestepper(mesh)
+    , m_density_alloc(
+              "density (CollisionsInter::CollisionsInter)",
+              ddc::select<Species, GridX>(mesh))
+    , m_fluid_velocity_alloc(
+              "fluid_velocity (CollisionsInter::CollisionsInter)",
+              ddc::select<Species, GridX>(mesh))
+    , m_temperature_alloc(
+              "temperature (CollisionsInter::CollisionsInter)",
+              ddc::select<Species, GridX>(mesh))
+    , m_fluid_velocity_new_alloc(
+              "fluid_velocity_new (CollisionsInter::CollisionsInter)",
+              ddc::select<Species, GridX>(mesh))
+    , m_temperature_new_alloc(
+              "temperature_new (CollisionsInter::CollisionsInter)",
+              ddc::select<Species, GridX>(mesh))
+    , m_collfreq_ab_alloc(
+              "collfreq_ab (CollisionsInter::CollisionsInter)",
+              ddc::select<Species, GridX>(mesh))
+    , m_momentum_exchange_ab_alloc(
+              "momentum_exchange_ab (CollisionsInter::CollisionsInter)",
+              ddc::select<Species, GridX>(mesh))
+    , m_energy_exchange_ab_alloc(
+              "energy_exchange_ab (CollisionsInter::CollisionsInter)",
+              ddc::select<Species, GridX>(mesh))
 {
     // validity checks
     if (ddc::select<Species>(mesh).size() != 2) {
@@ -22,31 +55,25 @@ CollisionsInter::CollisionsInter(IdxRangeSpXVx const& mesh, double nustar0)
     if (m_nustar0 == 0.) {
         throw std::invalid_argument("Collision operator should not be used with nustar0=0.");
     }
+    if (m_nb_substeps < 1) {
+        throw std::invalid_argument("The number of sub-steps should be strictly positive.");
+    }
 
     m_nustar_profile = get_field(m_nustar_profile_alloc);
     compute_nustar_profile(m_nustar_profile, m_nustar0);
     ddc::expose_to_pdi("collinter_nustar0", m_nustar0);
 }
 
-void CollisionsInter::get_derivative(DFieldSpXVx const df, DConstFieldSpXVx const allfdistribu)
-        const
+void CollisionsInter::compute_moments(DConstFieldSpXVx const allfdistribu) const
 {
     IdxRangeSpX grid_sp_x = get_idx_range<Species, GridX>(allfdistribu);
-    DFieldMemSpX density_f(grid_sp_x);
-    DFieldMemSpX fluid_velocity_f(grid_sp_x);
-    DFieldMemSpX temperature_f(grid_sp_x);
-    DFieldSpX density = get_field(density_f);
-    DFieldSpX fluid_velocity = get_field(fluid_velocity_f);
-    DFieldSpX temperature = get_field(temperature_f);
+    DFieldSpX density = get_field(m_density_alloc);
+    DFieldSpX fluid_velocity = get_field(m_fluid_velocity_alloc);
+    DFieldSpX temperature = get_field(m_temperature_alloc);
 
     IdxRangeVx const idx_range_vx(get_idx_range<GridVx>(allfdistribu));
+    DConstFieldVx quadrature_coeffs = get_const_field(m_quadrature_coeffs_alloc);
 
-    DFieldMemVx quadrature_coeffs_alloc(
-            trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(idx_range_vx));
-    DFieldVx quadrature_coeffs = get_field(quadrature_coeffs_alloc);
-
-    //Moments computation
-    ddc::parallel_fill(density, 0.);
     const std::source_location location = std::source_location::current();
     ddc::parallel_for_each(
             location.function_name(),
@@ -55,48 +82,50 @@ void CollisionsInter::get_derivative(DFieldSpXVx const df, DConstFieldSpXVx cons
             KOKKOS_LAMBDA(IdxSpX const ispx) {
                 IdxSp isp(ddc::select<Species>(ispx));
                 IdxX ix(ddc::select<GridX>(ispx));
+                double particle_density(0);
                 double particle_flux(0);
                 double momentum_flux(0);
                 for (IdxVx ivx : idx_range_vx) {
                     CoordVx const coordv = ddc::coordinate(ivx);
                     double const val(quadrature_coeffs(ivx) * allfdistribu(isp, ix, ivx));
-                    density(isp, ix) += val;
+                    particle_density += val;
                     particle_flux += val * coordv;
                     momentum_flux += val * coordv * coordv;
                 }
-                fluid_velocity(isp, ix) = particle_flux / density(isp, ix);
+                density(isp, ix) = particle_density;
+                fluid_velocity(isp, ix) = particle_flux / particle_density;
                 temperature(isp, ix) = (momentum_flux - particle_flux * fluid_velocity(isp, ix))
-                                       / density(isp, ix);
+                                       / particle_density;
             });
+}
 
+void CollisionsInter::get_derivative(DFieldSpXVx const df, DConstFieldSpXVx const allfdistribu)
+        const
+{
+    //Moments computation
+    compute_moments(allfdistribu);
+    DConstFieldSpX density = get_const_field(m_density_alloc);
+    DConstFieldSpX fluid_velocity = get_const_field(m_fluid_velocity_alloc);
+    DConstFieldSpX temperature = get_const_field(m_temperature_alloc);
 
     //Collision frequencies, momentum and energy exchange terms
-    DFieldMemSpX collfreq_ab("collfreq_ab (CollisionsInter::get_derivative)", grid_sp_x);
-    DFieldMemSpX momentum_exchange_ab_alloc(
-            "momentum_exchange_ab (CollisionsInter::get_derivative)",
-            grid_sp_x);
-    DFieldMemSpX energy_exchange_ab_alloc(
-            "energy_exchange_ab (CollisionsInter::get_derivative)",
-            grid_sp_x);
-    DFieldSpX momentum_exchange_ab = get_field(momentum_exchange_ab_alloc);
-    DFieldSpX energy_exchange_ab = get_field(energy_exchange_ab_alloc);
+    DFieldSpX momentum_exchange_ab = get_field(m_momentum_exchange_ab_alloc);
+    DFieldSpX energy_exchange_ab = get_field(m_energy_exchange_ab_alloc);
     compute_collfreq_ab(
-            get_field(collfreq_ab),
+            get_field(m_collfreq_ab_alloc),
             get_const_field(m_nustar_profile),
-            get_const_field(density),
-            get_const_field(temperature));
+            density,
+            temperature);
     compute_momentum_energy_exchange(
             momentum_exchange_ab,
             energy_exchange_ab,
-            get_const_field(collfreq_ab),
-            get_const_field(density),
-            get_const_field(fluid_velocity),
-            get_const_field(temperature));
-
-    DFieldMemSpXVx fmaxwellian_alloc(
-            "fmaxwellian (CollisionsInter::get_derivative)",
-            get_idx_range(allfdistribu));
-    DFieldSpXVx fmaxwellian = get_field(fmaxwellian_alloc);
+            get_const_field(m_collfreq_ab_alloc),
+            density,
+            fluid_velocity,
+            temperature);
+
+    // The maxwellian is computed where it is used to avoid storing it
+    const std::source_location location = std::source_location::current();
     ddc::parallel_for_each(
             location.function_name(),
             Kokkos::DefaultExecutionSpace(),
@@ -105,31 +134,139 @@ void CollisionsInter::get_derivative(DFieldSpXVx const df, DConstFieldSpXVx cons
                 IdxSp isp(ddc::select<Species>(ispxvx));
                 IdxX ix(ddc::select<GridX>(ispxvx));
                 IdxVx ivx(ddc::select<GridVx>(ispxvx));
-                double const inv_sqrt_2piT = 1. / Kokkos::sqrt(2. * M_PI * temperature(isp, ix));
-                CoordVx const vx = ddc::coordinate(ivx);
-                fmaxwellian(ispxvx)
-                        = density(isp, ix) * inv_sqrt_2piT
-                          * Kokkos::exp(
-                                  -(vx - fluid_velocity(isp, ix)) * (vx - fluid_velocity(isp, ix))
-                                  / (2. * temperature(isp, ix)));
+                double const coordv = ddc::coordinate(ivx);
+                double const term_v(coordv - fluid_velocity(isp, ix));
+                double const fmaxwellian = MaxwellianEquilibrium::maxwellian(
+                        coordv,
+                        density(isp, ix),
+                        temperature(isp, ix),
+                        fluid_velocity(isp, ix));
+                df(isp, ix, ivx) = (2. * energy_exchange_ab(isp, ix)
+                                            * (0.5 / temperature(isp, ix) * term_v * term_v - 0.5)
+                                    + momentum_exchange_ab(isp, ix) * term_v)
+                                   * fmaxwellian / (density(isp, ix) * temperature(isp, ix));
+            });
+}
+
+void CollisionsInter::advance_moments(
+        DFieldSpX const fluid_velocity_new,
+        DFieldSpX const temperature_new,
+        double const dt) const
+{
+    DConstFieldSpX density = get_const_field(m_density_alloc);
+    DConstFieldSpX fluid_velocity = get_const_field(m_fluid_velocity_alloc);
+    DConstFieldSpX temperature = get_const_field(m_temperature_alloc);
+    DConstFieldSpX collfreq_ab = get_const_field(m_collfreq_ab_alloc);
+
+    IdxSp const iion = find_ion(get_idx_range<Species>(density));
+    double const mass_ratio(mass(ielec()) / mass(iion));
+    double const sqrt_mass_ratio(Kokkos::sqrt(mass_ratio));
+    double const me_on_memi(mass(ielec()) / (mass(ielec()) + mass(iion)));
+    const std::source_location location = std::source_location::current();
+    ddc::parallel_for_each(
+            location.function_name(),
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range<GridX>(density),
+            KOKKOS_LAMBDA(IdxX const ix) {
+                double const density_elec = density(ielec(), ix);
+                double const density_ion = density(iion, ix);
+                double const collfreq = collfreq_ab(ielec(), ix);
+                double const velocity_elec = fluid_velocity(ielec(), ix);
+                double const velocity_ion = fluid_velocity(iion, ix);
+
+                // The velocity difference relaxes exponentially and the momentum is conserved
+                double const velocity_diff = velocity_elec - sqrt_mass_ratio * velocity_ion;
+                double const momentum = sqrt_mass_ratio * density_elec * velocity_elec
+                                        + density_ion * velocity_ion;
+                double const rate_momentum
+                        = collfreq * (1. + mass_ratio * density_elec / density_ion);
+                double const decay_momentum = Kokkos::exp(-rate_momentum * dt);
+                double const velocity_diff_new = velocity_diff * decay_momentum;
+                double const velocity_ion_new
+                        = (momentum - sqrt_mass_ratio * density_elec * velocity_diff_new)
+                          / (density_ion + mass_ratio * density_elec);
+                double const velocity_elec_new
+                        = velocity_diff_new + sqrt_mass_ratio * velocity_ion_new;
+
+                // The thermal energy increases by the friction heating 2 nu n_e (u_e - s u_i)^2
+                double const friction_heating = -collfreq * density_elec * velocity_diff
+                                                * velocity_diff
+                                                * Kokkos::expm1(-2. * rate_momentum * dt)
+                                                / rate_momentum;
+                double const thermal_energy = density_elec * temperature(ielec(), ix)
+                                              + density_ion * temperature(iion, ix)
+                                              + friction_heating;
+
+                // The temperature difference relaxes exponentially. Its friction source term
+                // is integrated with the trapezoidal rule.
+                double const inv_density_sum = 1. / density_elec + 1. / density_ion;
+                double const source_old
+                        = 2. * collfreq * density_elec * velocity_diff
+                          * (velocity_elec * inv_density_sum - velocity_diff / density_ion);
+                double const source_new
+                        = 2. * collfreq * density_elec * velocity_diff_new
+                          * (velocity_elec_new * inv_density_sum - velocity_diff_new / density_ion);
+                double const rate_energy
+                        = 6. * collfreq * me_on_memi * density_elec * inv_density_sum;
+                double const temperature_diff_new
+                        = (temperature(ielec(), ix) - temperature(iion, ix))
+                                  * Kokkos::exp(-rate_energy * dt)
+                          - 0.5 * (source_old + source_new) * Kokkos::expm1(-rate_energy * dt)
+                                    / rate_energy;
+
+                fluid_velocity_new(ielec(), ix) = velocity_elec_new;
+                fluid_velocity_new(iion, ix) = velocity_ion_new;
+                temperature_new(ielec(), ix) = (thermal_energy + density_ion * temperature_diff_new)
+                                               / (density_elec + density_ion);
+                temperature_new(iion, ix) = temperature_new(ielec(), ix) - temperature_diff_new;
             });
+}
 
+void CollisionsInter::exponential_step(DFieldSpXVx const allfdistribu, double const dt) const
+{
+    compute_moments(get_const_field(allfdistribu));
+    DConstFieldSpX density = get_const_field(m_density_alloc);
+    DConstFieldSpX fluid_velocity = get_const_field(m_fluid_velocity_alloc);
+    DConstFieldSpX temperature = get_const_field(m_temperature_alloc);
+    DFieldSpX fluid_velocity_new = get_field(m_fluid_velocity_new_alloc);
+    DFieldSpX temperature_new = get_field(m_temperature_new_alloc);
 
+    // Predictor: moments at the middle of the timestep
+    compute_collfreq_ab(
+            get_field(m_collfreq_ab_alloc),
+            get_const_field(m_nustar_profile),
+            density,
+            temperature);
+    advance_moments(fluid_velocity_new, temperature_new, 0.5 * dt);
+
+    // Corrector: full step with the collision frequency of the middle of the timestep
+    compute_collfreq_ab(
+            get_field(m_collfreq_ab_alloc),
+            get_const_field(m_nustar_profile),
+            density,
+            get_const_field(temperature_new));
+    advance_moments(fluid_velocity_new, temperature_new, dt);
+
+    // Replace the old maxwellian by the new one
+    const std::source_location location = std::source_location::current();
     ddc::parallel_for_each(
             location.function_name(),
             Kokkos::DefaultExecutionSpace(),
             get_idx_range(allfdistribu),
             KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
-                IdxSp isp(ddc::select<Species>(ispxvx));
-                IdxX ix(ddc::select<GridX>(ispxvx));
-                IdxVx ivx(ddc::select<GridVx>(ispxvx));
-                double const coordv = ddc::coordinate(ivx);
-                double const term_v(coordv - fluid_velocity(isp, ix));
-                df(isp, ix, ivx) = (2. * energy_exchange_ab(isp, ix)
-                                            * (0.5 / temperature(isp, ix) * term_v * term_v - 0.5)
-                                    + momentum_exchange_ab(isp, ix) * term_v)
-                                   * fmaxwellian(isp, ix, ivx)
-                                   / (density(isp, ix) * temperature(isp, ix));
+                IdxSpX ispx(ddc::select<Species, GridX>(ispxvx));
+                double const coordv = ddc::coordinate(ddc::select<GridVx>(ispxvx));
+                double const fmaxwellian_old = MaxwellianEquilibrium::maxwellian(
+                        coordv,
+                        density(ispx),
+                        temperature(ispx),
+                        fluid_velocity(ispx));
+                double const fmaxwellian_new = MaxwellianEquilibrium::maxwellian(
+                        coordv,
+                        density(ispx),
+                        temperature_new(ispx),
+                        fluid_velocity_new(ispx));
+                allfdistribu(ispxvx) += fmaxwellian_new - fmaxwellian_old;
             });
 }
 
@@ -137,11 +274,16 @@ void CollisionsInter::get_derivative(DFieldSpXVx const df, DConstFieldSpXVx cons
 DFieldSpXVx CollisionsInter::operator()(DFieldSpXVx allfdistribu, double dt) const
 {
     Kokkos::Profiling::pushRegion("(GSLX) CollisionsInter");
-    RK2<DFieldMemSpXVx> timestepper(get_idx_range(allfdistribu));
-
-    timestepper.update(allfdistribu, dt, [&](DFieldSpXVx dy, DConstFieldSpXVx y) {
-        get_derivative(dy, y);
-    });
+    double const dt_substep = dt / m_nb_substeps;
+    for (int istep(0); istep < m_nb_substeps; ++istep) {
+        if (m_method == CollisionsInterMethod::Explicit) {
+            m_timestepper.update(allfdistribu, dt_substep, [&](DFieldSpXVx dy, DConstFieldSpXVx y) {
+                get_derivative(dy, y);
+            });
+        } else {
+            exponential_step(allfdistribu, dt_substep);
+        }
+    }
 
     Kokkos::Profiling::popRegion();
     return allfdistribu;
@@ -9,15 +9,37 @@
 #include "geometry_xvx.hpp"
 #include "irighthandside.hpp"
 #include "quadrature.hpp"
+#include "rk2.hpp"
 #include "trapezoid_quadrature.hpp"
 
+/**
+ * @brief An enum class that allows choosing the time integration method
+ * of the inter-species collision operator.
+ */
+enum class CollisionsInterMethod {
+    /// Explicit RK2 integration of the distribution function.
+    Explicit,
+    /// Exponential integration of the fluid moments of the maxwellian parts.
+    Exponential
+};
+
 /**
  * @brief Class describing the inter-species collision operator
  * 
  * The inter-species collision operator accounts for momentum and 
  * energy transfer between the maxwellian parts of the distribution
- * function of different species. It is solved using a explicit time 
- * integrator (RK2 for instance).
+ * function of different species. It can be solved using:
+ * - an explicit time integrator (RK2) applied to the distribution function. Its stability
+ *   limit is given by the collision frequency.
+ * - an exponential integrator. The operator only modifies the maxwellian part of the
+ *   distribution function through its mean velocity and temperature. These moments are
+ *   advanced with the exact solution of the relaxation equations where the collision
+ *   frequency is evaluated at the middle of the timestep (second order). The difference
+ *   between the new and the old maxwellians is then added to the distribution function.
+ *   This method is unconditionally stable so the collisions do not limit the timestep.
+ *
+ * The timestep can also be divided into several sub-steps. The buffers used to compute
+ * the moments and the exchange terms are allocated once by the constructor.
  * 
  * The complete description of the operator can be found in [rhs docs](https://github.com/gyselax/gyselalibxx/blob/devel/doc/geometryXVx/collisions_intra_inter.pdf). 
  */
@@ -25,8 +47,22 @@ class CollisionsInter : public IRightHandSide
 {
 private:
     double m_nustar0;
+    CollisionsInterMethod m_method;
+    int m_nb_substeps;
     DFieldMemSpX m_nustar_profile_alloc;
     DFieldSpX m_nustar_profile;
+    DFieldMemVx m_quadrature_coeffs_alloc;
+    RK2<DFieldMemSpXVx> m_timestepper;
+
+    // The buffers are not part of the observable state of the operator
+    mutable DFieldMemSpX m_density_alloc;
+    mutable DFieldMemSpX m_fluid_velocity_alloc;
+    mutable DFieldMemSpX m_temperature_alloc;
+    mutable DFieldMemSpX m_fluid_velocity_new_alloc;
+    mutable DFieldMemSpX m_temperature_new_alloc;
+    mutable DFieldMemSpX m_collfreq_ab_alloc;
+    mutable DFieldMemSpX m_momentum_exchange_ab_alloc;
+    mutable DFieldMemSpX m_energy_exchange_ab_alloc;
 
 public:
     /**
@@ -34,8 +70,14 @@ public:
      *
      * @param[in] mesh The index range on which the operator will act.
      * @param[in] nustar0 The normalised collisionality.
+     * @param[in] method The time integration method.
+     * @param[in] nb_substeps The number of sub-steps into which each timestep is divided.
      */
-    CollisionsInter(IdxRangeSpXVx const& mesh, double nustar0);
+    CollisionsInter(
+            IdxRangeSpXVx const& mesh,
+            double nustar0,
+            CollisionsInterMethod method = CollisionsInterMethod::Explicit,
+            int nb_substeps = 1);
 
     /**
      * @brief Update the distribution function for inter-species collision.
@@ -70,4 +112,41 @@ public:
      * @param[in] allfdistribu The distribution function.
      */
     void get_derivative(DFieldSpXVx df, DConstFieldSpXVx allfdistribu) const;
+
+    /**
+     * @brief Compute the density, the mean velocity and the temperature of each species.
+     *
+     * The moments are saved in the internal buffers.
+     * This function should be private but is public due to Cuda restrictions.
+     *
+     * @param[in] allfdistribu The distribution function.
+     */
+    void compute_moments(DConstFieldSpXVx allfdistribu) const;
+
+    /**
+     * @brief Advance the mean velocities and the temperatures with the exact solution of
+     * the exchange equations for a fixed collision frequency.
+     *
+     * The velocity difference @f$ u_e - \sqrt{m_e/m_i} u_i @f$ and the temperature
+     * difference @f$ T_e - T_i @f$ relax exponentially. The total momentum is conserved and
+     * the thermal energy increases by the friction heating. The initial moments and the
+     * collision frequency are read from the internal buffers.
+     * This function should be private but is public due to Cuda restrictions.
+     *
+     * @param[out] fluid_velocity_new The mean velocities at the end of the timestep.
+     * @param[out] temperature_new The temperatures at the end of the timestep.
+     * @param[in] dt The time step.
+     */
+    void advance_moments(DFieldSpX fluid_velocity_new, DFieldSpX temperature_new, double dt)
+            const;
+
+    /**
+     * @brief Carry out one step of the exponential integrator.
+     *
+     * This function should be private but is public due to Cuda restrictions.
+     *
+     * @param[inout] allfdistribu The distribution function.
+     * @param[in] dt The time step.
+     */
+    void exponential_step(DFieldSpXVx allfdistribu, double dt) const;
 };
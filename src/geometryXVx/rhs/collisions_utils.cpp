@@ -9,8 +9,6 @@
 #include "species_info.hpp"
 #include "trapezoid_quadrature.hpp"
 
-namespace {
-
 /**
  * Useful function for computing collision related quantities:
  *  - kernel maxwellian moments
@@ -28,8 +26,6 @@ IdxSp find_ion(IdxRangeSp const idx_range_sp)
     return iion_opt.value();
 }
 
-} // namespace
-
 /**
  * Computes the spatial profile of nustar, which is constant here,
  * but could be space dependent (for instance to have no collisions in some specific
@@ -45,7 +41,7 @@ void compute_nustar_profile(DFieldSpX nustar_profile, double nustar0)
             Kokkos::DefaultExecutionSpace(),
             get_idx_range(nustar_profile),
             KOKKOS_LAMBDA(IdxSpX const ispx) {
-                double const coeff = Kokkos::sqrt(mass(ielec()) / mass(ddc::select<Species>(ispx)))
+                double const coeff = sqrt_me_on_mass(ddc::select<Species>(ispx))
                                      * Kokkos::pow(charge(ddc::select<Species>(ispx)), 4) / Lx;
                 nustar_profile(ispx) = coeff * nustar0;
             });
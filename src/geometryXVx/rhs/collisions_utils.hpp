@@ -9,6 +9,14 @@
 #include "quadrature.hpp"
 #include "trapezoid_quadrature.hpp"
 
+/**
+* @brief Find the index of the ion species.
+* The operator must act on two kinetic species: the electrons and the ions.
+* @param[in] idx_range_sp The index range of the two kinetic species.
+* @return The index of the species with a positive charge.
+*/
+IdxSp find_ion(IdxRangeSp idx_range_sp);
+
 /**
 * @brief Compute the collisionality spatial profile.
 * @param[inout] nustar_profile The collisionality profile.
@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: MIT
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include "composite_right_hand_side.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "quadrature.hpp"
+#include "trapezoid_quadrature.hpp"
+
+CompositeRightHandSide::CompositeRightHandSide(
+        std::vector<std::reference_wrapper<IRightHandSide const>> rhs)
+    : m_rhs(std::move(rhs))
+{
+}
+
+DFieldSpXVx CompositeRightHandSide::operator()(DFieldSpXVx const allfdistribu, double const dt)
+        const
+{
+    std::vector<std::reference_wrapper<IPointwiseRightHandSide const>> pointwise_rhs;
+    for (IRightHandSide const& rhs : m_rhs) {
+        IPointwiseRightHandSide const* pointwise = dynamic_cast<IPointwiseRightHandSide const*>(
+                &rhs);
+        if (pointwise) {
+            pointwise_rhs.push_back(*pointwise);
+        } else {
+            apply_pointwise_sources(allfdistribu, pointwise_rhs, dt);
+            pointwise_rhs.clear();
+            rhs(allfdistribu, dt);
+        }
+    }
+    apply_pointwise_sources(allfdistribu, pointwise_rhs, dt);
+    return allfdistribu;
+}
+
+void CompositeRightHandSide::apply_pointwise_sources(
+        DFieldSpXVx const allfdistribu,
+        std::vector<std::reference_wrapper<IPointwiseRightHandSide const>> const& pointwise_rhs,
+        double const dt) const
+{
+    int const nsources = pointwise_rhs.size();
+    if (nsources == 0) {
+        return;
+    }
+    if (nsources == 1) {
+        pointwise_rhs[0].get()(allfdistribu, dt);
+        return;
+    }
+
+    Kokkos::Profiling::pushRegion("(GSLX) PointwiseSources");
+
+    IdxRangeSpX const idx_range_spx = get_idx_range<Species, GridX>(allfdistribu);
+    IdxRangeSp const idx_range_sp = get_idx_range<Species>(allfdistribu);
+    IdxRangeX const idx_range_x = get_idx_range<GridX>(allfdistribu);
+    IdxRangeVx const idx_range_vx = get_idx_range<GridVx>(allfdistribu);
+
+    DFieldMemVx const quadrature_coeffs_alloc(
+            trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(idx_range_vx));
+    DConstFieldVx quadrature_coeffs = get_const_field(quadrature_coeffs_alloc);
+
+    // The densities only need to be tracked up to the last source which uses them
+    auto const last_density_source = std::find_if(
+            pointwise_rhs.rbegin(),
+            pointwise_rhs.rend(),
+            [](IPointwiseRightHandSide const& rhs) { return rhs.depends_on_density(); });
+    int const n_density_sources = std::distance(last_density_source, pointwise_rhs.rend());
+
+    DFieldMemSpX density_alloc(
+            "density (CompositeRightHandSide::apply_pointwise_sources())",
+            idx_range_spx);
+    DFieldSpX density = get_field(density_alloc);
+    if (n_density_sources > 0) {
+        Quadrature<IdxRangeVx, IdxRangeSpXVx> const integrate_v_batched(quadrature_coeffs);
+        integrate_v_batched(
+                Kokkos::DefaultExecutionSpace(),
+                density,
+                get_const_field(allfdistribu));
+    }
+    Quadrature<IdxRangeVx> const integrate_v(quadrature_coeffs);
+
+    // The composition of the sources takes the form
+    // f(t+dt) = fdistribu_coeff_total(s, x) f(t) + sum_k profile_coeffs(k, s, x) g_k(v)
+    DFieldMemSpX fdistribu_coeff_total_alloc(
+            "fdistribu_coeff_total (CompositeRightHandSide::apply_pointwise_sources())",
+            idx_range_spx);
+    DFieldSpX fdistribu_coeff_total = get_field(fdistribu_coeff_total_alloc);
+    ddc::parallel_fill(fdistribu_coeff_total, 1.);
+
+    Kokkos::View<double***, Kokkos::LayoutRight, Kokkos::DefaultExecutionSpace>
+            profile_coeffs(
+                    "profile_coeffs (CompositeRightHandSide::apply_pointwise_sources())",
+                    nsources,
+                    idx_range_sp.size(),
+                    idx_range_x.size());
+    Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::DefaultExecutionSpace>
+            velocity_profiles(
+                    "velocity_profiles (CompositeRightHandSide::apply_pointwise_sources())",
+                    nsources,
+                    idx_range_vx.size());
+
+    DFieldMemSpX fdistribu_coeff_alloc(
+            "fdistribu_coeff (CompositeRightHandSide::apply_pointwise_sources())",
+            idx_range_spx);
+    DFieldMemSpX profile_coeff_alloc(
+            "profile_coeff (CompositeRightHandSide::apply_pointwise_sources())",
+            idx_range_spx);
+    DFieldSpX fdistribu_coeff = get_field(fdistribu_coeff_alloc);
+    DFieldSpX profile_coeff = get_field(profile_coeff_alloc);
+
+    const std::source_location location = std::source_location::current();
+    for (int k = 0; k < nsources; ++k) {
+        IPointwiseRightHandSide const& rhs = pointwise_rhs[k];
+        rhs.get_affine_coefficients(fdistribu_coeff, profile_coeff, get_const_field(density), dt);
+        DConstFieldVx velocity_profile = rhs.get_velocity_profile();
+
+        ddc::parallel_for_each(
+                location.function_name(),
+                Kokkos::DefaultExecutionSpace(),
+                idx_range_vx,
+                KOKKOS_LAMBDA(IdxVx const ivx) {
+                    velocity_profiles(k, (ivx - idx_range_vx.front()).value())
+                            = velocity_profile(ivx);
+                });
+
+        if (k + 1 < n_density_sources) {
+            double const profile_density
+                    = integrate_v(Kokkos::DefaultExecutionSpace(), velocity_profile);
+            ddc::parallel_for_each(
+                    location.function_name(),
+                    Kokkos::DefaultExecutionSpace(),
+                    idx_range_spx,
+                    KOKKOS_LAMBDA(IdxSpX const ispx) {
+                        density(ispx) = fdistribu_coeff(ispx) * density(ispx)
+                                        + profile_coeff(ispx) * profile_density;
+                    });
+        }
+
+        ddc::parallel_for_each(
+                location.function_name(),
+                Kokkos::DefaultExecutionSpace(),
+                idx_range_spx,
+                KOKKOS_LAMBDA(IdxSpX const ispx) {
+                    int const isp = (ddc::select<Species>(ispx) - idx_range_sp.front()).value();
+                    int const ix = (ddc::select<GridX>(ispx) - idx_range_x.front()).value();
+                    for (int j = 0; j < k; ++j) {
+                        profile_coeffs(j, isp, ix) *= fdistribu_coeff(ispx);
+                    }
+                    profile_coeffs(k, isp, ix) = profile_coeff(ispx);
+                    fdistribu_coeff_total(ispx) *= fdistribu_coeff(ispx);
+                });
+    }
+
+    ddc::parallel_for_each(
+            location.function_name(),
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(allfdistribu),
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                IdxSpX const ispx(ispxvx);
+                int const isp = (ddc::select<Species>(ispxvx) - idx_range_sp.front()).value();
+                int const ix = (ddc::select<GridX>(ispxvx) - idx_range_x.front()).value();
+                int const ivx = (ddc::select<GridVx>(ispxvx) - idx_range_vx.front()).value();
+                double fdistribu = fdistribu_coeff_total(ispx) * allfdistribu(ispxvx);
+                for (int j = 0; j < nsources; ++j) {
+                    fdistribu += profile_coeffs(j, isp, ix) * velocity_profiles(j, ivx);
+                }
+                allfdistribu(ispxvx) = fdistribu;
+            });
+
+    Kokkos::Profiling::popRegion();
+}
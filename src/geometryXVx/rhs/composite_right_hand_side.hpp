@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "geometry_xvx.hpp"
+#include "ipointwiserighthandside.hpp"
+#include "irighthandside.hpp"
+
+/**
+ * @brief A class which applies a sequence of sources in Boltzmann equation.
+ *
+ * The sources are applied in the order in which they are provided. Consecutive sources
+ * which act independently at each point of the phase space (see IPointwiseRightHandSide)
+ * are merged and applied in a single pass over the distribution function. The densities
+ * required by these sources are computed once for the whole group, and are then updated
+ * from the affine form of each source. The other sources (e.g. collisions) are applied
+ * one after another by calling their operator().
+ *
+ * If a group contains a single pointwise source then its operator() is called directly.
+ */
+class CompositeRightHandSide : public IRightHandSide
+{
+private:
+    std::vector<std::reference_wrapper<IRightHandSide const>> m_rhs;
+
+public:
+    /**
+     * @brief Creates an instance of the CompositeRightHandSide class.
+     * @param[in] rhs A vector containing all of the source terms in the order in which
+     *                  they should be applied.
+     */
+    explicit CompositeRightHandSide(std::vector<std::reference_wrapper<IRightHandSide const>> rhs);
+
+    ~CompositeRightHandSide() override = default;
+
+    /**
+     * @brief Apply all the source terms to the distribution function.
+     *
+     * @param[inout] allfdistribu The distribution function.
+     * @param[in] dt The time step.
+     *
+     * @return A field referencing the distribution function passed as argument.
+     */
+    DFieldSpXVx operator()(DFieldSpXVx allfdistribu, double dt) const override;
+
+    /**
+     * @brief Apply a group of consecutive pointwise sources in a single pass over the
+     * distribution function.
+     *
+     * This function should be private. It is not due to the inclusion of a KOKKOS_LAMBDA.
+     *
+     * @param[inout] allfdistribu The distribution function.
+     * @param[in] pointwise_rhs The sources of the group in the order in which they should be applied.
+     * @param[in] dt The time step.
+     */
+    void apply_pointwise_sources(
+            DFieldSpXVx allfdistribu,
+            std::vector<std::reference_wrapper<IPointwiseRightHandSide const>> const&
+                    pointwise_rhs,
+            double dt) const;
+};
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "geometry_xvx.hpp"
+#include "irighthandside.hpp"
+
+/**
+ * @brief An abstract class representing a source in Boltzmann equation which acts
+ * independently at each point of the phase space.
+ *
+ * The solution of the source evolution equation on one timestep must take the affine form:
+ * f(t+dt, s, x, v) = a(s, x) f(t, s, x, v) + b(s, x) g(v)
+ * where g is a velocity profile which does not depend on time. The coefficients a and b
+ * may depend on the density of each species at the start of the timestep.
+ *
+ * This form allows consecutive sources to be applied in a single pass over the
+ * distribution function (see CompositeRightHandSide).
+ */
+class IPointwiseRightHandSide : public IRightHandSide
+{
+public:
+    ~IPointwiseRightHandSide() override = default;
+
+    /**
+     * @brief Get the velocity profile g of the source.
+     *
+     * @return A constant field containing the velocity profile.
+     */
+    virtual DConstFieldVx get_velocity_profile() const = 0;
+
+    /**
+     * @brief Indicate whether the coefficients of the affine form depend on the density.
+     *
+     * @return True if get_affine_coefficients reads the density argument.
+     */
+    virtual bool depends_on_density() const = 0;
+
+    /**
+     * @brief Compute the coefficients of the affine form of the solution on one timestep.
+     *
+     * @param[out] fdistribu_coeff The coefficient a(s, x) multiplying the distribution function.
+     * @param[out] profile_coeff The coefficient b(s, x) multiplying the velocity profile.
+     * @param[in] density The density of each species at the start of the timestep computed
+     *                  with a trapezoid quadrature. It is only valid if depends_on_density
+     *                  returns true.
+     * @param[in] dt The timestep.
+     */
+    virtual void get_affine_coefficients(
+            DFieldSpX fdistribu_coeff,
+            DFieldSpX profile_coeff,
+            DConstFieldSpX density,
+            double dt) const = 0;
+};
@@ -21,22 +21,28 @@ KineticSource::KineticSource(
     , m_spatial_extent(gridx)
     , m_velocity_shape(gridvx)
 {
-    host_t<DFieldMemX> spatial_extent_host
-            = mask_tanh(gridx, extent, stiffness, MaskType::Normal, true);
-    ddc::parallel_deepcopy(get_field(m_spatial_extent), get_const_field(spatial_extent_host));
+    mask_tanh(get_field(m_spatial_extent), extent, stiffness, MaskType::Normal, true);
     // compute the source velocity profile (maxwellian profile if density = energy = 1.)
-    double const coeff(1.0 / std::sqrt(2 * M_PI * m_temperature));
-    host_t<DFieldMemVx> velocity_shape_host(gridvx);
-    ddc::host_for_each(gridvx, [&](IdxVx const ivx) {
-        CoordVx const coordvx = ddc::coordinate(ivx);
-        double const coordvx_sq = coordvx * coordvx;
-        double const density_source = coeff * (1.5 - coordvx_sq / (2 * temperature))
-                                      * std::exp(-coordvx_sq / (2 * temperature));
-        double const energy_source = -0.5 * coeff * (1 - coordvx_sq / temperature)
-                                     * std::exp(-coordvx_sq / (2 * temperature));
-        velocity_shape_host(ivx) = density * density_source + energy * energy_source;
-    });
-    ddc::parallel_deepcopy(get_field(m_velocity_shape), velocity_shape_host);
+    double const coeff(1.0 / Kokkos::sqrt(2 * M_PI * m_temperature));
+    DFieldVx velocity_shape = get_field(m_velocity_shape);
+    const std::source_location location = std::source_location::current();
+    ddc::parallel_for_each(
+            location.function_name(),
+            Kokkos::DefaultExecutionSpace(),
+            gridvx,
+            KOKKOS_LAMBDA(IdxVx const ivx) {
+                CoordVx const coordvx = ddc::coordinate(ivx);
+                double const coordvx_sq = coordvx * coordvx;
+                double const density_source = coeff * (1.5 - coordvx_sq / (2 * temperature))
+                                              * Kokkos::exp(-coordvx_sq / (2 * temperature));
+                double const energy_source = -0.5 * coeff * (1 - coordvx_sq / temperature)
+                                             * Kokkos::exp(-coordvx_sq / (2 * temperature));
+                velocity_shape(ivx) = density * density_source + energy * energy_source;
+            });
+
+    // The profiles are only copied to the host to be exposed to PDI
+    auto spatial_extent_host = ddc::create_mirror_view_and_copy(get_field(m_spatial_extent));
+    auto velocity_shape_host = ddc::create_mirror_view_and_copy(get_field(m_velocity_shape));
     ddc::expose_to_pdi("kinetic_source_extent", spatial_extent_host);
     ddc::expose_to_pdi("kinetic_source_stiffness", stiffness);
     ddc::expose_to_pdi("kinetic_source_amplitude", m_amplitude);
@@ -71,3 +77,33 @@ DFieldSpXVx KineticSource::operator()(DFieldSpXVx const allfdistribu, double con
     Kokkos::Profiling::popRegion();
     return allfdistribu;
 }
+
+DConstFieldVx KineticSource::get_velocity_profile() const
+{
+    return get_const_field(m_velocity_shape);
+}
+
+bool KineticSource::depends_on_density() const
+{
+    return false;
+}
+
+void KineticSource::get_affine_coefficients(
+        DFieldSpX const fdistribu_coeff,
+        DFieldSpX const profile_coeff,
+        DConstFieldSpX const density,
+        double const dt) const
+{
+    DConstFieldX spatial_extent = get_field(m_spatial_extent);
+    double const amplitude = m_amplitude;
+
+    const std::source_location location = std::source_location::current();
+    ddc::parallel_for_each(
+            location.function_name(),
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(fdistribu_coeff),
+            KOKKOS_LAMBDA(IdxSpX const ispx) {
+                fdistribu_coeff(ispx) = 1.;
+                profile_coeff(ispx) = amplitude * spatial_extent(ddc::select<GridX>(ispx)) * dt;
+            });
+}
@@ -4,7 +4,7 @@
 #include <cmath>
 
 #include "geometry_xvx.hpp"
-#include "irighthandside.hpp"
+#include "ipointwiserighthandside.hpp"
 
 /**
  * @brief A class that describes a source of particles.
@@ -28,7 +28,7 @@
  * 
  * The complete description of the operator can be found in [rhs docs](https://github.com/gyselax/gyselalibxx/blob/devel/doc/geometryXVx/kinetic_source.pdf). 
  */
-class KineticSource : public IRightHandSide
+class KineticSource : public IPointwiseRightHandSide
 {
 private:
     double m_amplitude;
@@ -74,4 +74,34 @@ public:
      * @return A field referencing the distribution function passed as argument.
      */
     DFieldSpXVx operator()(DFieldSpXVx allfdistribu, double dt) const override;
+
+    /**
+     * @brief Get the velocity profile of the source.
+     *
+     * @return A constant field containing the velocity shape of the source.
+     */
+    DConstFieldVx get_velocity_profile() const override;
+
+    /**
+     * @brief Indicate whether the coefficients of the affine form depend on the density.
+     *
+     * @return False, the source does not depend on the distribution function.
+     */
+    bool depends_on_density() const override;
+
+    /**
+     * @brief Compute the coefficients of the affine form of the solution on one timestep.
+     *
+     * The coefficients are 1 and amplitude*spatial_extent*dt.
+     *
+     * @param[out] fdistribu_coeff The coefficient multiplying the distribution function.
+     * @param[out] profile_coeff The coefficient multiplying the velocity profile.
+     * @param[in] density The density of each species at the start of the timestep.
+     * @param[in] dt The timestep.
+     */
+    void get_affine_coefficients(
+            DFieldSpX fdistribu_coeff,
+            DFieldSpX profile_coeff,
+            DConstFieldSpX density,
+            double dt) const override;
 };
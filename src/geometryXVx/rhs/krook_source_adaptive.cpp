@@ -33,21 +33,22 @@ KrookSourceAdaptive::KrookSourceAdaptive(
     , m_ftarget(gridvx)
 {
     // mask that defines the region where the operator is active
-    host_t<DFieldMemX> mask_host(gridx);
     switch (m_type) {
     case RhsType::Source:
         // the mask equals one in the interval [x_left, x_right]
-        mask_host = mask_tanh(gridx, m_extent, m_stiffness, MaskType::Normal, false);
+        mask_tanh(get_field(m_mask), m_extent, m_stiffness, MaskType::Normal, false);
         break;
     case RhsType::Sink:
         // the mask equals zero in the centre of the plasma
-        mask_host = mask_tanh(gridx, m_extent, m_stiffness, MaskType::Inverted, false);
+        mask_tanh(get_field(m_mask), m_extent, m_stiffness, MaskType::Inverted, false);
         break;
     }
-    ddc::parallel_deepcopy(get_field(m_mask), mask_host);
 
     // target distribution function
     MaxwellianEquilibrium::compute_maxwellian(get_field(m_ftarget), m_density, m_temperature, 0.);
+
+    // The profiles are only copied to the host to be exposed to PDI
+    auto mask_host = ddc::create_mirror_view_and_copy(get_field(m_mask));
     auto ftarget_host = ddc::create_mirror_view_and_copy(get_field(m_ftarget));
 
     switch (m_type) {
@@ -150,3 +151,70 @@ DFieldSpXVx KrookSourceAdaptive::operator()(DFieldSpXVx const allfdistribu, doub
     Kokkos::Profiling::popRegion();
     return allfdistribu;
 }
+
+DConstFieldVx KrookSourceAdaptive::get_velocity_profile() const
+{
+    return get_const_field(m_ftarget);
+}
+
+bool KrookSourceAdaptive::depends_on_density() const
+{
+    return true;
+}
+
+void KrookSourceAdaptive::get_affine_coefficients(
+        DFieldSpX const fdistribu_coeff,
+        DFieldSpX const profile_coeff,
+        DConstFieldSpX const density,
+        double const dt) const
+{
+    IdxRangeSp const idx_range_sp(get_idx_range<Species>(density));
+    assert(idx_range_sp.size() == 2);
+    assert(charge(idx_range_sp.front()) * charge(idx_range_sp.back()) < 0.);
+    std::optional<IdxSp> iion_opt;
+    for (IdxSp const isp : idx_range_sp) {
+        if (charge(isp) > 0.) {
+            iion_opt = isp;
+        }
+    }
+    IdxSp iion(iion_opt.value());
+
+    DConstFieldVx ftarget = get_const_field(m_ftarget);
+    DFieldMemVx const quadrature_coeffs_alloc(trapezoid_quadrature_coefficients<
+                                              Kokkos::DefaultExecutionSpace>(get_idx_range(ftarget)));
+    Quadrature<IdxRangeVx> const integrate_v(get_const_field(quadrature_coeffs_alloc));
+    double const density_ftarget = integrate_v(Kokkos::DefaultExecutionSpace(), ftarget);
+
+    DConstFieldX mask = get_const_field(m_mask);
+    double const amplitude = m_amplitude;
+    double const target_density = m_density;
+
+    const std::source_location location = std::source_location::current();
+    ddc::parallel_for_each(
+            location.function_name(),
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range<GridX>(density),
+            KOKKOS_LAMBDA(IdxX const ix) {
+                IdxSp const ielectron = ielec();
+                double const density_ion = density(iion, ix);
+                double const density_electron = density(ielectron, ix);
+                // k1 of the RK2 scheme : df = -mask * amplitude * (f - ftarget)
+                double const amplitude_electron = amplitude * (density_ion - target_density)
+                                                  / (density_electron - target_density);
+                // densities at the intermediate step y_n + dt/2*k1
+                double const density_ion_half
+                        = density_ion
+                          - 0.5 * dt * mask(ix) * amplitude * (density_ion - density_ftarget);
+                double const density_electron_half = density_electron
+                                                     - 0.5 * dt * mask(ix) * amplitude_electron
+                                                               * (density_electron - density_ftarget);
+                // k2 of the RK2 scheme is evaluated with the amplitudes at the intermediate step
+                double const amplitude_electron_half = amplitude
+                                                       * (density_ion_half - target_density)
+                                                       / (density_electron_half - target_density);
+                fdistribu_coeff(iion, ix) = 1. - dt * mask(ix) * amplitude;
+                profile_coeff(iion, ix) = dt * mask(ix) * amplitude;
+                fdistribu_coeff(ielectron, ix) = 1. - dt * mask(ix) * amplitude_electron_half;
+                profile_coeff(ielectron, ix) = dt * mask(ix) * amplitude_electron_half;
+            });
+}
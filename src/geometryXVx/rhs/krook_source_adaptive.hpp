@@ -2,7 +2,7 @@
 #pragma once
 
 #include "geometry_xvx.hpp"
-#include "irighthandside.hpp"
+#include "ipointwiserighthandside.hpp"
 
 /**
  * @brief A class that describes a source of particles.
@@ -21,7 +21,7 @@
  * 
  * The complete description of the operator can be found in [rhs docs](https://github.com/gyselax/gyselalibxx/blob/devel/doc/geometryXVx/krook_source.pdf). 
  */
-class KrookSourceAdaptive : public IRightHandSide
+class KrookSourceAdaptive : public IPointwiseRightHandSide
 {
 private:
     RhsType m_type;
@@ -77,6 +77,38 @@ public:
      */
     DFieldSpXVx operator()(DFieldSpXVx allfdistribu, double dt) const override;
 
+    /**
+     * @brief Get the velocity profile of the source.
+     *
+     * @return A constant field containing the target distribution function ftarget.
+     */
+    DConstFieldVx get_velocity_profile() const override;
+
+    /**
+     * @brief Indicate whether the coefficients of the affine form depend on the density.
+     *
+     * @return True, the amplitude of the electron source depends on the densities.
+     */
+    bool depends_on_density() const override;
+
+    /**
+     * @brief Compute the coefficients of the affine form of the solution on one timestep.
+     *
+     * The coefficients reproduce the RK2 step used in the operator() method. The densities
+     * at the intermediate step of the RK2 scheme are deduced from the densities at the start
+     * of the timestep as the intermediate step is an affine function of the distribution function.
+     *
+     * @param[out] fdistribu_coeff The coefficient multiplying the distribution function.
+     * @param[out] profile_coeff The coefficient multiplying the velocity profile.
+     * @param[in] density The density of each species at the start of the timestep.
+     * @param[in] dt The timestep.
+     */
+    void get_affine_coefficients(
+            DFieldSpX fdistribu_coeff,
+            DFieldSpX profile_coeff,
+            DConstFieldSpX density,
+            double dt) const override;
+
 public:
     /**
      * @brief Computes the amplitude coefficient of the KrookSourceAdaptive operator. 
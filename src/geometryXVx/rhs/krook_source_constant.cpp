@@ -27,21 +27,22 @@ KrookSourceConstant::KrookSourceConstant(
     , m_ftarget(gridvx)
 {
     // mask that defines the region where the operator is active
-    host_t<DFieldMemX> mask_host(gridx);
     switch (m_type) {
     case RhsType::Source:
         // the mask equals one in the interval [x_left, x_right]
-        mask_host = mask_tanh(gridx, m_extent, m_stiffness, MaskType::Normal, false);
+        mask_tanh(get_field(m_mask), m_extent, m_stiffness, MaskType::Normal, false);
         break;
     case RhsType::Sink:
         // the mask equals zero in the centre of the plasma
-        mask_host = mask_tanh(gridx, m_extent, m_stiffness, MaskType::Inverted, false);
+        mask_tanh(get_field(m_mask), m_extent, m_stiffness, MaskType::Inverted, false);
         break;
     }
-    ddc::parallel_deepcopy(get_field(m_mask), mask_host);
 
     // target distribution function
     MaxwellianEquilibrium::compute_maxwellian(get_field(m_ftarget), m_density, m_temperature, 0.);
+
+    // The profiles are only copied to the host to be exposed to PDI
+    auto mask_host = ddc::create_mirror_view_and_copy(get_field(m_mask));
     auto ftarget_host = ddc::create_mirror_view_and_copy(get_field(m_ftarget));
 
     switch (m_type) {
@@ -90,3 +91,34 @@ DFieldSpXVx KrookSourceConstant::operator()(DFieldSpXVx const allfdistribu, doub
     Kokkos::Profiling::popRegion();
     return allfdistribu;
 }
+
+DConstFieldVx KrookSourceConstant::get_velocity_profile() const
+{
+    return get_const_field(m_ftarget);
+}
+
+bool KrookSourceConstant::depends_on_density() const
+{
+    return false;
+}
+
+void KrookSourceConstant::get_affine_coefficients(
+        DFieldSpX const fdistribu_coeff,
+        DFieldSpX const profile_coeff,
+        DConstFieldSpX const density,
+        double const dt) const
+{
+    DConstFieldX mask = get_const_field(m_mask);
+    double const amplitude = m_amplitude;
+
+    const std::source_location location = std::source_location::current();
+    ddc::parallel_for_each(
+            location.function_name(),
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(fdistribu_coeff),
+            KOKKOS_LAMBDA(IdxSpX const ispx) {
+                double const decay = Kokkos::exp(-amplitude * mask(ddc::select<GridX>(ispx)) * dt);
+                fdistribu_coeff(ispx) = decay;
+                profile_coeff(ispx) = 1. - decay;
+            });
+}
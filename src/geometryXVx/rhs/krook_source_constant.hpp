@@ -2,7 +2,7 @@
 #pragma once
 
 #include "geometry_xvx.hpp"
-#include "irighthandside.hpp"
+#include "ipointwiserighthandside.hpp"
 
 /**
  * @brief A class that describes a source of particles.
@@ -19,7 +19,7 @@
  * The solution of the evolution equation is therefore : 
  * f(t+dt) = ftarget + (f(t)-ftarget)*exp(-amplitude*mask*dt)
  */
-class KrookSourceConstant : public IRightHandSide
+class KrookSourceConstant : public IPointwiseRightHandSide
 {
 private:
     RhsType m_type;
@@ -74,4 +74,34 @@ public:
      * @return A field referencing the distribution function passed as argument.
      */
     DFieldSpXVx operator()(DFieldSpXVx allfdistribu, double dt) const override;
+
+    /**
+     * @brief Get the velocity profile of the source.
+     *
+     * @return A constant field containing the target distribution function ftarget.
+     */
+    DConstFieldVx get_velocity_profile() const override;
+
+    /**
+     * @brief Indicate whether the coefficients of the affine form depend on the density.
+     *
+     * @return False, the solution only depends on the mask.
+     */
+    bool depends_on_density() const override;
+
+    /**
+     * @brief Compute the coefficients of the affine form of the solution on one timestep.
+     *
+     * The coefficients are exp(-amplitude*mask*dt) and 1-exp(-amplitude*mask*dt).
+     *
+     * @param[out] fdistribu_coeff The coefficient multiplying the distribution function.
+     * @param[out] profile_coeff The coefficient multiplying the velocity profile.
+     * @param[in] density The density of each species at the start of the timestep.
+     * @param[in] dt The timestep.
+     */
+    void get_affine_coefficients(
+            DFieldSpX fdistribu_coeff,
+            DFieldSpX profile_coeff,
+            DConstFieldSpX density,
+            double dt) const override;
 };
@@ -8,8 +8,8 @@
 #include "quadrature.hpp"
 #include "trapezoid_quadrature.hpp"
 
-host_t<DFieldMemX> mask_tanh(
-        IdxRangeX const& gridx,
+void mask_tanh(
+        DFieldX const mask,
         double const extent,
         double const stiffness,
         MaskType const type,
@@ -21,45 +21,55 @@ host_t<DFieldMemX> mask_tanh(
     if (extent < 0 || extent > 0.5) {
         throw std::runtime_error("Invalid extent, cannot be more than 0.5");
     }
-    host_t<DFieldMemX> mask(gridx);
+    IdxRangeX const gridx = get_idx_range(mask);
     if (extent == 0) {
         ddc::parallel_fill(mask, 0.);
-    } else {
-        CoordX const x_min(ddc::coordinate(gridx.front()));
-        double const Lx = ddcHelper::total_interval_length(gridx);
-        CoordX const x_left(x_min + Lx * extent);
-        CoordX const x_right(x_min + Lx - Lx * extent);
+        return;
+    }
 
-        switch (type) {
-        case MaskType::Normal:
-            ddc::host_for_each(gridx, [&](IdxX const ix) {
-                CoordX const coordx = ddc::coordinate(ix);
-                mask(ix) = 0.5
-                           * (std::tanh((coordx - x_left) / stiffness)
-                              - std::tanh((coordx - x_right) / stiffness));
-            });
-            break;
+    CoordX const x_min(ddc::coordinate(gridx.front()));
+    double const Lx = ddcHelper::total_interval_length(gridx);
+    CoordX const x_left(x_min + Lx * extent);
+    CoordX const x_right(x_min + Lx - Lx * extent);
+    // The inverted mask is 1 - mask
+    double const offset = (type == MaskType::Inverted) ? 1. : 0.;
+    double const sign = (type == MaskType::Inverted) ? -1. : 1.;
 
-        case MaskType::Inverted:
-            ddc::host_for_each(gridx, [&](IdxX const ix) {
+    const std::source_location location = std::source_location::current();
+    ddc::parallel_for_each(
+            location.function_name(),
+            Kokkos::DefaultExecutionSpace(),
+            gridx,
+            KOKKOS_LAMBDA(IdxX const ix) {
                 CoordX const coordx = ddc::coordinate(ix);
-                mask(ix) = 1
-                           - 0.5
-                                     * (std::tanh((coordx - x_left) / stiffness)
-                                        - std::tanh((coordx - x_right) / stiffness));
+                mask(ix) = offset
+                           + sign * 0.5
+                                     * (Kokkos::tanh((coordx - x_left) / stiffness)
+                                        - Kokkos::tanh((coordx - x_right) / stiffness));
             });
-            break;
-        }
 
-        if (normalised) {
-            host_t<DFieldMemX> const quadrature_coeffs
-                    = trapezoid_quadrature_coefficients<Kokkos::DefaultHostExecutionSpace>(gridx);
-            host_t<Quadrature<IdxRangeX>> const integrate_x(get_const_field(quadrature_coeffs));
-            double const coeff_norm
-                    = integrate_x(Kokkos::DefaultHostExecutionSpace(), get_const_field(mask));
-            ddc::host_for_each(gridx, [&](IdxX const ix) { mask(ix) = mask(ix) / coeff_norm; });
-        }
+    if (normalised) {
+        DFieldMemX const quadrature_coeffs
+                = trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(gridx);
+        Quadrature<IdxRangeX> const integrate_x(get_const_field(quadrature_coeffs));
+        double const coeff_norm
+                = integrate_x(Kokkos::DefaultExecutionSpace(), get_const_field(mask));
+        ddc::parallel_for_each(
+                location.function_name(),
+                Kokkos::DefaultExecutionSpace(),
+                gridx,
+                KOKKOS_LAMBDA(IdxX const ix) { mask(ix) = mask(ix) / coeff_norm; });
     }
+}
 
-    return mask;
+host_t<DFieldMemX> mask_tanh(
+        IdxRangeX const& gridx,
+        double const extent,
+        double const stiffness,
+        MaskType const type,
+        bool const normalised)
+{
+    DFieldMemX mask("mask (mask_tanh())", gridx);
+    mask_tanh(get_field(mask), extent, stiffness, type, normalised);
+    return ddc::create_mirror_and_copy(get_field(mask));
 }
@@ -9,6 +9,37 @@
  */
 enum class MaskType { Normal, Inverted };
 
+/**
+ * @brief Fills a mask function defined with hyperbolic tangents on the device.
+ *
+ * Consider the index range [xmin, xmax], and {xleft, xright} 
+ * the transition coordinates defined using the extent parameter.
+ * 
+ * If type = 'normal' the mask equals one inside 
+ * the [xleft, xright] interval and zero outside.
+ * 
+ * If type = 'inverted' the mask equals zero inside 
+ * the [xleft, xright] interval and one outside.
+ * 
+ * If normalised = true, the mask is normalised so 
+ * that its integral equals one
+ *
+ * The values are computed in parallel where the mask is stored so no host
+ * computation or transfer is required.
+ *
+ * @param[out] mask The field on the mesh in the x direction where the mask is stored.
+ * @param[in] extent A parameter that sets the extent of the mask. 
+ * @param[in] stiffness A parameter that sets the stiffness of the mask. 
+ * @param[in] type A MaskType parameter that defines the type of the mask. 
+ * @param[in] normalised A boolean that equals true if the integral of the mask must be equal to one.
+ */
+void mask_tanh(
+        DFieldX mask,
+        double extent,
+        double stiffness,
+        MaskType const type,
+        bool normalised);
+
 /**
  * @brief Constructs a mask function defined with hyperbolic tangents.
  *
@@ -29,7 +60,7 @@ enum class MaskType { Normal, Inverted };
  * @param[in] stiffness A parameter that sets the stiffness of the mask. 
  * @param[in] type A MaskType parameter that defines the type of the mask. 
  * @param[in] normalised A boolean that equals true if the integral of the mask must be equal to one.
- * @returns A Dfield containing the mask. 
+ * @returns A host Dfield containing the mask. 
  */
 host_t<DFieldMemX> mask_tanh(
         IdxRangeX const& gridx,
@@ -1,19 +1,49 @@
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
+#include <cassert>
 #include <cmath>
-#include <iostream>
 
 #include <ddc/ddc.hpp>
 #include <ddc/pdi.hpp>
 
+#include "buffer_version.hpp"
+#include "cached_field_solver.hpp"
 #include "iboltzmannsolver.hpp"
+#include "insitu_diagnostics.hpp"
 #include "iqnsolver.hpp"
 #include "predcorr.hpp"
+#include "species_info.hpp"
 
-PredCorr::PredCorr(IBoltzmannSolver const& boltzmann_solver, IQNSolver const& poisson_solver)
+PredCorr::PredCorr(
+        IBoltzmannSolver const& boltzmann_solver,
+        IQNSolver const& poisson_solver,
+        InSituDiagnostics* const diagnostics,
+        int const checkpoint_period)
     : m_boltzmann_solver(boltzmann_solver)
     , m_poisson_solver(poisson_solver)
+    , m_predictor_poisson_solver(nullptr)
+    , m_diagnostics(diagnostics)
+    , m_checkpoint_period(checkpoint_period)
 {
+    assert(checkpoint_period > 0);
+}
+
+PredCorr::PredCorr(
+        IBoltzmannSolver const& boltzmann_solver,
+        IQNSolver const& poisson_solver,
+        PoissonSolver const& predictor_poisson_solver,
+        DConstFieldVx const quadrature_coeffs,
+        InSituDiagnostics* const diagnostics,
+        int const checkpoint_period)
+    : m_boltzmann_solver(boltzmann_solver)
+    , m_poisson_solver(poisson_solver)
+    , m_predictor_poisson_solver(&predictor_poisson_solver)
+    , m_quadrature_coeffs(quadrature_coeffs)
+    , m_diagnostics(diagnostics)
+    , m_checkpoint_period(checkpoint_period)
+{
+    assert(checkpoint_period > 0);
 }
 
 DFieldSpXVx PredCorr::operator()(
@@ -31,68 +61,273 @@ DFieldSpXVx PredCorr::operator()(
 
     DFieldMemX electric_field(get_idx_range<GridX>(allfdistribu));
 
-    // a 2D chunk of the same size as fdistribu
-    host_t<DFieldMemSpXVx> allfdistribu_half_t_host(get_idx_range(allfdistribu));
-    DFieldMemSpXVx allfdistribu_half_t(get_idx_range(allfdistribu));
+    // a 2D chunk of the same size as fdistribu (not needed by the fused predictor)
+    DFieldMemSpXVx allfdistribu_half_t(
+            m_predictor_poisson_solver ? IdxRangeSpXVx() : get_idx_range(allfdistribu));
+    DFieldMemX charge_density_half_t(get_idx_range<GridX>(allfdistribu));
 
-    m_poisson_solver(
-            get_field(electrostatic_potential),
-            get_field(electric_field),
-            get_const_field(allfdistribu));
+    // The fields computed from allfdistribu are reused until allfdistribu is modified
+    BufferVersion allfdistribu_version(allfdistribu);
+    CachedPoissonSolver const poisson_solver(
+            m_poisson_solver,
+            allfdistribu_version,
+            get_idx_range<GridX>(allfdistribu));
 
     int iter = 0;
     for (; iter < steps; ++iter) {
         Kokkos::Profiling::pushRegion("(GSLX) Time step");
         double const iter_time = time_start + iter * dt;
 
-        // computation of the electrostatic potential at time tn and
-        // the associated electric field
-        m_poisson_solver(
+        compute_fields(
+                poisson_solver,
+                get_const_field(allfdistribu),
+                get_field(electrostatic_potential),
+                get_field(electric_field),
+                iter_time);
+        write_iteration(
+                allfdistribu_host,
+                get_field(electrostatic_potential_host),
+                get_const_field(allfdistribu),
+                get_const_field(electrostatic_potential),
+                iter,
+                iter_time);
+
+        predict_correct(
+                allfdistribu,
                 get_field(electrostatic_potential),
                 get_field(electric_field),
-                get_const_field(allfdistribu));
-        // copies necessary to PDI
+                get_field(allfdistribu_half_t),
+                get_field(charge_density_half_t),
+                dt);
+        allfdistribu_version.increment();
+
+        Kokkos::Profiling::popRegion();
+    }
+
+    write_last_iteration(
+            poisson_solver,
+            allfdistribu_host,
+            get_field(electrostatic_potential_host),
+            get_const_field(allfdistribu),
+            get_field(electrostatic_potential),
+            get_field(electric_field),
+            iter,
+            time_start + iter * dt);
+
+    return allfdistribu;
+}
+
+void PredCorr::compute_fields(
+        CachedPoissonSolver const& poisson_solver,
+        DConstFieldSpXVx const allfdistribu,
+        DFieldX const electrostatic_potential,
+        DFieldX const electric_field,
+        double const time) const
+{
+    // computation of the electrostatic potential at time tn and
+    // the associated electric field
+    poisson_solver(electrostatic_potential, electric_field, allfdistribu);
+    if (m_diagnostics) {
+        (*m_diagnostics)(
+                time,
+                allfdistribu,
+                get_const_field(electrostatic_potential),
+                get_const_field(electric_field));
+    }
+}
+
+void PredCorr::write_iteration(
+        host_t<DFieldSpXVx> const allfdistribu_host,
+        host_t<DFieldX> const electrostatic_potential_host,
+        DConstFieldSpXVx const allfdistribu,
+        DConstFieldX const electrostatic_potential,
+        int const output_iter,
+        double const time) const
+{
+    // copies necessary to PDI
+    ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
+    Kokkos::Profiling::pushRegion("(GSLX) HDF5_Output");
+    if (output_iter % m_checkpoint_period == 0) {
+        // The distribution function is only copied to the host for the checkpoints
         ddc::parallel_deepcopy(allfdistribu_host, allfdistribu);
-        ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
-        Kokkos::Profiling::pushRegion("(GSLX) HDF5_Output");
         ddc::PdiEvent("iteration")
-                .with("iter", iter)
-                .with("time_saved", iter_time)
+                .with("iter", output_iter)
+                .with("time_saved", time)
                 .with("fdistribu", allfdistribu_host)
                 .with("electrostatic_potential", electrostatic_potential_host);
-        Kokkos::Profiling::popRegion();
+    } else {
+        ddc::PdiEvent("iteration")
+                .with("iter", output_iter)
+                .with("time_saved", time)
+                .with("electrostatic_potential", electrostatic_potential_host);
+    }
+    Kokkos::Profiling::popRegion();
+}
+
+void PredCorr::write_last_iteration(
+        CachedPoissonSolver const& poisson_solver,
+        host_t<DFieldSpXVx> const allfdistribu_host,
+        host_t<DFieldX> const electrostatic_potential_host,
+        DConstFieldSpXVx const allfdistribu,
+        DFieldX const electrostatic_potential,
+        DFieldX const electric_field,
+        int const output_iter,
+        double const time) const
+{
+    compute_fields(poisson_solver, allfdistribu, electrostatic_potential, electric_field, time);
+    if (m_diagnostics) {
+        m_diagnostics->write();
+    }
+    //copies necessary to PDI
+    ddc::parallel_deepcopy(allfdistribu_host, allfdistribu);
+    ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
+    ddc::PdiEvent("last_iteration")
+            .with("iter", output_iter)
+            .with("time_saved", time)
+            .with("fdistribu", allfdistribu_host)
+            .with("electrostatic_potential", electrostatic_potential_host);
+}
+
+void PredCorr::predict_correct(
+        DFieldSpXVx const allfdistribu,
+        DFieldX const electrostatic_potential,
+        DFieldX const electric_field,
+        DFieldSpXVx const allfdistribu_half_t,
+        DFieldX const charge_density_half_t,
+        double const dt) const
+{
+    if (m_predictor_poisson_solver) {
+        // predictor computing only the charge density at time tn+1/2
+        m_boltzmann_solver.charge_density_after_step(
+                charge_density_half_t,
+                get_const_field(allfdistribu),
+                get_const_field(electric_field),
+                m_quadrature_coeffs,
+                dt / 2);
 
+        // computation of the electrostatic potential at time tn+1/2
+        // and the associated electric field
+        (*m_predictor_poisson_solver)(
+                electrostatic_potential,
+                electric_field,
+                charge_density_half_t);
+    } else {
         // copy fdistribu
         ddc::parallel_deepcopy(allfdistribu_half_t, allfdistribu);
 
         // predictor
-        m_boltzmann_solver(get_field(allfdistribu_half_t), get_const_field(electric_field), dt / 2);
+        m_boltzmann_solver(allfdistribu_half_t, get_const_field(electric_field), dt / 2);
 
         // computation of the electrostatic potential at time tn+1/2
         // and the associated electric field
         m_poisson_solver(
+                electrostatic_potential,
+                electric_field,
+                get_const_field(allfdistribu_half_t));
+    }
+    // correction on a dt
+    m_boltzmann_solver(allfdistribu, get_const_field(electric_field), dt);
+}
+
+DFieldSpXVx PredCorr::operator()(
+        DFieldSpXVx const allfdistribu,
+        double const time_start,
+        double const time_end,
+        CFLTimeStepController const& time_step_controller) const
+{
+    auto allfdistribu_alloc = ddc::create_mirror_view(allfdistribu);
+    host_t<DFieldSpXVx> allfdistribu_host = get_field(allfdistribu_alloc);
+
+    // electrostatic potential and electric field (depending only on x)
+    host_t<DFieldMemX> electrostatic_potential_host(get_idx_range<GridX>(allfdistribu));
+    DFieldMemX electrostatic_potential(get_idx_range<GridX>(allfdistribu));
+
+    DFieldMemX electric_field(get_idx_range<GridX>(allfdistribu));
+    DFieldX electric_field_proxy = get_field(electric_field);
+
+    // a 2D chunk of the same size as fdistribu (not needed by the fused predictor)
+    DFieldMemSpXVx allfdistribu_half_t(
+            m_predictor_poisson_solver ? IdxRangeSpXVx() : get_idx_range(allfdistribu));
+    DFieldMemX charge_density_half_t(get_idx_range<GridX>(allfdistribu));
+
+    // The fields computed from allfdistribu are reused until allfdistribu is modified
+    BufferVersion allfdistribu_version(allfdistribu);
+    CachedPoissonSolver const poisson_solver(
+            m_poisson_solver,
+            allfdistribu_version,
+            get_idx_range<GridX>(allfdistribu));
+
+    // The velocity of the characteristics in the vx direction is q/m E (in units of the
+    // electron thermal velocity)
+    double max_charge_on_mass = 0.0;
+    for (IdxSp const isp : get_idx_range<Species>(allfdistribu)) {
+        max_charge_on_mass = std::max(
+                max_charge_on_mass,
+                std::abs(charge(isp)) * sqrt_me_on_mass(isp));
+    }
+    double const min_dvx = min_cell_width(get_idx_range<GridVx>(allfdistribu));
+    double const output_period = time_step_controller.get_output_period();
+
+    const std::source_location location = std::source_location::current();
+    int output_iter = 0;
+    double time = time_start;
+    double next_output_time = time_start;
+    while (time < time_end) {
+        Kokkos::Profiling::pushRegion("(GSLX) Time step");
+
+        compute_fields(
+                poisson_solver,
+                get_const_field(allfdistribu),
                 get_field(electrostatic_potential),
                 get_field(electric_field),
-                get_const_field(allfdistribu_half_t));
-        // correction on a dt
-        m_boltzmann_solver(allfdistribu, get_const_field(electric_field), dt);
+                time);
+        if (time == next_output_time) {
+            write_iteration(
+                    allfdistribu_host,
+                    get_field(electrostatic_potential_host),
+                    get_const_field(allfdistribu),
+                    get_const_field(electrostatic_potential),
+                    output_iter,
+                    time);
+            ++output_iter;
+            next_output_time = std::min(time_start + output_iter * output_period, time_end);
+        }
+
+        double const max_electric_field = ddc::parallel_transform_reduce(
+                location.function_name(),
+                Kokkos::DefaultExecutionSpace(),
+                get_idx_range(electric_field_proxy),
+                0.0,
+                ddc::reducer::max<double>(),
+                KOKKOS_LAMBDA(IdxX const ix) { return Kokkos::abs(electric_field_proxy(ix)); });
+        double const time_to_output = next_output_time - time;
+        double const dt = time_step_controller.get_time_step(
+                max_charge_on_mass * max_electric_field / min_dvx,
+                time_to_output);
+
+        predict_correct(
+                allfdistribu,
+                get_field(electrostatic_potential),
+                get_field(electric_field),
+                get_field(allfdistribu_half_t),
+                get_field(charge_density_half_t),
+                dt);
+        allfdistribu_version.increment();
+
+        time = (dt == time_to_output) ? next_output_time : time + dt;
 
         Kokkos::Profiling::popRegion();
     }
 
-    double const final_time = time_start + iter * dt;
-    m_poisson_solver(
+    write_last_iteration(
+            poisson_solver,
+            allfdistribu_host,
+            get_field(electrostatic_potential_host),
+            get_const_field(allfdistribu),
             get_field(electrostatic_potential),
             get_field(electric_field),
-            get_const_field(allfdistribu));
-    //copies necessary to PDI
-    ddc::parallel_deepcopy(allfdistribu_host, allfdistribu);
-    ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
-    ddc::PdiEvent("last_iteration")
-            .with("iter", iter)
-            .with("time_saved", final_time)
-            .with("fdistribu", allfdistribu_host)
-            .with("electrostatic_potential", electrostatic_potential_host);
+            output_iter,
+            time_end);
 
     return allfdistribu;
 }
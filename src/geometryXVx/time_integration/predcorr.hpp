@@ -2,11 +2,16 @@
 
 #pragma once
 
+#include "cfl_time_step_controller.hpp"
 #include "geometry_xvx.hpp"
+#include "ipoisson_solver.hpp"
 #include "itimesolver.hpp"
 
 class IQNSolver;
 class IBoltzmannSolver;
+class InSituDiagnostics;
+template <class FieldSolver, class PotentialFieldMem, class ElectricFieldMem>
+class CachedFieldSolver;
 
 /**
  * @brief A class that solves a Boltzmann-Poisson system of equations using a predictor-corrector scheme.
@@ -17,21 +22,89 @@ class IBoltzmannSolver;
  * of a half-timestep. This potential is then used to compute
  * the value of the distribution function at time t+dt, where 
  * dt is the timestep.
+ *
+ * In the fused predictor mode the charge density at time t+dt/2 is computed
+ * by the Boltzmann solver directly during its last advection (see
+ * IBoltzmannSolver::charge_density_after_step). The distribution function at
+ * time t+dt/2 is therefore never stored.
+ *
+ * The timestep can either be fixed or chosen at each iteration from a CFL
+ * condition on the displacement in the velocity direction caused by the
+ * electric field (see CFLTimeStepController).
+ *
+ * If in-situ diagnostics are provided they are computed at every timestep
+ * (see InSituDiagnostics).
+ *
+ * The distribution function is only copied to the host and exposed to PDI in the
+ * "iteration" events which write a checkpoint (every checkpoint_period events). The
+ * other events only expose the electrostatic potential.
  */
 class PredCorr : public ITimeSolver
 {
+    using PoissonSolver = IPoissonSolver<
+            IdxRangeX,
+            IdxRangeX,
+            double,
+            typename Kokkos::DefaultExecutionSpace::memory_space,
+            Kokkos::layout_right>;
+
+    using CachedPoissonSolver = CachedFieldSolver<IQNSolver, DFieldMemX, DFieldMemX>;
+
 private:
     IBoltzmannSolver const& m_boltzmann_solver;
 
     IQNSolver const& m_poisson_solver;
 
+    // The Poisson solver used in the fused predictor mode (nullptr otherwise).
+    PoissonSolver const* m_predictor_poisson_solver;
+
+    DConstFieldVx m_quadrature_coeffs;
+
+    // The diagnostics computed at every timestep (nullptr if there are none).
+    InSituDiagnostics* m_diagnostics;
+
+    // The number of "iteration" PDI events between two checkpoints.
+    int m_checkpoint_period;
+
 public:
     /**
      * @brief Creates an instance of the predictor-corrector class.
      * @param[in] boltzmann_solver A solver for a Boltzmann equation.
      * @param[in] poisson_solver A solver for a Quasi-Neutrality equation.
+     * @param[in] diagnostics The diagnostics computed at every timestep (optional).
+     * @param[in] checkpoint_period The number of "iteration" PDI events between two events
+     *                              exposing the distribution function (optional).
+     */
+    PredCorr(
+            IBoltzmannSolver const& boltzmann_solver,
+            IQNSolver const& poisson_solver,
+            InSituDiagnostics* diagnostics = nullptr,
+            int checkpoint_period = 1);
+
+    /**
+     * @brief Creates an instance of the predictor-corrector class using the fused predictor mode.
+     *
+     * In this mode the charge density at the half timestep is computed by the Boltzmann solver
+     * without storing the predicted distribution function. It is then passed to the Poisson
+     * solver to obtain the electric field used by the corrector.
+     *
+     * @param[in] boltzmann_solver A solver for a Boltzmann equation.
+     * @param[in] poisson_solver A solver for a Quasi-Neutrality equation.
+     * @param[in] predictor_poisson_solver A solver for the Poisson equation used with the
+     *                              charge density computed by the predictor.
+     * @param[in] quadrature_coeffs The coefficients of the quadrature over the velocity space
+     *                              used to compute the charge density in the predictor.
+     * @param[in] diagnostics The diagnostics computed at every timestep (optional).
+     * @param[in] checkpoint_period The number of "iteration" PDI events between two events
+     *                              exposing the distribution function (optional).
      */
-    PredCorr(IBoltzmannSolver const& boltzmann_solver, IQNSolver const& poisson_solver);
+    PredCorr(
+            IBoltzmannSolver const& boltzmann_solver,
+            IQNSolver const& poisson_solver,
+            PoissonSolver const& predictor_poisson_solver,
+            DConstFieldVx quadrature_coeffs,
+            InSituDiagnostics* diagnostics = nullptr,
+            int checkpoint_period = 1);
 
     ~PredCorr() override = default;
 
@@ -47,4 +120,93 @@ public:
      */
     DFieldSpXVx operator()(DFieldSpXVx allfdistribu, double time_start, double dt, int steps = 1)
             const override;
+
+    /**
+     * @brief Solves the Boltzmann-Poisson system with a timestep chosen from a CFL condition.
+     *
+     * At each iteration the timestep is chosen from the maximum number of velocity cells
+     * crossed per unit of time by the characteristics, which is proportional to the maximum
+     * of the electric field. The "iteration" PDI event is triggered at each output time
+     * with iter equal to the index of the output.
+     *
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function.
+     *                              On output : the value of the distribution function at time_end.
+     * @param[in] time_start The physical time at the start of the simulation.
+     * @param[in] time_end The physical time at the end of the simulation.
+     * @param[in] time_step_controller The object choosing the timestep and the output times.
+     * @return The distribution function after solving the system.
+     */
+    DFieldSpXVx operator()(
+            DFieldSpXVx allfdistribu,
+            double time_start,
+            double time_end,
+            CFLTimeStepController const& time_step_controller) const;
+
+private:
+    /**
+     * @brief Compute the electrostatic potential and the electric field at the start of a
+     * timestep and the in-situ diagnostics.
+     *
+     * @param[in] poisson_solver The solver which reuses the fields while allfdistribu is unchanged.
+     * @param[in] allfdistribu The distribution function.
+     * @param[out] electrostatic_potential The electrostatic potential.
+     * @param[out] electric_field The electric field.
+     * @param[in] time The physical time.
+     */
+    void compute_fields(
+            CachedPoissonSolver const& poisson_solver,
+            DConstFieldSpXVx allfdistribu,
+            DFieldX electrostatic_potential,
+            DFieldX electric_field,
+            double time) const;
+
+    /**
+     * @brief Trigger the "iteration" PDI event, exposing the distribution function every
+     * checkpoint_period outputs.
+     *
+     * @param[out] allfdistribu_host A host buffer for the distribution function.
+     * @param[out] electrostatic_potential_host A host buffer for the electrostatic potential.
+     * @param[in] allfdistribu The distribution function.
+     * @param[in] electrostatic_potential The electrostatic potential.
+     * @param[in] output_iter The index of the output.
+     * @param[in] time The physical time.
+     */
+    void write_iteration(
+            host_t<DFieldSpXVx> allfdistribu_host,
+            host_t<DFieldX> electrostatic_potential_host,
+            DConstFieldSpXVx allfdistribu,
+            DConstFieldX electrostatic_potential,
+            int output_iter,
+            double time) const;
+
+    /**
+     * @brief Compute the fields and the diagnostics at the end of the simulation, write the
+     * diagnostics and trigger the "last_iteration" PDI event.
+     *
+     * @param[in] poisson_solver The solver which reuses the fields while allfdistribu is unchanged.
+     * @param[out] allfdistribu_host A host buffer for the distribution function.
+     * @param[out] electrostatic_potential_host A host buffer for the electrostatic potential.
+     * @param[in] allfdistribu The distribution function.
+     * @param[out] electrostatic_potential The electrostatic potential.
+     * @param[out] electric_field The electric field.
+     * @param[in] output_iter The index of the output.
+     * @param[in] time The physical time.
+     */
+    void write_last_iteration(
+            CachedPoissonSolver const& poisson_solver,
+            host_t<DFieldSpXVx> allfdistribu_host,
+            host_t<DFieldX> electrostatic_potential_host,
+            DConstFieldSpXVx allfdistribu,
+            DFieldX electrostatic_potential,
+            DFieldX electric_field,
+            int output_iter,
+            double time) const;
+
+    void predict_correct(
+            DFieldSpXVx allfdistribu,
+            DFieldX electrostatic_potential,
+            DFieldX electric_field,
+            DFieldSpXVx allfdistribu_half_t,
+            DFieldX charge_density_half_t,
+            double dt) const;
 };
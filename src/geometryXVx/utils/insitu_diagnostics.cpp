@@ -0,0 +1,273 @@
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+#include <utility>
+
+#include <ddc/ddc.hpp>
+
+#include <pdi.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "insitu_diagnostics.hpp"
+
+InSituDiagnostics::InSituDiagnostics(
+        MPI_Comm comm,
+        IdxRangeSp const idx_range_sp,
+        DConstFieldX const quadrature_coeffs_x,
+        DConstFieldVx const quadrature_coeffs_vx,
+        std::vector<int> fourier_modes,
+        int const records_per_write)
+    : m_comm(comm)
+    , m_records_per_write(records_per_write)
+    , m_write_index(0)
+    , m_idx_range_sp(idx_range_sp)
+    , m_fourier_modes(std::move(fourier_modes))
+    , m_quadrature_coeffs_xvx(
+              "quadrature_coeffs_xvx (InSituDiagnostics::InSituDiagnostics())",
+              IdxRangeXVx(get_idx_range(quadrature_coeffs_x), get_idx_range(quadrature_coeffs_vx)))
+    , m_integrate_x(quadrature_coeffs_x)
+    , m_integrate_v(quadrature_coeffs_vx)
+    , m_integrate_xv(get_const_field(m_quadrature_coeffs_xvx))
+{
+    MPI_Comm_rank(m_comm, &m_rank);
+
+    DField<IdxRangeXVx> const quadrature_coeffs_xvx = get_field(m_quadrature_coeffs_xvx);
+    const std::source_location location = std::source_location::current();
+    ddc::parallel_for_each(
+            location.function_name(),
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(quadrature_coeffs_xvx),
+            KOKKOS_LAMBDA(IdxXVx const ixvx) {
+                quadrature_coeffs_xvx(ixvx)
+                        = quadrature_coeffs_x(IdxX(ixvx)) * quadrature_coeffs_vx(IdxVx(ixvx));
+            });
+
+    m_length_x = m_integrate_x(
+            Kokkos::DefaultExecutionSpace(),
+            KOKKOS_LAMBDA(IdxX const) { return 1.0; });
+}
+
+void InSituDiagnostics::operator()(
+        double const time,
+        DConstFieldSpXVx const allfdistribu,
+        DConstFieldX const electrostatic_potential,
+        DConstFieldX const electric_field)
+{
+    Kokkos::Profiling::pushRegion("(GSLX) InSituDiagnostics");
+    IdxRangeSpXVx const idx_range(get_idx_range(allfdistribu));
+    IdxRangeSp const idx_range_sp(idx_range);
+    IdxRangeX const idx_range_x(idx_range);
+    IdxRangeSpX const idx_range_spx(idx_range);
+    CoordX const x_min = ddc::coordinate(idx_range_x.front());
+    int const n_species = m_idx_range_sp.size();
+    int const n_x = idx_range_x.size();
+    int const n_spx = n_species * n_x;
+
+    m_time.push_back(time);
+
+    // Reductions of the electric field and the electrostatic potential
+    double const electric_field_l2_squared = m_integrate_x(
+            Kokkos::DefaultExecutionSpace(),
+            KOKKOS_LAMBDA(IdxX const ix) { return electric_field(ix) * electric_field(ix); });
+    m_electrostatic_energy.push_back(0.5 * electric_field_l2_squared);
+
+    for (int const mode : m_fourier_modes) {
+        double const wavenumber = 2 * M_PI * mode / m_length_x;
+        double const real_part = m_integrate_x(
+                Kokkos::DefaultExecutionSpace(),
+                KOKKOS_LAMBDA(IdxX const ix) {
+                    double const x = ddc::coordinate(ix) - x_min;
+                    return electrostatic_potential(ix) * Kokkos::cos(wavenumber * x);
+                });
+        double const imag_part = m_integrate_x(
+                Kokkos::DefaultExecutionSpace(),
+                KOKKOS_LAMBDA(IdxX const ix) {
+                    double const x = ddc::coordinate(ix) - x_min;
+                    return -electrostatic_potential(ix) * Kokkos::sin(wavenumber * x);
+                });
+        double const factor = (mode == 0) ? 1.0 : 2.0;
+        m_fourier_amplitudes.push_back(
+                factor * std::sqrt(real_part * real_part + imag_part * imag_part) / m_length_x);
+    }
+
+    // Integrals of the local part of the distribution function over (x, vx)
+    DFieldMemSp mass_alloc(idx_range_sp);
+    DFieldMemSp l1_norm_alloc(idx_range_sp);
+    DFieldMemSp l2_norm_squared_alloc(idx_range_sp);
+    DFieldMemSp entropy_alloc(idx_range_sp);
+    m_integrate_xv(Kokkos::DefaultExecutionSpace(), get_field(mass_alloc), allfdistribu);
+    m_integrate_xv(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(l1_norm_alloc),
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) { return Kokkos::fabs(allfdistribu(ispxvx)); });
+    m_integrate_xv(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(l2_norm_squared_alloc),
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                return allfdistribu(ispxvx) * allfdistribu(ispxvx);
+            });
+    m_integrate_xv(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(entropy_alloc),
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                double const f = allfdistribu(ispxvx);
+                return (f > 0) ? -f * Kokkos::log(f) : 0.0;
+            });
+
+    // Partial velocity moments of the local part of the distribution function
+    DFieldMemSpX moment_0_alloc(idx_range_spx);
+    DFieldMemSpX moment_1_alloc(idx_range_spx);
+    DFieldMemSpX moment_2_alloc(idx_range_spx);
+    m_integrate_v(Kokkos::DefaultExecutionSpace(), get_field(moment_0_alloc), allfdistribu);
+    m_integrate_v(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(moment_1_alloc),
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                double const v = ddc::coordinate(ddc::select<GridVx>(ispxvx));
+                return v * allfdistribu(ispxvx);
+            });
+    m_integrate_v(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(moment_2_alloc),
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                double const v = ddc::coordinate(ddc::select<GridVx>(ispxvx));
+                return v * v * allfdistribu(ispxvx);
+            });
+
+    // Sum the contributions of the local velocities on the host
+    auto mass_host = ddc::create_mirror_view_and_copy(get_field(mass_alloc));
+    auto l1_norm_host = ddc::create_mirror_view_and_copy(get_field(l1_norm_alloc));
+    auto l2_norm_squared_host = ddc::create_mirror_view_and_copy(get_field(l2_norm_squared_alloc));
+    auto entropy_host = ddc::create_mirror_view_and_copy(get_field(entropy_alloc));
+    auto moment_0_host = ddc::create_mirror_view_and_copy(get_field(moment_0_alloc));
+    auto moment_1_host = ddc::create_mirror_view_and_copy(get_field(moment_1_alloc));
+    auto moment_2_host = ddc::create_mirror_view_and_copy(get_field(moment_2_alloc));
+
+    // The buffer is indexed by the global species so the ranks holding other species add zeros
+    std::vector<double> partial_sums(4 * n_species + 3 * n_spx, 0.0);
+    for (IdxSp const isp : idx_range_sp) {
+        int const isp_global = isp - m_idx_range_sp.front();
+        partial_sums[isp_global] = mass_host(isp);
+        partial_sums[n_species + isp_global] = l1_norm_host(isp);
+        partial_sums[2 * n_species + isp_global] = l2_norm_squared_host(isp);
+        partial_sums[3 * n_species + isp_global] = entropy_host(isp);
+        for (IdxX const ix : idx_range_x) {
+            int const ispx_global = isp_global * n_x + (ix - idx_range_x.front());
+            IdxSpX const ispx(isp, ix);
+            partial_sums[4 * n_species + ispx_global] = moment_0_host(ispx);
+            partial_sums[4 * n_species + n_spx + ispx_global] = moment_1_host(ispx);
+            partial_sums[4 * n_species + 2 * n_spx + ispx_global] = moment_2_host(ispx);
+        }
+    }
+    MPI_Allreduce(
+            MPI_IN_PLACE,
+            partial_sums.data(),
+            partial_sums.size(),
+            MPI_DOUBLE,
+            MPI_SUM,
+            m_comm);
+
+    double const* const sums = partial_sums.data();
+    m_mass.insert(m_mass.end(), sums, sums + n_species);
+    m_l1_norm.insert(m_l1_norm.end(), sums + n_species, sums + 2 * n_species);
+    for (int isp(0); isp < n_species; ++isp) {
+        m_l2_norm.push_back(std::sqrt(sums[2 * n_species + isp]));
+    }
+    m_entropy.insert(m_entropy.end(), sums + 3 * n_species, sums + 4 * n_species);
+    double const* const moment_0 = sums + 4 * n_species;
+    double const* const moment_1 = moment_0 + n_spx;
+    double const* const moment_2 = moment_1 + n_spx;
+    for (int i(0); i < n_spx; ++i) {
+        double const mean_velocity = moment_1[i] / moment_0[i];
+        m_density.push_back(moment_0[i]);
+        m_mean_velocity.push_back(mean_velocity);
+        m_temperature.push_back(moment_2[i] / moment_0[i] - mean_velocity * mean_velocity);
+    }
+
+    if (static_cast<int>(m_time.size()) >= m_records_per_write) {
+        write();
+    }
+    Kokkos::Profiling::popRegion();
+}
+
+void InSituDiagnostics::write()
+{
+    int n_records = m_time.size();
+    if (n_records == 0) {
+        return;
+    }
+    int n_modes = m_fourier_modes.size();
+    int n_species = m_mass.size() / n_records;
+    int n_x = (n_species == 0) ? 0 : m_density.size() / (n_records * n_species);
+
+    if (m_rank == 0) {
+        PDI_multi_expose(
+                "insitu_diagnostics",
+                "diag_write_index",
+                &m_write_index,
+                PDI_OUT,
+                "diag_n_records",
+                &n_records,
+                PDI_OUT,
+                "diag_n_modes",
+                &n_modes,
+                PDI_OUT,
+                "diag_n_species",
+                &n_species,
+                PDI_OUT,
+                "diag_n_x",
+                &n_x,
+                PDI_OUT,
+                "diag_fourier_modes",
+                m_fourier_modes.data(),
+                PDI_OUT,
+                "diag_time",
+                m_time.data(),
+                PDI_OUT,
+                "diag_electrostatic_energy",
+                m_electrostatic_energy.data(),
+                PDI_OUT,
+                "diag_fourier_amplitudes",
+                m_fourier_amplitudes.data(),
+                PDI_OUT,
+                "diag_mass",
+                m_mass.data(),
+                PDI_OUT,
+                "diag_l1_norm",
+                m_l1_norm.data(),
+                PDI_OUT,
+                "diag_l2_norm",
+                m_l2_norm.data(),
+                PDI_OUT,
+                "diag_entropy",
+                m_entropy.data(),
+                PDI_OUT,
+                "diag_density",
+                m_density.data(),
+                PDI_OUT,
+                "diag_mean_velocity",
+                m_mean_velocity.data(),
+                PDI_OUT,
+                "diag_temperature",
+                m_temperature.data(),
+                PDI_OUT,
+                NULL);
+    }
+
+    m_write_index += 1;
+    m_time.clear();
+    m_electrostatic_energy.clear();
+    m_fourier_amplitudes.clear();
+    m_mass.clear();
+    m_l1_norm.clear();
+    m_l2_norm.clear();
+    m_entropy.clear();
+    m_density.clear();
+    m_mean_velocity.clear();
+    m_temperature.clear();
+}
+
+int InSituDiagnostics::get_n_pending_records() const
+{
+    return m_time.size();
+}
@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <vector>
+
+#include <mpi.h>
+
+#include "geometry_xvx.hpp"
+#include "quadrature.hpp"
+
+/**
+ * @brief A class that computes reduced diagnostics of the simulation at every timestep.
+ *
+ * The reductions are computed on the device where the distribution function is stored. Only
+ * the results are copied to the host. They are accumulated in host buffers and written through
+ * PDI (event "insitu_diagnostics") every records_per_write calls. This allows the evolution of
+ * the system to be followed at every timestep without writing the full distribution function.
+ *
+ * The following quantities are computed at each call:
+ * - the electrostatic energy @f$ \frac{1}{2} \int E^2 dx @f$;
+ * - the amplitudes @f$ |\hat{\phi}_k| @f$ of the requested Fourier modes of the electrostatic
+ *   potential (the amplitude of the mode k is @f$ 2 |\frac{1}{L}\int \phi e^{-2i\pi k x/L} dx| @f$
+ *   for @f$ k > 0 @f$ and @f$ |\frac{1}{L}\int \phi dx| @f$ for @f$ k = 0 @f$);
+ * - the mass @f$ \int f dx dv @f$, the L1 norm @f$ \int |f| dx dv @f$, the L2 norm
+ *   @f$ \sqrt{\int f^2 dx dv} @f$ and the entropy @f$ -\int f \ln(f) dx dv @f$ (where the
+ *   integrand is restricted to @f$ f > 0 @f$) of each species;
+ * - the density, mean velocity and temperature profiles of each species.
+ *
+ * The distribution function may be distributed over MPI ranks along the species and the
+ * velocity dimensions (see VxSplit). The partial integrals of each local species over the
+ * local velocities are stored in a buffer indexed by the global species index (the entries of
+ * the species which are not local are zero) and the buffers are summed over the ranks. The
+ * written data is identical on all ranks so it is only written by rank 0.
+ */
+class InSituDiagnostics
+{
+private:
+    MPI_Comm m_comm;
+
+    int m_rank;
+
+    int m_records_per_write;
+
+    int m_write_index;
+
+    IdxRangeSp m_idx_range_sp;
+
+    std::vector<int> m_fourier_modes;
+
+    DFieldMem<IdxRangeXVx> m_quadrature_coeffs_xvx;
+
+    Quadrature<IdxRangeX> m_integrate_x;
+
+    Quadrature<IdxRangeVx, IdxRangeSpXVx> m_integrate_v;
+
+    Quadrature<IdxRangeXVx, IdxRangeSpXVx> m_integrate_xv;
+
+    double m_length_x;
+
+    // The records which have not been written yet
+    std::vector<double> m_time;
+    std::vector<double> m_electrostatic_energy;
+    std::vector<double> m_fourier_amplitudes;
+    std::vector<double> m_mass;
+    std::vector<double> m_l1_norm;
+    std::vector<double> m_l2_norm;
+    std::vector<double> m_entropy;
+    std::vector<double> m_density;
+    std::vector<double> m_mean_velocity;
+    std::vector<double> m_temperature;
+
+public:
+    /**
+     * @brief The constructor for the diagnostics.
+     *
+     * @param[in] comm The MPI communicator across which the species and the velocity dimension
+     *                  are distributed.
+     * @param[in] idx_range_sp The global index range of the kinetic species.
+     * @param[in] quadrature_coeffs_x The coefficients of the quadrature over the spatial
+     *                  dimension. They must be defined on the full spatial index range.
+     * @param[in] quadrature_coeffs_vx The coefficients of the quadrature over the velocity
+     *                  dimension. They must be defined on the local velocity index range.
+     * @param[in] fourier_modes The indices of the Fourier modes of the electrostatic potential
+     *                  whose amplitudes are computed.
+     * @param[in] records_per_write The number of records accumulated before they are written.
+     */
+    InSituDiagnostics(
+            MPI_Comm comm,
+            IdxRangeSp idx_range_sp,
+            DConstFieldX quadrature_coeffs_x,
+            DConstFieldVx quadrature_coeffs_vx,
+            std::vector<int> fourier_modes,
+            int records_per_write);
+
+    InSituDiagnostics(InSituDiagnostics const& x) = delete;
+
+    InSituDiagnostics& operator=(InSituDiagnostics const& x) = delete;
+
+    ~InSituDiagnostics() = default;
+
+    /**
+     * @brief Compute the diagnostics at the current time and record them.
+     *
+     * The records are written if records_per_write records have been accumulated.
+     * This function is collective over the communicator.
+     *
+     * @param[in] time The physical time.
+     * @param[in] allfdistribu The local part of the distribution function.
+     * @param[in] electrostatic_potential The electrostatic potential on the full spatial
+     *                  index range.
+     * @param[in] electric_field The electric field on the full spatial index range.
+     */
+    void operator()(
+            double time,
+            DConstFieldSpXVx allfdistribu,
+            DConstFieldX electrostatic_potential,
+            DConstFieldX electric_field);
+
+    /**
+     * @brief Write the records which have not been written yet.
+     *
+     * The following data is exposed by rank 0 with the PDI event "insitu_diagnostics":
+     * - diag_write_index : The number of previous writes.
+     * - diag_n_records : The number n of records written.
+     * - diag_n_modes : The number m of Fourier modes.
+     * - diag_n_species : The number s of species.
+     * - diag_n_x : The number of points along x.
+     * - diag_fourier_modes [m] : The indices of the Fourier modes.
+     * - diag_time [n] : The physical time of each record.
+     * - diag_electrostatic_energy [n] : The electrostatic energy.
+     * - diag_fourier_amplitudes [n, m] : The amplitudes of the Fourier modes.
+     * - diag_mass, diag_l1_norm, diag_l2_norm, diag_entropy [n, s] : The integrals
+     *   of the distribution function.
+     * - diag_density, diag_mean_velocity, diag_temperature [n, s, nx] : The fluid moments.
+     */
+    void write();
+
+    /**
+     * @brief Get the number of records which have not been written yet.
+     * @return The number of records.
+     */
+    int get_n_pending_records() const;
+};
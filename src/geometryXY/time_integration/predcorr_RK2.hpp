@@ -1,14 +1,19 @@
 // SPDX-License-Identifier: MIT
 
 #pragma once
+#include <algorithm>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <type_traits>
 
 #include <ddc/ddc.hpp>
 
 #include "bsl_advection_1d.hpp"
+#include "buffer_version.hpp"
+#include "cached_field_solver.hpp"
+#include "cfl_time_step_controller.hpp"
 #include "ddc_alias_inline_functions.hpp"
 #include "ddc_aliases.hpp"
 #include "geometry_xy.hpp"
@@ -38,15 +43,30 @@
  * Secondly, it advects on a full time step:
  * - 4./5. From @f$f^{n+1/2}@f$, it computes @f$E^{n+1/2}@f$ with a FFTPoissonSolver;
  * - 6. From @f$f^n@f$ and @f$E^{n+1/2}@f$, it computes @f$f^{n+1}@f$ with a BslAdvectionRP on @f$dt@f$.
+ *
+ * The field computed from @f$f^{n+1}@f$ for the output is stored (see CachedFieldSolver) and
+ * reused in step 1./2. of the next iteration instead of solving the Poisson equation again.
+ *
+ * The advections are computed either with a Strang splitting of two 1D advection operators
+ * (x on dt/2, y on dt, x on dt/2) or with a single unsplit 2D advection operator
+ * (e.g. BslAdvection2D) which takes the advection field as a vector field.
  * 
  * @tparam PoissonSolver Type of the Poisson solver applied in the method. 
- * @tparam AdvectionX Type of the 1D advection operator applied to advect along X. 
+ * @tparam AdvectionX Type of the 1D advection operator applied to advect along X, or of the
+ *                    2D advection operator applied to advect along X and Y.
  * @tparam AdvectionY Type of the 1D advection operator applied to advect along Y. 
  */
-template <class PoissonSolver, class AdvectionX, class AdvectionY>
+template <class PoissonSolver, class AdvectionX, class AdvectionY = AdvectionX>
 class PredCorrRK2XY
 {
 private:
+    // True if AdvectionX advects along X and Y at once.
+    static constexpr bool is_unsplit_advection = std::is_invocable_v<
+            AdvectionX const&,
+            DFieldXY,
+            VectorConstFieldXY_XY,
+            double>;
+
     PoissonSolver const& m_poisson_solver;
 
     AdvectionX const& m_advection_x;
@@ -68,6 +88,17 @@ public:
         , m_advection_x(advection_x)
         , m_advection_y(advection_y) {};
 
+    /**
+     * @brief Instantiate the predictor-corrector with an unsplit 2D advection.
+     * @param poisson_solver Poisson solver also computing the electric field.  
+     * @param advection_xy 2D advection operator along the @f$ x @f$ and @f$ y @f$ directions.
+     */
+    PredCorrRK2XY(PoissonSolver const& poisson_solver, AdvectionX const& advection_xy)
+        requires(std::is_same_v<AdvectionX, AdvectionY>)
+        : m_poisson_solver(poisson_solver)
+        , m_advection_x(advection_xy)
+        , m_advection_y(advection_xy) {};
+
     ~PredCorrRK2XY() = default;
 
     /**
@@ -97,96 +128,233 @@ public:
         // Definition of the RK2
         RK2<DFieldMemXY, VectorFieldMemXY_XY> predictor_corrector(meshXY);
 
-        // Computation of the advection field: Poisson equation ---
+        // The fields computed from allfdistribu for the output are reused by the first stage
+        // of the next RK2 step
+        BufferVersion allfdistribu_version(allfdistribu);
+        CachedFieldSolver<PoissonSolver, DFieldMemXY, VectorFieldMemXY_XY> const
+                poisson_solver(m_poisson_solver, allfdistribu_version, meshXY);
+
         std::function<void(VectorFieldXY_XY, DConstFieldXY)> define_electric_field
                 = [&](VectorFieldXY_XY electric_field, DConstFieldXY allfdistribu_const) {
-                      IdxRangeXY idx_range_xy(get_idx_range<GridX, GridY>(allfdistribu_const));
-
-                      // --- compute electrostatic potential and electric field:
-                      DFieldMemXY electrostatic_potential_alloc(
-                              "electrostatic_potential (PredCorrRK2XY::operator()::[])",
-                              idx_range_xy);
-                      DFieldXY electrostatic_potential = get_field(electrostatic_potential_alloc);
-
-                      /*
-                        The applied Poisson solver needs a modifiable field for allfdistribu.
-                        The time stepper uses a constant field type. So we create a temporary  
-                        allfdistribu_alloc chunk containing the values of the constant 
-                        allfdistribu to solve the type conflict in the Poisson solver. 
-                      */
-                      DFieldMemXY allfdistribu_alloc(
-                              "allfdistribu (PredCorrRK2XY::operator()::[])",
-                              idx_range_xy);
-                      DFieldXY allfdistribu = get_field(allfdistribu_alloc);
-                      ddc::parallel_deepcopy(
-                              Kokkos::DefaultExecutionSpace(),
-                              allfdistribu,
-                              allfdistribu_const);
-
-
-                      m_poisson_solver(electrostatic_potential, electric_field, allfdistribu);
+                      if (allfdistribu_version.tracks(allfdistribu_const.data_handle())) {
+                          poisson_solver(electrostatic_potential, electric_field, allfdistribu);
+                      } else {
+                          compute_electric_field(electric_field, allfdistribu_const);
+                      }
                   };
-
-        // Advection operator ---
         std::function<void(DFieldXY, VectorConstFieldXY_XY, double)> advect_allfdistribu
                 = [&](DFieldXY allfdistribu, VectorConstFieldXY_XY electric_field, double dt) {
-                      DConstFieldXY electric_field_x(ddcHelper::get<X>(electric_field));
-                      DConstFieldXY electric_field_y(ddcHelper::get<Y>(electric_field));
-
-                      // --- compute advection field:
-                      IdxRangeXY idx_range = get_idx_range(electric_field);
-                      DFieldMemXY advection_field_x_alloc(
-                              "advection_field_x (PredCorrRK2XY::operator()::[])",
-                              idx_range);
-                      DFieldMemXY advection_field_y_alloc(
-                              "advection_field_y (PredCorrRK2XY::operator()::[])",
-                              idx_range);
-                      DFieldXY advection_field_x = get_field(advection_field_x_alloc);
-                      DFieldXY advection_field_y = get_field(advection_field_y_alloc);
-                      const std::source_location location = std::source_location::current();
-                      ddc::parallel_for_each(
-                              location.function_name(),
-                              Kokkos::DefaultExecutionSpace(),
-                              meshXY,
-                              KOKKOS_LAMBDA(IdxXY const i_xy) {
-                                  advection_field_x(i_xy) = -electric_field_y(i_xy);
-                                  advection_field_y(i_xy) = electric_field_x(i_xy);
-                              });
-
-
-                      // --- Strang splitting for the advection
-                      m_advection_x(allfdistribu, advection_field_x, dt / 2);
-                      m_advection_y(allfdistribu, advection_field_y, dt);
-                      m_advection_x(allfdistribu, advection_field_x, dt / 2);
+                      advect(allfdistribu, electric_field, dt);
                   };
 
-
-
         // Iteration on the number of steps.
         for (int iter(1); iter < nbiter + 1; ++iter) {
+            Kokkos::Profiling::pushRegion("(GSLX) Time step");
             predictor_corrector
                     .update(Kokkos::DefaultExecutionSpace(),
                             allfdistribu,
                             dt,
                             define_electric_field,
                             advect_allfdistribu);
+            allfdistribu_version.increment();
 
             // Save the data ---
-            m_poisson_solver(electrostatic_potential, electric_field, allfdistribu);
-            auto allfdistribu_host = ddc::create_mirror_and_copy(allfdistribu);
-            auto electrostatic_potential_host
-                    = ddc::create_mirror_and_copy(electrostatic_potential);
-            auto electric_field_x_host
-                    = ddc::create_mirror_and_copy(ddcHelper::get<X>(electric_field));
-            auto electric_field_y_host
-                    = ddc::create_mirror_and_copy(ddcHelper::get<Y>(electric_field));
-            ddc::PdiEvent("iteration")
-                    .with("iter", iter)
-                    .with("time_saved", iter * dt)
-                    .with("fdistribu", allfdistribu_host)
-                    .with("electrostatic_potential", electrostatic_potential_host)
-                    .with("electric_field_x", electric_field_x_host)
-                    .with("electric_field_y", electric_field_y_host);
+            poisson_solver(electrostatic_potential, electric_field, allfdistribu);
+            save(iter, iter * dt, allfdistribu, electrostatic_potential, electric_field);
+            Kokkos::Profiling::popRegion();
         }
     };
+
+    /**
+     * @brief Apply the predictor-corrector method with a time step chosen from a CFL condition.
+     *
+     * At each iteration the time step is chosen from the maximum number of cells crossed per
+     * unit of time by the characteristics: @f$ \max(|E_y|/\Delta x + |E_x|/\Delta y) @f$.
+     * The data are saved at each output time with iter equal to the index of the output.
+     *
+     * @param allfdistribu Initial function  @f$f (0, x, y)@f$.
+     * @param final_time The physical time at the end of the simulation.
+     * @param time_step_controller The object choosing the time step and the output times.
+     */
+    void operator()(
+            DFieldXY allfdistribu,
+            double const final_time,
+            CFLTimeStepController const& time_step_controller)
+    {
+        // Index range
+        IdxRangeXY const meshXY = get_idx_range(allfdistribu);
+
+        // Output of the Poisson solver
+        DFieldMemXY electrostatic_potential_alloc(
+                "electrostatic_potential (PredCorrRK2XY::operator())",
+                meshXY);
+        DFieldXY electrostatic_potential = get_field(electrostatic_potential_alloc);
+
+        VectorFieldMemXY_XY
+                electric_field_alloc("electri_field (PredCorrRK2XY::operator())", meshXY);
+        VectorFieldXY_XY electric_field = get_field(electric_field_alloc);
+
+        // Definition of the RK2
+        RK2<DFieldMemXY, VectorFieldMemXY_XY> predictor_corrector(meshXY);
+
+        // The fields computed from allfdistribu for the output are reused by the first stage
+        // of the next RK2 step
+        BufferVersion allfdistribu_version(allfdistribu);
+        CachedFieldSolver<PoissonSolver, DFieldMemXY, VectorFieldMemXY_XY> const
+                poisson_solver(m_poisson_solver, allfdistribu_version, meshXY);
+
+        std::function<void(VectorFieldXY_XY, DConstFieldXY)> define_electric_field
+                = [&](VectorFieldXY_XY electric_field, DConstFieldXY allfdistribu_const) {
+                      if (allfdistribu_version.tracks(allfdistribu_const.data_handle())) {
+                          poisson_solver(electrostatic_potential, electric_field, allfdistribu);
+                      } else {
+                          compute_electric_field(electric_field, allfdistribu_const);
+                      }
+                  };
+        std::function<void(DFieldXY, VectorConstFieldXY_XY, double)> advect_allfdistribu
+                = [&](DFieldXY allfdistribu, VectorConstFieldXY_XY electric_field, double dt) {
+                      advect(allfdistribu, electric_field, dt);
+                  };
+
+        double const min_dx = min_cell_width(ddc::select<GridX>(meshXY));
+        double const min_dy = min_cell_width(ddc::select<GridY>(meshXY));
+        double const output_period = time_step_controller.get_output_period();
+
+        poisson_solver(electrostatic_potential, electric_field, allfdistribu);
+
+        const std::source_location location = std::source_location::current();
+        int output_iter = 0;
+        double time = 0.;
+        double next_output_time = std::min(output_period, final_time);
+        while (time < final_time) {
+            Kokkos::Profiling::pushRegion("(GSLX) Time step");
+            DConstFieldXY electric_field_x(ddcHelper::get<X>(electric_field));
+            DConstFieldXY electric_field_y(ddcHelper::get<Y>(electric_field));
+            double const max_displacement_rate = ddc::parallel_transform_reduce(
+                    location.function_name(),
+                    Kokkos::DefaultExecutionSpace(),
+                    meshXY,
+                    0.0,
+                    ddc::reducer::max<double>(),
+                    KOKKOS_LAMBDA(IdxXY const i_xy) {
+                        return Kokkos::abs(electric_field_y(i_xy)) / min_dx
+                               + Kokkos::abs(electric_field_x(i_xy)) / min_dy;
+                    });
+            double const time_to_output = next_output_time - time;
+            double const dt
+                    = time_step_controller.get_time_step(max_displacement_rate, time_to_output);
+
+            predictor_corrector
+                    .update(Kokkos::DefaultExecutionSpace(),
+                            allfdistribu,
+                            dt,
+                            define_electric_field,
+                            advect_allfdistribu);
+            allfdistribu_version.increment();
+            time = (dt == time_to_output) ? next_output_time : time + dt;
+
+            poisson_solver(electrostatic_potential, electric_field, allfdistribu);
+            if (time == next_output_time) {
+                ++output_iter;
+                save(output_iter, time, allfdistribu, electrostatic_potential, electric_field);
+                next_output_time = std::min((output_iter + 1) * output_period, final_time);
+            }
+            Kokkos::Profiling::popRegion();
+        }
+    };
+
+    /**
+     * @brief Compute the electric field from the distribution function.
+     *
+     * @param[out] electric_field The electric field.
+     * @param[in] allfdistribu_const The distribution function.
+     */
+    void compute_electric_field(VectorFieldXY_XY electric_field, DConstFieldXY allfdistribu_const)
+            const
+    {
+        IdxRangeXY idx_range_xy(get_idx_range<GridX, GridY>(allfdistribu_const));
+
+        // --- compute electrostatic potential and electric field:
+        DFieldMemXY electrostatic_potential_alloc(
+                "electrostatic_potential (PredCorrRK2XY::compute_electric_field())",
+                idx_range_xy);
+        DFieldXY electrostatic_potential = get_field(electrostatic_potential_alloc);
+
+        /*
+          The applied Poisson solver needs a modifiable field for allfdistribu.
+          The time stepper uses a constant field type. So we create a temporary  
+          allfdistribu_alloc chunk containing the values of the constant 
+          allfdistribu to solve the type conflict in the Poisson solver. 
+        */
+        DFieldMemXY allfdistribu_alloc(
+                "allfdistribu (PredCorrRK2XY::compute_electric_field())",
+                idx_range_xy);
+        DFieldXY allfdistribu = get_field(allfdistribu_alloc);
+        ddc::parallel_deepcopy(Kokkos::DefaultExecutionSpace(), allfdistribu, allfdistribu_const);
+
+        m_poisson_solver(electrostatic_potential, electric_field, allfdistribu);
+    }
+
+    /**
+     * @brief Advect the distribution function in the advection field (-E_y, E_x).
+     *
+     * This function should be private. It is not due to the inclusion of a KOKKOS_LAMBDA.
+     *
+     * @param[inout] allfdistribu The distribution function.
+     * @param[in] electric_field The electric field.
+     * @param[in] dt The time step.
+     */
+    void advect(DFieldXY allfdistribu, VectorConstFieldXY_XY electric_field, double dt) const
+    {
+        DConstFieldXY electric_field_x(ddcHelper::get<X>(electric_field));
+        DConstFieldXY electric_field_y(ddcHelper::get<Y>(electric_field));
+
+        // --- compute advection field:
+        IdxRangeXY idx_range = get_idx_range(electric_field);
+        VectorFieldMemXY_XY
+                advection_field_alloc("advection_field (PredCorrRK2XY::advect())", idx_range);
+        VectorFieldXY_XY advection_field = get_field(advection_field_alloc);
+        DFieldXY advection_field_x = ddcHelper::get<X>(advection_field);
+        DFieldXY advection_field_y = ddcHelper::get<Y>(advection_field);
+        const std::source_location location = std::source_location::current();
+        ddc::parallel_for_each(
+                location.function_name(),
+                Kokkos::DefaultExecutionSpace(),
+                idx_range,
+                KOKKOS_LAMBDA(IdxXY const i_xy) {
+                    advection_field_x(i_xy) = -electric_field_y(i_xy);
+                    advection_field_y(i_xy) = electric_field_x(i_xy);
+                });
+
+        if constexpr (is_unsplit_advection) {
+            // --- Unsplit 2D advection
+            m_advection_x(allfdistribu, get_const_field(advection_field), dt);
+        } else {
+            // --- Strang splitting for the advection
+            m_advection_x(allfdistribu, advection_field_x, dt / 2);
+            m_advection_y(allfdistribu, advection_field_y, dt);
+            m_advection_x(allfdistribu, advection_field_x, dt / 2);
+        }
+    }
+
+private:
+    void save(
+            int iter,
+            double time,
+            DFieldXY allfdistribu,
+            DFieldXY electrostatic_potential,
+            VectorFieldXY_XY electric_field) const
+    {
+        auto allfdistribu_host = ddc::create_mirror_and_copy(allfdistribu);
+        auto electrostatic_potential_host = ddc::create_mirror_and_copy(electrostatic_potential);
+        auto electric_field_x_host = ddc::create_mirror_and_copy(ddcHelper::get<X>(electric_field));
+        auto electric_field_y_host = ddc::create_mirror_and_copy(ddcHelper::get<Y>(electric_field));
+        ddc::PdiEvent("iteration")
+                .with("iter", iter)
+                .with("time_saved", time)
+                .with("fdistribu", allfdistribu_host)
+                .with("electrostatic_potential", electrostatic_potential_host)
+                .with("electric_field_x", electric_field_x_host)
+                .with("electric_field_y", electric_field_y_host);
+    }
 };
@@ -9,7 +9,10 @@
 
 ChargeDensityCalculator::ChargeDensityCalculator(DConstFieldVxVy coeffs) : m_quadrature(coeffs) {}
 
-void ChargeDensityCalculator::operator()(DFieldXY rho, DConstFieldSpVxVyXY allfdistribu) const
+template <class ElementType>
+void ChargeDensityCalculator::compute_rho(
+        DFieldXY rho,
+        ConstFieldSpVxVyXY<ElementType> allfdistribu) const
 {
     Kokkos::Profiling::pushRegion("(GSLX) ChargeDensityCalculator");
 
@@ -46,3 +49,14 @@ void ChargeDensityCalculator::operator()(DFieldXY rho, DConstFieldSpVxVyXY allfd
 
     Kokkos::Profiling::popRegion();
 }
+
+void ChargeDensityCalculator::operator()(DFieldXY rho, DConstFieldSpVxVyXY allfdistribu) const
+{
+    compute_rho(rho, allfdistribu);
+}
+
+void ChargeDensityCalculator::operator()(DFieldXY rho, ConstFieldSpVxVyXY<float> allfdistribu)
+        const
+{
+    compute_rho(rho, allfdistribu);
+}
@@ -36,4 +36,21 @@ public:
      * @param[in] allfdistribu 
      */
     void operator()(DFieldXY rho, DConstFieldSpVxVyXY allfdistribu) const final;
+
+    /**
+     * @brief Computes the charge density rho from a distribution function stored in single
+     * precision. The integral is accumulated in double precision.
+     * @param[in, out] rho
+     * @param[in] allfdistribu 
+     */
+    void operator()(DFieldXY rho, ConstFieldSpVxVyXY<float> allfdistribu) const final;
+
+    /**
+     * @brief Computes the charge density rho from the distribution function.
+     * This function should be private. It is not due to the inclusion of a KOKKOS_LAMBDA.
+     * @param[in, out] rho
+     * @param[in] allfdistribu 
+     */
+    template <class ElementType>
+    void compute_rho(DFieldXY rho, ConstFieldSpVxVyXY<ElementType> allfdistribu) const;
 };
@@ -29,4 +29,14 @@ public:
      * @param[in] allfdistribu The distribution function.
      */
     virtual void operator()(DFieldXY rho, DConstFieldSpVxVyXY allfdistribu) const = 0;
+
+    /**
+     * Calculate the charge density rho from a distribution function stored in single precision.
+     *
+     * The integral is accumulated in double precision.
+     *
+     * @param[out] rho The charge density.
+     * @param[in] allfdistribu The distribution function.
+     */
+    virtual void operator()(DFieldXY rho, ConstFieldSpVxVyXY<float> allfdistribu) const = 0;
 };
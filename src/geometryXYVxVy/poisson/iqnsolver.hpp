@@ -31,4 +31,17 @@ public:
             DFieldXY electrostatic_potential,
             DVectorFieldXY electric_field,
             DConstFieldSpVxVyXY allfdistribu) const = 0;
+
+    /**
+     * The operator which solves the equation using the method described by the class
+     * for a distribution function stored in single precision.
+     *
+     * @param[out] electrostatic_potential The electrostatic potential, the result of the poisson solver.
+     * @param[out] electric_field The electric field, the gradient of the electrostatic potential.
+     * @param[in] allfdistribu The distribution function.
+     */
+    virtual void operator()(
+            DFieldXY electrostatic_potential,
+            DVectorFieldXY electric_field,
+            ConstFieldSpVxVyXY<float> allfdistribu) const = 0;
 };
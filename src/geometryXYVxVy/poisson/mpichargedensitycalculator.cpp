@@ -16,7 +16,10 @@ MpiChargeDensityCalculator::MpiChargeDensityCalculator(
 {
 }
 
-void MpiChargeDensityCalculator::operator()(DFieldXY rho, DConstFieldSpVxVyXY allfdistribu) const
+template <class ElementType>
+void MpiChargeDensityCalculator::compute_rho(
+        DFieldXY rho,
+        ConstFieldSpVxVyXY<ElementType> allfdistribu) const
 {
     Kokkos::Profiling::pushRegion("(GSLX) MpiChargeDensityCalculator");
 
@@ -39,3 +42,15 @@ void MpiChargeDensityCalculator::operator()(DFieldXY rho, DConstFieldSpVxVyXY al
 
     Kokkos::Profiling::popRegion();
 }
+
+void MpiChargeDensityCalculator::operator()(DFieldXY rho, DConstFieldSpVxVyXY allfdistribu) const
+{
+    compute_rho(rho, allfdistribu);
+}
+
+void MpiChargeDensityCalculator::operator()(
+        DFieldXY rho,
+        ConstFieldSpVxVyXY<float> allfdistribu) const
+{
+    compute_rho(rho, allfdistribu);
+}
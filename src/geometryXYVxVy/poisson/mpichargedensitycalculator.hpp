@@ -25,6 +25,9 @@ private:
     IChargeDensityCalculator const& m_local_charge_density_calculator;
     MPI_Comm m_comm;
 
+    template <class ElementType>
+    void compute_rho(DFieldXY rho, ConstFieldSpVxVyXY<ElementType> allfdistribu) const;
+
 public:
     /**
      * @brief Create a MpiChargeDensityCalculator object.
@@ -44,4 +47,12 @@ public:
      * @param[in] allfdistribu 
      */
     void operator()(DFieldXY rho, DConstFieldSpVxVyXY allfdistribu) const final;
+
+    /**
+     * @brief Computes the charge density rho from a distribution function stored in single
+     * precision. The integral is accumulated in double precision.
+     * @param[in, out] rho
+     * @param[in] allfdistribu 
+     */
+    void operator()(DFieldXY rho, ConstFieldSpVxVyXY<float> allfdistribu) const final;
 };
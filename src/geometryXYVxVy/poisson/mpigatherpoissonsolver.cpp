@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: MIT
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_helper.hpp"
+#include "mpigatherpoissonsolver.hpp"
+#include "mpitools.hpp"
+
+MpiGatherPoissonSolver::MpiGatherPoissonSolver(
+        MPI_Comm comm,
+        PoissonSolver const& global_poisson_solver,
+        IdxRangeXY global_idx_range)
+    : m_global_poisson_solver(global_poisson_solver)
+    , m_global_idx_range(global_idx_range)
+    , m_comm(comm)
+{
+}
+
+void MpiGatherPoissonSolver::gather_charge_density(
+        DFieldXY const global_rho,
+        DConstFieldXY const local_rho) const
+{
+    DFieldMemXY rho_contribution_alloc(
+            "rho_contribution (MpiGatherPoissonSolver::gather_charge_density())",
+            m_global_idx_range);
+    DFieldXY rho_contribution = get_field(rho_contribution_alloc);
+    ddc::parallel_fill(rho_contribution, 0.0);
+    ddc::parallel_deepcopy(rho_contribution[get_idx_range(local_rho)], local_rho);
+
+    Kokkos::DefaultExecutionSpace().fence("Fence local charge density");
+
+    MPI_Allreduce(
+            rho_contribution.data_handle(),
+            global_rho.data_handle(),
+            global_rho.size(),
+            MPI_type_descriptor_t<double>,
+            MPI_SUM,
+            m_comm);
+}
+
+MpiGatherPoissonSolver::field_type MpiGatherPoissonSolver::operator()(
+        field_type const phi,
+        field_type const rho) const
+{
+    Kokkos::Profiling::pushRegion("(GSLX) MpiGatherPoissonSolver");
+    DFieldMemXY global_rho(m_global_idx_range);
+    DFieldMemXY global_phi(m_global_idx_range);
+    gather_charge_density(get_field(global_rho), get_const_field(rho));
+
+    m_global_poisson_solver(get_field(global_phi), get_field(global_rho));
+
+    ddc::parallel_deepcopy(phi, global_phi[get_idx_range(phi)]);
+    Kokkos::Profiling::popRegion();
+    return phi;
+}
+
+MpiGatherPoissonSolver::field_type MpiGatherPoissonSolver::operator()(
+        field_type const phi,
+        vector_field_type const E,
+        field_type const rho) const
+{
+    Kokkos::Profiling::pushRegion("(GSLX) MpiGatherPoissonSolver");
+    IdxRangeXY const local_idx_range = get_idx_range(phi);
+    DFieldMemXY global_rho(m_global_idx_range);
+    DFieldMemXY global_phi(m_global_idx_range);
+    DVectorFieldMemXY global_E(m_global_idx_range);
+    gather_charge_density(get_field(global_rho), get_const_field(rho));
+
+    m_global_poisson_solver(get_field(global_phi), get_field(global_E), get_field(global_rho));
+
+    ddc::parallel_deepcopy(phi, global_phi[local_idx_range]);
+    ddc::parallel_deepcopy(ddcHelper::get<X>(E), ddcHelper::get<X>(global_E)[local_idx_range]);
+    ddc::parallel_deepcopy(ddcHelper::get<Y>(E), ddcHelper::get<Y>(global_E)[local_idx_range]);
+    Kokkos::Profiling::popRegion();
+    return phi;
+}
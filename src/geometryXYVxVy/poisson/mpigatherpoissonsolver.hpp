@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <mpi.h>
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_aliases.hpp"
+#include "geometry_xyvxvy.hpp"
+#include "ipoisson_solver.hpp"
+
+/**
+ * @brief A Poisson solver for a charge density distributed across MPI ranks along
+ * the spatial dimensions.
+ *
+ * Each rank provides the charge density on its local spatial index range. The local
+ * charge densities are summed into the global charge density on every rank, the global
+ * equation is solved by the wrapped Poisson solver and the local parts of the
+ * electrostatic potential and of the electric field are returned.
+ *
+ * This allows the Vlasov-Poisson solver to keep the distribution function distributed
+ * along the spatial dimensions (see MpiBslAdvectionSpatial). Only spatial (2D) quantities
+ * are communicated.
+ */
+class MpiGatherPoissonSolver
+    : public IPoissonSolver<
+              IdxRangeXY,
+              IdxRangeXY,
+              double,
+              typename Kokkos::DefaultExecutionSpace::memory_space,
+              Kokkos::layout_right>
+{
+    using PoissonSolver = IPoissonSolver<
+            IdxRangeXY,
+            IdxRangeXY,
+            double,
+            typename Kokkos::DefaultExecutionSpace::memory_space,
+            Kokkos::layout_right>;
+
+    PoissonSolver const& m_global_poisson_solver;
+    IdxRangeXY m_global_idx_range;
+    MPI_Comm m_comm;
+
+    void gather_charge_density(DFieldXY global_rho, DConstFieldXY local_rho) const;
+
+public:
+    /**
+     * @brief Create a MpiGatherPoissonSolver object.
+     * @param[in] comm The MPI communicator across which the charge density is distributed.
+     * @param[in] global_poisson_solver A Poisson solver acting on the global spatial index range.
+     * @param[in] global_idx_range The global spatial index range.
+     */
+    MpiGatherPoissonSolver(
+            MPI_Comm comm,
+            PoissonSolver const& global_poisson_solver,
+            IdxRangeXY global_idx_range);
+
+    ~MpiGatherPoissonSolver() override = default;
+
+    /**
+     * @brief Computes the local part of the solution of Poisson's equation.
+     *
+     * @param[out] phi The solution to Poisson's equation on the local index range.
+     * @param[in] rho The right-hand side of Poisson's equation on the local index range.
+     *
+     * @return A reference to the solution to Poisson's equation.
+     */
+    field_type operator()(field_type phi, field_type rho) const final;
+
+    /**
+     * @brief Computes the local part of the solution of Poisson's equation and of its
+     * derivative.
+     *
+     * @param[out] phi The solution to Poisson's equation on the local index range.
+     * @param[out] E The derivative of the solution to Poisson's equation on the local index range.
+     * @param[in] rho The right-hand side of Poisson's equation on the local index range.
+     *
+     * @return A reference to the solution to Poisson's equation.
+     */
+    field_type operator()(field_type phi, vector_field_type E, field_type rho) const final;
+};
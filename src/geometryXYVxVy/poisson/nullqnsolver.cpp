@@ -5,3 +5,10 @@
 void NullQNSolver::operator()(DFieldXY const, DVectorFieldXY const, DConstFieldSpVxVyXY const) const
 {
 }
+
+void NullQNSolver::operator()(
+        DFieldXY const,
+        DVectorFieldXY const,
+        ConstFieldSpVxVyXY<float> const) const
+{
+}
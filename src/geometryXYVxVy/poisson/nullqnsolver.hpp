@@ -26,4 +26,15 @@ public:
             DFieldXY electrostatic_potential,
             DVectorFieldXY electric_field,
             DConstFieldSpVxVyXY allfdistribu) const override;
+
+    /** @brief A QN Solver which does nothing
+     *
+     * @param[out] electrostatic_potential The electrostatic potential, the result of the poisson solver.
+     * @param[out] electric_field The electric field, the gradient of the electrostatic potential.
+     * @param[in] allfdistribu The distribution function stored in single precision.
+     */
+    void operator()(
+            DFieldXY electrostatic_potential,
+            DVectorFieldXY electric_field,
+            ConstFieldSpVxVyXY<float> allfdistribu) const override;
 };
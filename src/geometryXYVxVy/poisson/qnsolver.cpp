@@ -18,10 +18,11 @@ QNSolver::QNSolver(PoissonSolver const& solve_poisson, IChargeDensityCalculator
 {
 }
 
-void QNSolver::operator()(
+template <class ElementType>
+void QNSolver::solve(
         DFieldXY const electrostatic_potential,
         DVectorFieldXY const electric_field,
-        DConstFieldSpVxVyXY const allfdistribu) const
+        ConstFieldSpVxVyXY<ElementType> const allfdistribu) const
 {
     Kokkos::Profiling::pushRegion("(GSLX) QNSolver");
     assert((get_idx_range(electrostatic_potential) == get_idx_range<GridX, GridY>(allfdistribu)));
@@ -36,3 +37,19 @@ void QNSolver::operator()(
 
     Kokkos::Profiling::popRegion();
 }
+
+void QNSolver::operator()(
+        DFieldXY const electrostatic_potential,
+        DVectorFieldXY const electric_field,
+        DConstFieldSpVxVyXY const allfdistribu) const
+{
+    solve(electrostatic_potential, electric_field, allfdistribu);
+}
+
+void QNSolver::operator()(
+        DFieldXY const electrostatic_potential,
+        DVectorFieldXY const electric_field,
+        ConstFieldSpVxVyXY<float> const allfdistribu) const
+{
+    solve(electrostatic_potential, electric_field, allfdistribu);
+}
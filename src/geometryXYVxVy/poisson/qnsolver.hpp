@@ -29,6 +29,12 @@ class QNSolver : public IQNSolver
     PoissonSolver const& m_solve_poisson;
     IChargeDensityCalculator const& m_compute_rho;
 
+    template <class ElementType>
+    void solve(
+            DFieldXY electrostatic_potential,
+            DVectorFieldXY electric_field,
+            ConstFieldSpVxVyXY<ElementType> allfdistribu) const;
+
 public:
     /**
      * Construct the QNSolver operator.
@@ -51,4 +57,18 @@ public:
             DFieldXY electrostatic_potential,
             DVectorFieldXY electric_field,
             DConstFieldSpVxVyXY allfdistribu) const override;
+
+    /**
+     * The operator which solves the equation using the method described by the class
+     * for a distribution function stored in single precision. The charge density and
+     * the field solve are computed in double precision.
+     *
+     * @param[out] electrostatic_potential The electrostatic potential, the result of the poisson solver.
+     * @param[out] electric_field The electric field, the gradient of the electrostatic potential.
+     * @param[in] allfdistribu The distribution function.
+     */
+    void operator()(
+            DFieldXY electrostatic_potential,
+            DVectorFieldXY electric_field,
+            ConstFieldSpVxVyXY<float> allfdistribu) const override;
 };
@@ -23,4 +23,19 @@ public:
      */
     virtual DFieldSpVxVyXY operator()(DFieldSpVxVyXY allfdistribu, double dt, int steps = 1)
             const = 0;
+
+    /**
+     * @brief Solves the Vlasov-Poisson system for a distribution function stored in single
+     * precision.
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function.
+     *                              On output : the value of the distribution function after solving
+     *                              the Vlasov-Poisson system a given number of iterations.
+     * @param[in] dt The timestep.
+     * @param[in] steps The number of iterations to be performed by the predictor-corrector.
+     * @return The distribution function after solving the system.
+     */
+    virtual FieldSpVxVyXY<float> operator()(
+            FieldSpVxVyXY<float> allfdistribu,
+            double dt,
+            int steps = 1) const = 0;
 };
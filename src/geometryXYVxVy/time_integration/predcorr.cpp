@@ -2,32 +2,94 @@
 
 #include <cmath>
 #include <iostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
 
 #include <ddc/ddc.hpp>
 #include <ddc/pdi.hpp>
 
 #include "ddc_alias_inline_functions.hpp"
+#include "ddc_helper.hpp"
+#include "first_touch.hpp"
 #include "iqnsolver.hpp"
 #include "ivlasovsolver.hpp"
 #include "predcorr.hpp"
+#include "species_info.hpp"
 #include "transpose.hpp"
 
-PredCorr::PredCorr(IVlasovSolver const& vlasov_solver, IQNSolver const& poisson_solver)
+PredCorr::PredCorr(
+        IVlasovSolver const& vlasov_solver,
+        IQNSolver const& poisson_solver,
+        bool const single_precision_output)
     : m_vlasov_solver(vlasov_solver)
     , m_poisson_solver(poisson_solver)
+    , m_predictor_poisson_solver(nullptr)
+    , m_single_precision_output(single_precision_output)
 {
 }
 
-DFieldSpVxVyXY PredCorr::operator()(
-        DFieldSpVxVyXY const allfdistribu_v2D_split,
+PredCorr::PredCorr(
+        IVlasovSolver const& vlasov_solver,
+        IQNSolver const& poisson_solver,
+        PoissonSolver const& predictor_poisson_solver,
+        DConstFieldVxVy const quadrature_coeffs,
+        bool const single_precision_output)
+    : m_vlasov_solver(vlasov_solver)
+    , m_poisson_solver(poisson_solver)
+    , m_predictor_poisson_solver(&predictor_poisson_solver)
+    , m_quadrature_coeffs(quadrature_coeffs)
+    , m_single_precision_output(single_precision_output)
+{
+}
+
+template <class ElementType>
+FieldSpVxVyXY<ElementType> PredCorr::solve(
+        FieldSpVxVyXY<ElementType> const allfdistribu_v2D_split,
         double const dt,
         int const steps) const
 {
+    if (m_predictor_poisson_solver
+        && get_idx_range<Species>(allfdistribu_v2D_split)
+                   != get_idx_range(ddc::host_discrete_space<Species>().charges())) {
+        throw std::runtime_error("The fused predictor does not handle adiabatic species.");
+    }
+
     IdxRangeSpXYVxVy idx_range_v2D_split_output_layout(get_idx_range(allfdistribu_v2D_split));
-    DFieldMemSpXYVxVy allfdistribu_v2D_split_output_layout(idx_range_v2D_split_output_layout);
+    FieldMemSpXYVxVy<ElementType> allfdistribu_v2D_split_output_layout(
+            idx_range_v2D_split_output_layout);
+    first_touch(Kokkos::DefaultExecutionSpace(), get_field(allfdistribu_v2D_split_output_layout));
     auto allfdistribu_host_alloc
             = ddc::create_mirror_view(get_field(allfdistribu_v2D_split_output_layout));
-    host_t<DFieldSpXYVxVy> allfdistribu_host = get_field(allfdistribu_host_alloc);
+    host_t<FieldSpXYVxVy<ElementType>> allfdistribu_host = get_field(allfdistribu_host_alloc);
+
+    // The distribution function is written in double precision whatever its storage precision
+    // unless single precision output is requested
+    bool const convert_output_to_double
+            = !std::is_same_v<ElementType, double> && !m_single_precision_output;
+    host_t<DFieldMemSpXYVxVy> allfdistribu_output_alloc(
+            convert_output_to_double ? idx_range_v2D_split_output_layout : IdxRangeSpXYVxVy());
+    host_t<DFieldSpXYVxVy> allfdistribu_output;
+    if constexpr (std::is_same_v<ElementType, double>) {
+        allfdistribu_output = allfdistribu_host;
+    } else {
+        allfdistribu_output = get_field(allfdistribu_output_alloc);
+    }
+
+    // In single precision output a double precision distribution function is converted on the
+    // device so only half of the data is copied to the host
+    bool const convert_output_to_float
+            = std::is_same_v<ElementType, double> && m_single_precision_output;
+    FieldMemSpXYVxVy<float> allfdistribu_float_alloc(
+            convert_output_to_float ? idx_range_v2D_split_output_layout : IdxRangeSpXYVxVy());
+    auto allfdistribu_float_host_alloc
+            = ddc::create_mirror_view(get_field(allfdistribu_float_alloc));
+    host_t<FieldSpXYVxVy<float>> allfdistribu_output_float;
+    if constexpr (std::is_same_v<ElementType, float>) {
+        allfdistribu_output_float = allfdistribu_host;
+    } else {
+        allfdistribu_output_float = get_field(allfdistribu_float_host_alloc);
+    }
 
     // electrostatic potential and electric field (depending only on x)
     DFieldMemXY electrostatic_potential(get_idx_range<GridX, GridY>(allfdistribu_v2D_split));
@@ -36,51 +98,112 @@ DFieldSpVxVyXY PredCorr::operator()(
     host_t<DFieldMemXY> electrostatic_potential_host(
             get_idx_range<GridX, GridY>(allfdistribu_v2D_split));
 
-    // a 2D memory block of the same size as fdistribu
-    DFieldMemSpVxVyXY allfdistribu_half_t(get_idx_range(allfdistribu_v2D_split));
-
-    int iter = 0;
-    for (; iter < steps; ++iter) {
-        double const iter_time = iter * dt;
-
-        // computation of the electrostatic potential at time tn and
-        // the associated electric field
-        m_poisson_solver(
-                get_field(electrostatic_potential),
-                get_field(electric_field),
-                get_const_field(allfdistribu_v2D_split));
-
+    // a 2D memory block of the same size as fdistribu (not needed by the fused predictor)
+    FieldMemSpVxVyXY<ElementType> allfdistribu_half_t(
+            m_predictor_poisson_solver ? IdxRangeSpVxVyXY()
+                                       : get_idx_range(allfdistribu_v2D_split));
+    first_touch(Kokkos::DefaultExecutionSpace(), get_field(allfdistribu_half_t));
+    DFieldMemXY charge_density_half_t(get_idx_range<GridX, GridY>(allfdistribu_v2D_split));
+
+    // Expose the distribution function and the electrostatic potential to PDI
+    auto const write_output = [&](std::string const& event,
+                                  int const iteration,
+                                  double const time_saved) {
         Kokkos::Profiling::pushRegion("(GSLX) PDIWrite");
         transpose_layout(
                 Kokkos::DefaultExecutionSpace(),
                 get_field(allfdistribu_v2D_split_output_layout),
                 get_const_field(allfdistribu_v2D_split));
         // copies necessary to PDI
-        ddc::parallel_deepcopy(
-                allfdistribu_host,
-                get_const_field(allfdistribu_v2D_split_output_layout));
         ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
-        ddc::PdiEvent("iteration")
-                .with("iter", iter)
-                .with("time_saved", iter_time)
-                .with("fdistribu", allfdistribu_host)
-                .with("electrostatic_potential", electrostatic_potential_host);
+        if (m_single_precision_output) {
+            if constexpr (std::is_same_v<ElementType, double>) {
+                ddcHelper::convert_deepcopy(
+                        Kokkos::DefaultExecutionSpace(),
+                        get_field(allfdistribu_float_alloc),
+                        get_const_field(allfdistribu_v2D_split_output_layout));
+                ddc::parallel_deepcopy(
+                        allfdistribu_output_float,
+                        get_const_field(allfdistribu_float_alloc));
+            } else {
+                ddc::parallel_deepcopy(
+                        allfdistribu_host,
+                        get_const_field(allfdistribu_v2D_split_output_layout));
+            }
+            ddc::PdiEvent(event)
+                    .with("iter", iteration)
+                    .with("time_saved", time_saved)
+                    .with("fdistribu_float", allfdistribu_output_float)
+                    .with("electrostatic_potential", electrostatic_potential_host);
+        } else {
+            ddc::parallel_deepcopy(
+                    allfdistribu_host,
+                    get_const_field(allfdistribu_v2D_split_output_layout));
+            if constexpr (!std::is_same_v<ElementType, double>) {
+                ddcHelper::convert_deepcopy(
+                        Kokkos::DefaultHostExecutionSpace(),
+                        allfdistribu_output,
+                        get_const_field(allfdistribu_host));
+            }
+            ddc::PdiEvent(event)
+                    .with("iter", iteration)
+                    .with("time_saved", time_saved)
+                    .with("fdistribu", allfdistribu_output)
+                    .with("electrostatic_potential", electrostatic_potential_host);
+        }
         Kokkos::Profiling::popRegion();
-        // copy fdistribu
-        ddc::parallel_deepcopy(allfdistribu_half_t, allfdistribu_v2D_split);
+    };
 
-        // predictor
-        m_vlasov_solver(get_field(allfdistribu_half_t), get_const_field(electric_field), dt / 2);
+    int iter = 0;
+    for (; iter < steps; ++iter) {
+        Kokkos::Profiling::pushRegion("(GSLX) Time step");
+        double const iter_time = iter * dt;
 
-        // computation of the electrostatic potential at time tn+1/2
-        // and the associated electric field
+        // computation of the electrostatic potential at time tn and
+        // the associated electric field
         m_poisson_solver(
                 get_field(electrostatic_potential),
                 get_field(electric_field),
-                get_const_field(allfdistribu_half_t));
+                get_const_field(allfdistribu_v2D_split));
+
+        write_output("iteration", iter, iter_time);
+        if (m_predictor_poisson_solver) {
+            // predictor computing only the charge density at time tn+1/2
+            m_vlasov_solver.charge_density_after_step(
+                    get_field(charge_density_half_t),
+                    get_const_field(allfdistribu_v2D_split),
+                    get_const_field(electric_field),
+                    m_quadrature_coeffs,
+                    dt / 2);
+
+            // computation of the electrostatic potential at time tn+1/2
+            // and the associated electric field
+            (*m_predictor_poisson_solver)(
+                    get_field(electrostatic_potential),
+                    get_field(electric_field),
+                    get_field(charge_density_half_t));
+        } else {
+            // copy fdistribu
+            ddc::parallel_deepcopy(allfdistribu_half_t, allfdistribu_v2D_split);
+
+            // predictor
+            m_vlasov_solver(
+                    get_field(allfdistribu_half_t),
+                    get_const_field(electric_field),
+                    dt / 2);
+
+            // computation of the electrostatic potential at time tn+1/2
+            // and the associated electric field
+            m_poisson_solver(
+                    get_field(electrostatic_potential),
+                    get_field(electric_field),
+                    get_const_field(allfdistribu_half_t));
+        }
 
         // correction on a dt
         m_vlasov_solver(get_field(allfdistribu_v2D_split), get_const_field(electric_field), dt);
+
+        Kokkos::Profiling::popRegion();
     }
 
     double const final_time = iter * dt;
@@ -89,22 +212,23 @@ DFieldSpVxVyXY PredCorr::operator()(
             get_field(electric_field),
             get_const_field(allfdistribu_v2D_split));
 
-    Kokkos::Profiling::pushRegion("(GSLX) PDIWrite");
-    transpose_layout(
-            Kokkos::DefaultExecutionSpace(),
-            get_field(allfdistribu_v2D_split_output_layout),
-            get_const_field(allfdistribu_v2D_split));
-    //copies necessary to PDI
-    ddc::parallel_deepcopy(
-            allfdistribu_host,
-            get_const_field(allfdistribu_v2D_split_output_layout));
-    ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
-    ddc::PdiEvent("last_iteration")
-            .with("iter", iter)
-            .with("time_saved", final_time)
-            .with("fdistribu", allfdistribu_host)
-            .with("electrostatic_potential", electrostatic_potential_host);
-    Kokkos::Profiling::popRegion();
+    write_output("last_iteration", iter, final_time);
 
     return allfdistribu_v2D_split;
 }
+
+DFieldSpVxVyXY PredCorr::operator()(
+        DFieldSpVxVyXY const allfdistribu_v2D_split,
+        double const dt,
+        int const steps) const
+{
+    return solve(allfdistribu_v2D_split, dt, steps);
+}
+
+FieldSpVxVyXY<float> PredCorr::operator()(
+        FieldSpVxVyXY<float> const allfdistribu_v2D_split,
+        double const dt,
+        int const steps) const
+{
+    return solve(allfdistribu_v2D_split, dt, steps);
+}
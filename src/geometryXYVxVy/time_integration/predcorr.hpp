@@ -3,6 +3,7 @@
 #pragma once
 
 #include "geometry_xyvxvy.hpp"
+#include "ipoisson_solver.hpp"
 #include "itimesolver.hpp"
 
 class IQNSolver;
@@ -17,21 +18,80 @@ class IVlasovSolver;
  * of a half-timestep. This potential is then used to compute
  * the value of the distribution function at time t+dt, where
  * dt is the timestep.
+ *
+ * In the fused predictor mode the charge density at time t+dt/2 is computed
+ * by the Vlasov solver directly during its last advection (see
+ * IVlasovSolver::charge_density_after_step). The distribution function at
+ * time t+dt/2 is therefore never stored.
+ *
+ * The distribution function can be written to the output files in single precision.
+ * It is then converted on the device before being copied to the host and it is
+ * exposed to PDI as fdistribu_float instead of fdistribu.
  */
 class PredCorr : public ITimeSolver
 {
+    using PoissonSolver = IPoissonSolver<
+            IdxRangeXY,
+            IdxRangeXY,
+            double,
+            typename Kokkos::DefaultExecutionSpace::memory_space,
+            Kokkos::layout_right>;
+
 private:
     IVlasovSolver const& m_vlasov_solver;
 
     IQNSolver const& m_poisson_solver;
 
+    // The Poisson solver used in the fused predictor mode (nullptr otherwise).
+    PoissonSolver const* m_predictor_poisson_solver;
+
+    DConstFieldVxVy m_quadrature_coeffs;
+
+    bool m_single_precision_output;
+
+    template <class ElementType>
+    FieldSpVxVyXY<ElementType> solve(
+            FieldSpVxVyXY<ElementType> allfdistribu,
+            double dt,
+            int steps) const;
+
 public:
     /**
      * @brief Creates an instance of the predictor-corrector class.
      * @param[in] vlasov_solver A solver for a Boltzmann equation.
      * @param[in] poisson_solver A solver for a Poisson equation.
+     * @param[in] single_precision_output True if the distribution function should be written
+     *                              in single precision.
      */
-    PredCorr(IVlasovSolver const& vlasov_solver, IQNSolver const& poisson_solver);
+    PredCorr(
+            IVlasovSolver const& vlasov_solver,
+            IQNSolver const& poisson_solver,
+            bool single_precision_output = false);
+
+    /**
+     * @brief Creates an instance of the predictor-corrector class using the fused predictor mode.
+     *
+     * In this mode the charge density at the half timestep is computed by the Vlasov solver
+     * without storing the predicted distribution function. It is then passed to the Poisson
+     * solver to obtain the electric field used by the corrector. All the species must be
+     * kinetic.
+     *
+     * @param[in] vlasov_solver A solver for a Boltzmann equation.
+     * @param[in] poisson_solver A solver for a Poisson equation.
+     * @param[in] predictor_poisson_solver A solver for the Poisson equation used with the
+     *                              charge density computed by the predictor.
+     * @param[in] quadrature_coeffs The coefficients of the quadrature over the velocity space
+     *                              (local to the MPI rank if the velocity space is distributed)
+     *                              used to compute the charge density in the predictor.
+     * @param[in] single_precision_output True if the distribution function should be written
+     *                              in single precision.
+     */
+    PredCorr(
+            IVlasovSolver const& vlasov_solver,
+            IQNSolver const& poisson_solver,
+            PoissonSolver const& predictor_poisson_solver,
+            DConstFieldVxVy quadrature_coeffs,
+            bool single_precision_output = false);
 
     ~PredCorr() override = default;
 
@@ -45,4 +105,23 @@ public:
      * @return The distribution function after solving the system.
      */
     DFieldSpVxVyXY operator()(DFieldSpVxVyXY allfdistribu, double dt, int steps = 1) const override;
+
+    /**
+     * @brief Solves the Vlasov-Poisson system for a distribution function stored in single
+     * precision.
+     *
+     * The distribution function (including the copy used for the predictor if the fused
+     * predictor mode is not used) is stored and transposed in single precision. The advections, the charge density and the field
+     * solves are computed in double precision. The distribution function is written to
+     * the output files in double precision unless single precision output is requested.
+     *
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function.
+     *                              On output : the value of the distribution function after solving
+     *                              the Vlasov-Poisson system a given number of iterations.
+     * @param[in] dt The timestep.
+     * @param[in] steps The number of iterations to be performed by the predictor-corrector.
+     * @return The distribution function after solving the system.
+     */
+    FieldSpVxVyXY<float> operator()(FieldSpVxVyXY<float> allfdistribu, double dt, int steps = 1)
+            const override;
 };
@@ -27,4 +27,69 @@ public:
             DFieldSpVxVyXY allfdistribu,
             DVectorConstFieldXY efield,
             double dt) const = 0;
+
+    /**
+     * @brief Solves a Vlasov equation on a timestep dt for a distribution function
+     * stored in single precision.
+     *
+     * The advections are carried out in double precision. Only the storage of the
+     * distribution function between the advections is in single precision.
+     *
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function.
+     *                              On output : the value of the distribution function after solving 
+     *                              the Vlasov equation.
+     * @param[in] efield The electric field computed at all spatial positions.
+     * @param[in] dt The timestep. 
+     *
+     * @return The distribution function after solving the Vlasov equation.
+     */
+    virtual FieldSpVxVyXY<float> operator()(
+            FieldSpVxVyXY<float> allfdistribu,
+            DVectorConstFieldXY efield,
+            double dt) const = 0;
+
+    /**
+     * @brief Computes the charge density of the solution of the Vlasov equation after a
+     * timestep dt without modifying the distribution function.
+     *
+     * The last advection of the splitting is fused with the velocity integral so the
+     * distribution function at the end of the timestep is never stored.
+     *
+     * @param[out] charge_density The charge density of the kinetic species at the end of
+     *                              the timestep.
+     * @param[in] allfdistribu The value of the distribution function at the start of the timestep.
+     * @param[in] efield The electric field computed at all spatial positions.
+     * @param[in] quadrature_coeffs The coefficients of the quadrature over the (local)
+     *                              velocity space.
+     * @param[in] dt The timestep.
+     *
+     * @return The charge density at the end of the timestep.
+     */
+    virtual DFieldXY charge_density_after_step(
+            DFieldXY charge_density,
+            DConstFieldSpVxVyXY allfdistribu,
+            DVectorConstFieldXY efield,
+            DConstFieldVxVy quadrature_coeffs,
+            double dt) const = 0;
+
+    /**
+     * @brief Computes the charge density of the solution of the Vlasov equation after a
+     * timestep dt without modifying the distribution function stored in single precision.
+     *
+     * @param[out] charge_density The charge density of the kinetic species at the end of
+     *                              the timestep.
+     * @param[in] allfdistribu The value of the distribution function at the start of the timestep.
+     * @param[in] efield The electric field computed at all spatial positions.
+     * @param[in] quadrature_coeffs The coefficients of the quadrature over the (local)
+     *                              velocity space.
+     * @param[in] dt The timestep.
+     *
+     * @return The charge density at the end of the timestep.
+     */
+    virtual DFieldXY charge_density_after_step(
+            DFieldXY charge_density,
+            ConstFieldSpVxVyXY<float> allfdistribu,
+            DVectorConstFieldXY efield,
+            DConstFieldVxVy quadrature_coeffs,
+            double dt) const = 0;
 };
@@ -1,33 +1,129 @@
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
+#include <type_traits>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_helper.hpp"
+#include "first_touch.hpp"
 #include "mpisplitvlasovsolver.hpp"
+#include "mpitools.hpp"
 
 MpiSplitVlasovSolver::MpiSplitVlasovSolver(
         IAdvectionSpatial<GeometryVxVyXY, GridX> const& advec_x,
         IAdvectionSpatial<GeometryVxVyXY, GridY> const& advec_y,
         IAdvectionVelocity<GeometryXYVxVy, GridVx> const& advec_vx,
         IAdvectionVelocity<GeometryXYVxVy, GridVy> const& advec_vy,
-        MPITransposeAllToAll<X2DSplit, V2DSplit> const& transpose)
+        MPITransposeAllToAll<X2DSplit, V2DSplit> const& transpose,
+        SplittingMethod const splitting_method)
     : m_advec_x(advec_x)
     , m_advec_y(advec_y)
     , m_advec_vx(advec_vx)
     , m_advec_vy(advec_vy)
     , m_transpose(transpose)
+    , m_splitting(splitting_method)
+    , m_allfdistribu_x2Dsplit_alloc(
+              "allfdistribu_x2Dsplit (MpiSplitVlasovSolver)",
+              transpose.get_local_idx_range<X2DSplit>())
+{
+    // This buffer may be written directly by MPI so it is touched in parallel beforehand
+    first_touch(Kokkos::DefaultExecutionSpace(), get_field(m_allfdistribu_x2Dsplit_alloc));
+}
+
+void MpiSplitVlasovSolver::advect_spatial(
+        DFieldSpVxVyXY const allfdistribu_v2Dsplit,
+        int const stage,
+        double const dt) const
+{
+    double const stage_dt = m_splitting.get_spatial_coeff(stage) * dt;
+    if (m_splitting.is_first_half(stage)) {
+        m_advec_x(allfdistribu_v2Dsplit, stage_dt);
+        m_advec_y(allfdistribu_v2Dsplit, stage_dt);
+    } else {
+        m_advec_y(allfdistribu_v2Dsplit, stage_dt);
+        m_advec_x(allfdistribu_v2Dsplit, stage_dt);
+    }
+}
+
+void MpiSplitVlasovSolver::advect_velocity(
+        DFieldSpXYVxVy const allfdistribu_x2Dsplit,
+        DConstFieldXY const local_electric_field_x,
+        DConstFieldXY const local_electric_field_y,
+        int const stage,
+        double const dt) const
 {
+    double const stage_dt = m_splitting.get_velocity_coeff(stage) * dt;
+    m_advec_vx(allfdistribu_x2Dsplit, local_electric_field_x, stage_dt / 2);
+    m_advec_vy(allfdistribu_x2Dsplit, local_electric_field_y, stage_dt);
+    m_advec_vx(allfdistribu_x2Dsplit, local_electric_field_x, stage_dt / 2);
 }
 
 DFieldSpVxVyXY MpiSplitVlasovSolver::operator()(
         DFieldSpVxVyXY const allfdistribu_v2Dsplit,
         DVectorConstFieldXY const electric_field,
         double const dt) const
+{
+    IdxRangeSpVxVyXY idxrange_v2Dsplit(m_transpose.get_local_idx_range<V2DSplit>());
+    IdxRangeXY idx_range_xy_v2Dsplit(idxrange_v2Dsplit);
+    DFieldSpXYVxVy allfdistribu_x2Dsplit = get_field(m_allfdistribu_x2Dsplit_alloc);
+
+    // Create contiguous memory space to contain the relevant section of the electric field
+    DFieldMemXY local_electric_field_x(idx_range_xy_v2Dsplit);
+    DFieldMemXY local_electric_field_y(idx_range_xy_v2Dsplit);
+    ddc::parallel_deepcopy(
+            get_field(local_electric_field_x),
+            ddcHelper::get<X>(electric_field)[idx_range_xy_v2Dsplit]);
+    ddc::parallel_deepcopy(
+            get_field(local_electric_field_y),
+            ddcHelper::get<Y>(electric_field)[idx_range_xy_v2Dsplit]);
+
+    int const n_velocity_stages = m_splitting.get_n_velocity_stages();
+    for (int stage(0); stage < n_velocity_stages; ++stage) {
+        // Advect in spatial dimensions
+        advect_spatial(allfdistribu_v2Dsplit, stage, dt);
+        // Swap to vxvy contiguous layout
+        m_transpose(
+                Kokkos::DefaultExecutionSpace(),
+                allfdistribu_x2Dsplit,
+                get_const_field(allfdistribu_v2Dsplit));
+        // Advect in velocity dimensions
+        advect_velocity(
+                allfdistribu_x2Dsplit,
+                get_const_field(local_electric_field_x),
+                get_const_field(local_electric_field_y),
+                stage,
+                dt);
+        // Swap to xy contiguous layout
+        m_transpose(
+                Kokkos::DefaultExecutionSpace(),
+                allfdistribu_v2Dsplit,
+                get_const_field(allfdistribu_x2Dsplit));
+    }
+    // Advect in spatial dimensions
+    advect_spatial(allfdistribu_v2Dsplit, n_velocity_stages, dt);
+
+    return allfdistribu_v2Dsplit;
+}
+
+FieldSpVxVyXY<float> MpiSplitVlasovSolver::operator()(
+        FieldSpVxVyXY<float> const allfdistribu_v2Dsplit,
+        DVectorConstFieldXY const electric_field,
+        double const dt) const
 {
     IdxRangeSpVxVyXY idxrange_v2Dsplit(m_transpose.get_local_idx_range<V2DSplit>());
     IdxRangeSpXYVxVy idxrange_x2Dsplit(m_transpose.get_local_idx_range<X2DSplit>());
     IdxRangeXY idx_range_xy_v2Dsplit(idxrange_v2Dsplit);
-    DFieldMemSpXYVxVy allfdistribu_x2Dsplit_alloc(
+    IdxRangeVxVyXY idx_range_vxvyxy_v2Dsplit(idxrange_v2Dsplit);
+    IdxRangeXYVxVy idx_range_xyvxvy_x2Dsplit(idxrange_x2Dsplit);
+    FieldMemSpXYVxVy<float> allfdistribu_x2Dsplit_alloc(
             "allfdistribu_x2Dsplit (MpiSplitVlasovSolver::operator())",
             idxrange_x2Dsplit);
-    DFieldSpXYVxVy allfdistribu_x2Dsplit = get_field(allfdistribu_x2Dsplit_alloc);
+    FieldSpXYVxVy<float> allfdistribu_x2Dsplit = get_field(allfdistribu_x2Dsplit_alloc);
+
+    // Double precision buffer large enough to contain one species in either layout
+    Kokkos::View<double*> fdistribu_species_alloc(
+            "fdistribu_species (MpiSplitVlasovSolver::operator())",
+            std::max(idx_range_vxvyxy_v2Dsplit.size(), idx_range_xyvxvy_x2Dsplit.size()));
 
     // Create contiguous memory space to contain the relevant section of the electric field
     DFieldMemXY local_electric_field_x(idx_range_xy_v2Dsplit);
@@ -39,26 +135,268 @@ DFieldSpVxVyXY MpiSplitVlasovSolver::operator()(
             get_field(local_electric_field_y),
             ddcHelper::get<Y>(electric_field)[idx_range_xy_v2Dsplit]);
 
-    // Advect in spatial dimensions
-    m_advec_x(allfdistribu_v2Dsplit, dt / 2);
-    m_advec_y(allfdistribu_v2Dsplit, dt / 2);
-    // Swap to vxvy contiguous layout
-    m_transpose(
-            Kokkos::DefaultExecutionSpace(),
-            allfdistribu_x2Dsplit,
-            get_const_field(allfdistribu_v2Dsplit));
-    // Advect in velocity dimensions
-    m_advec_vx(allfdistribu_x2Dsplit, get_const_field(local_electric_field_x), dt / 2);
-    m_advec_vy(allfdistribu_x2Dsplit, get_const_field(local_electric_field_y), dt);
-    m_advec_vx(allfdistribu_x2Dsplit, get_const_field(local_electric_field_x), dt / 2);
-    // Swap to xy contiguous layout
-    m_transpose(
-            Kokkos::DefaultExecutionSpace(),
-            allfdistribu_v2Dsplit,
-            get_const_field(allfdistribu_x2Dsplit));
-    // Advect in spatial dimensions
-    m_advec_y(allfdistribu_v2Dsplit, dt / 2);
-    m_advec_x(allfdistribu_v2Dsplit, dt / 2);
+    int const n_velocity_stages = m_splitting.get_n_velocity_stages();
+    for (int stage(0); stage <= n_velocity_stages; ++stage) {
+        // Advect in spatial dimensions
+        for (IdxSp const isp : get_idx_range<Species>(allfdistribu_v2Dsplit)) {
+            IdxRangeSpVxVyXY const idx_range_isp(
+                    IdxRangeSp(isp, IdxStepSp(1)),
+                    idx_range_vxvyxy_v2Dsplit);
+            DFieldSpVxVyXY fdistribu_isp(fdistribu_species_alloc.data(), idx_range_isp);
+            ddcHelper::convert_deepcopy(
+                    Kokkos::DefaultExecutionSpace(),
+                    fdistribu_isp,
+                    get_const_field(allfdistribu_v2Dsplit[idx_range_isp]));
+            advect_spatial(fdistribu_isp, stage, dt);
+            ddcHelper::convert_deepcopy(
+                    Kokkos::DefaultExecutionSpace(),
+                    allfdistribu_v2Dsplit[idx_range_isp],
+                    get_const_field(fdistribu_isp));
+        }
+        if (stage == n_velocity_stages) {
+            break;
+        }
+        // Swap to vxvy contiguous layout
+        m_transpose(
+                Kokkos::DefaultExecutionSpace(),
+                allfdistribu_x2Dsplit,
+                get_const_field(allfdistribu_v2Dsplit));
+        // Advect in velocity dimensions
+        for (IdxSp const isp : get_idx_range<Species>(allfdistribu_x2Dsplit)) {
+            IdxRangeSpXYVxVy const idx_range_isp(
+                    IdxRangeSp(isp, IdxStepSp(1)),
+                    idx_range_xyvxvy_x2Dsplit);
+            DFieldSpXYVxVy fdistribu_isp(fdistribu_species_alloc.data(), idx_range_isp);
+            ddcHelper::convert_deepcopy(
+                    Kokkos::DefaultExecutionSpace(),
+                    fdistribu_isp,
+                    get_const_field(allfdistribu_x2Dsplit[idx_range_isp]));
+            advect_velocity(
+                    fdistribu_isp,
+                    get_const_field(local_electric_field_x),
+                    get_const_field(local_electric_field_y),
+                    stage,
+                    dt);
+            ddcHelper::convert_deepcopy(
+                    Kokkos::DefaultExecutionSpace(),
+                    allfdistribu_x2Dsplit[idx_range_isp],
+                    get_const_field(fdistribu_isp));
+        }
+        // Swap to xy contiguous layout
+        m_transpose(
+                Kokkos::DefaultExecutionSpace(),
+                allfdistribu_v2Dsplit,
+                get_const_field(allfdistribu_x2Dsplit));
+    }
 
     return allfdistribu_v2Dsplit;
 }
+
+template <class ElementType>
+void MpiSplitVlasovSolver::compute_charge_density_after_step(
+        DFieldXY const charge_density,
+        ConstFieldSpVxVyXY<ElementType> const allfdistribu_v2Dsplit,
+        DVectorConstFieldXY const electric_field,
+        DConstFieldVxVy const quadrature_coeffs,
+        double const dt) const
+{
+    IdxRangeSpVxVyXY idxrange_v2Dsplit(m_transpose.get_local_idx_range<V2DSplit>());
+    IdxRangeSpXYVxVy idxrange_x2Dsplit(m_transpose.get_local_idx_range<X2DSplit>());
+    IdxRangeXY idx_range_xy_v2Dsplit(idxrange_v2Dsplit);
+    IdxRangeVxVyXY idx_range_vxvyxy_v2Dsplit(idxrange_v2Dsplit);
+    IdxRangeXYVxVy idx_range_xyvxvy_x2Dsplit(idxrange_x2Dsplit);
+
+    // The transposes act on all the species so the intermediate values are stored in both layouts
+    FieldMemSpVxVyXY<ElementType> allfdistribu_v2Dsplit_advected_alloc(
+            "allfdistribu_v2Dsplit_advected (MpiSplitVlasovSolver::charge_density_after_step())",
+            idxrange_v2Dsplit);
+    FieldSpVxVyXY<ElementType> allfdistribu_v2Dsplit_advected
+            = get_field(allfdistribu_v2Dsplit_advected_alloc);
+    FieldMemSpXYVxVy<ElementType> allfdistribu_x2Dsplit_alloc(
+            "allfdistribu_x2Dsplit (MpiSplitVlasovSolver::charge_density_after_step())",
+            idxrange_x2Dsplit);
+    FieldSpXYVxVy<ElementType> allfdistribu_x2Dsplit = get_field(allfdistribu_x2Dsplit_alloc);
+
+    DFieldMemXY charge_density_local_alloc(
+            "charge_density_local (MpiSplitVlasovSolver::charge_density_after_step())",
+            get_idx_range(charge_density));
+    DFieldXY charge_density_local = get_field(charge_density_local_alloc);
+
+    // Create contiguous memory space to contain the relevant section of the electric field
+    DFieldMemXY local_electric_field_x(idx_range_xy_v2Dsplit);
+    DFieldMemXY local_electric_field_y(idx_range_xy_v2Dsplit);
+    ddc::parallel_deepcopy(
+            get_field(local_electric_field_x),
+            ddcHelper::get<X>(electric_field)[idx_range_xy_v2Dsplit]);
+    ddc::parallel_deepcopy(
+            get_field(local_electric_field_y),
+            ddcHelper::get<Y>(electric_field)[idx_range_xy_v2Dsplit]);
+
+    int const n_velocity_stages = m_splitting.get_n_velocity_stages();
+    // The last spatial stage is carried out along Y then X
+    double const last_stage_dt = m_splitting.get_spatial_coeff(n_velocity_stages) * dt;
+
+    if constexpr (std::is_same_v<ElementType, double>) {
+        ddc::parallel_deepcopy(allfdistribu_v2Dsplit_advected, allfdistribu_v2Dsplit);
+        for (int stage(0); stage < n_velocity_stages; ++stage) {
+            // Advect in spatial dimensions
+            advect_spatial(allfdistribu_v2Dsplit_advected, stage, dt);
+            // Swap to vxvy contiguous layout
+            m_transpose(
+                    Kokkos::DefaultExecutionSpace(),
+                    allfdistribu_x2Dsplit,
+                    get_const_field(allfdistribu_v2Dsplit_advected));
+            // Advect in velocity dimensions
+            advect_velocity(
+                    allfdistribu_x2Dsplit,
+                    get_const_field(local_electric_field_x),
+                    get_const_field(local_electric_field_y),
+                    stage,
+                    dt);
+            // Swap to xy contiguous layout
+            m_transpose(
+                    Kokkos::DefaultExecutionSpace(),
+                    allfdistribu_v2Dsplit_advected,
+                    get_const_field(allfdistribu_x2Dsplit));
+        }
+        // Advect in spatial dimensions, the last advection only computes the charge density
+        m_advec_y(allfdistribu_v2Dsplit_advected, last_stage_dt);
+        m_advec_x.charge_density_after_transport(
+                charge_density_local,
+                get_const_field(allfdistribu_v2Dsplit_advected),
+                quadrature_coeffs,
+                last_stage_dt);
+    } else {
+        // Double precision buffer large enough to contain one species in either layout
+        Kokkos::View<double*> fdistribu_species_alloc(
+                "fdistribu_species (MpiSplitVlasovSolver::charge_density_after_step())",
+                std::max(idx_range_vxvyxy_v2Dsplit.size(), idx_range_xyvxvy_x2Dsplit.size()));
+        DFieldMemXY charge_density_species_alloc(
+                "charge_density_species (MpiSplitVlasovSolver::charge_density_after_step())",
+                get_idx_range(charge_density));
+        DFieldXY charge_density_species = get_field(charge_density_species_alloc);
+
+        for (int stage(0); stage < n_velocity_stages; ++stage) {
+            // The first stage reads the distribution function at the start of the timestep
+            ConstFieldSpVxVyXY<ElementType> const allfdistribu_v2Dsplit_stage
+                    = stage == 0 ? allfdistribu_v2Dsplit
+                                 : get_const_field(allfdistribu_v2Dsplit_advected);
+            // Advect in spatial dimensions
+            for (IdxSp const isp : get_idx_range<Species>(allfdistribu_v2Dsplit)) {
+                IdxRangeSpVxVyXY const idx_range_isp(
+                        IdxRangeSp(isp, IdxStepSp(1)),
+                        idx_range_vxvyxy_v2Dsplit);
+                DFieldSpVxVyXY fdistribu_isp(fdistribu_species_alloc.data(), idx_range_isp);
+                ddcHelper::convert_deepcopy(
+                        Kokkos::DefaultExecutionSpace(),
+                        fdistribu_isp,
+                        allfdistribu_v2Dsplit_stage[idx_range_isp]);
+                advect_spatial(fdistribu_isp, stage, dt);
+                ddcHelper::convert_deepcopy(
+                        Kokkos::DefaultExecutionSpace(),
+                        allfdistribu_v2Dsplit_advected[idx_range_isp],
+                        get_const_field(fdistribu_isp));
+            }
+            // Swap to vxvy contiguous layout
+            m_transpose(
+                    Kokkos::DefaultExecutionSpace(),
+                    allfdistribu_x2Dsplit,
+                    get_const_field(allfdistribu_v2Dsplit_advected));
+            // Advect in velocity dimensions
+            for (IdxSp const isp : get_idx_range<Species>(allfdistribu_x2Dsplit)) {
+                IdxRangeSpXYVxVy const idx_range_isp(
+                        IdxRangeSp(isp, IdxStepSp(1)),
+                        idx_range_xyvxvy_x2Dsplit);
+                DFieldSpXYVxVy fdistribu_isp(fdistribu_species_alloc.data(), idx_range_isp);
+                ddcHelper::convert_deepcopy(
+                        Kokkos::DefaultExecutionSpace(),
+                        fdistribu_isp,
+                        get_const_field(allfdistribu_x2Dsplit[idx_range_isp]));
+                advect_velocity(
+                        fdistribu_isp,
+                        get_const_field(local_electric_field_x),
+                        get_const_field(local_electric_field_y),
+                        stage,
+                        dt);
+                ddcHelper::convert_deepcopy(
+                        Kokkos::DefaultExecutionSpace(),
+                        allfdistribu_x2Dsplit[idx_range_isp],
+                        get_const_field(fdistribu_isp));
+            }
+            // Swap to xy contiguous layout
+            m_transpose(
+                    Kokkos::DefaultExecutionSpace(),
+                    allfdistribu_v2Dsplit_advected,
+                    get_const_field(allfdistribu_x2Dsplit));
+        }
+        // Advect in spatial dimensions, the last advection only computes the charge density
+        ddc::parallel_fill(charge_density_local, 0.0);
+        for (IdxSp const isp : get_idx_range<Species>(allfdistribu_v2Dsplit)) {
+            IdxRangeSpVxVyXY const idx_range_isp(
+                    IdxRangeSp(isp, IdxStepSp(1)),
+                    idx_range_vxvyxy_v2Dsplit);
+            DFieldSpVxVyXY fdistribu_isp(fdistribu_species_alloc.data(), idx_range_isp);
+            ddcHelper::convert_deepcopy(
+                    Kokkos::DefaultExecutionSpace(),
+                    fdistribu_isp,
+                    get_const_field(allfdistribu_v2Dsplit_advected[idx_range_isp]));
+            m_advec_y(fdistribu_isp, last_stage_dt);
+            m_advec_x.charge_density_after_transport(
+                    charge_density_species,
+                    get_const_field(fdistribu_isp),
+                    quadrature_coeffs,
+                    last_stage_dt);
+            const std::source_location location = std::source_location::current();
+            ddc::parallel_for_each(
+                    location.function_name(),
+                    Kokkos::DefaultExecutionSpace(),
+                    get_idx_range(charge_density),
+                    KOKKOS_LAMBDA(IdxXY const ixy) {
+                        charge_density_local(ixy) += charge_density_species(ixy);
+                    });
+        }
+    }
+
+    Kokkos::DefaultExecutionSpace().fence("Fence local charge density");
+
+    // Sum the contributions of the velocities on the other ranks
+    MPI_Allreduce(
+            charge_density_local.data_handle(),
+            charge_density.data_handle(),
+            charge_density.size(),
+            MPI_type_descriptor_t<double>,
+            MPI_SUM,
+            m_transpose.get_comm());
+}
+
+DFieldXY MpiSplitVlasovSolver::charge_density_after_step(
+        DFieldXY const charge_density,
+        DConstFieldSpVxVyXY const allfdistribu,
+        DVectorConstFieldXY const electric_field,
+        DConstFieldVxVy const quadrature_coeffs,
+        double const dt) const
+{
+    compute_charge_density_after_step(
+            charge_density,
+            allfdistribu,
+            electric_field,
+            quadrature_coeffs,
+            dt);
+    return charge_density;
+}
+
+DFieldXY MpiSplitVlasovSolver::charge_density_after_step(
+        DFieldXY const charge_density,
+        ConstFieldSpVxVyXY<float> const allfdistribu,
+        DVectorConstFieldXY const electric_field,
+        DConstFieldVxVy const quadrature_coeffs,
+        double const dt) const
+{
+    compute_charge_density_after_step(
+            charge_density,
+            allfdistribu,
+            electric_field,
+            quadrature_coeffs,
+            dt);
+    return charge_density;
+}
@@ -7,16 +7,23 @@
 #include "iadvectionx.hpp"
 #include "ivlasovsolver.hpp"
 #include "mpitransposealltoall.hpp"
+#include "splitting_scheme.hpp"
 
 /**
- * @brief A class that solves a Vlasov equation using Strang's splitting
+ * @brief A class that solves a Vlasov equation using a splitting method
  * on an MPI distributed mesh.
  *
  * The Vlasov equation is split between four advection equations 
- * along the X, Y, Vx and Vy directions. The splitting involves solving 
+ * along the X, Y, Vx and Vy directions. By default Strang's splitting is used.
+ * The splitting involves solving 
  * the advections in the X, Y, and Vx directions first on a time interval
  * of length dt/2, then the Vy-direction advection on a time dt, and
  * finally the X, Y, and Vx directions again in reverse order on dt/2.
+ *
+ * Higher order schemes alternate more spatial and velocity stages (see SplittingScheme).
+ * The advections along X and Y of a spatial stage are carried out in the V2DSplit layout
+ * and the advections along Vx and Vy of a velocity stage in the X2DSplit layout, so each
+ * velocity stage requires two transposes.
  */
 class MpiSplitVlasovSolver : public IVlasovSolver
 {
@@ -33,6 +40,11 @@ class MpiSplitVlasovSolver : public IVlasovSolver
     /// MPI transpose operator
     MPITransposeAllToAll<X2DSplit, V2DSplit> const& m_transpose;
 
+    SplittingScheme m_splitting;
+
+    /// Buffer for the distribution function in the X2DSplit layout
+    mutable DFieldMemSpXYVxVy m_allfdistribu_x2Dsplit_alloc;
+
 public:
     /**
      * @brief Creates an instance of the split vlasov solver class.
@@ -41,13 +53,15 @@ public:
      * @param[in] advec_vx An advection operator along the vx direction.
      * @param[in] advec_vy An advection operator along the vy direction.
      * @param[in] transpose A MPI transpose operator to move between layouts.
+     * @param[in] splitting_method The splitting scheme.
      */
     MpiSplitVlasovSolver(
             IAdvectionSpatial<GeometryVxVyXY, GridX> const& advec_x,
             IAdvectionSpatial<GeometryVxVyXY, GridY> const& advec_y,
             IAdvectionVelocity<GeometryXYVxVy, GridVx> const& advec_vx,
             IAdvectionVelocity<GeometryXYVxVy, GridVy> const& advec_vy,
-            MPITransposeAllToAll<X2DSplit, V2DSplit> const& transpose);
+            MPITransposeAllToAll<X2DSplit, V2DSplit> const& transpose,
+            SplittingMethod splitting_method = SplittingMethod::Strang);
 
     ~MpiSplitVlasovSolver() override = default;
 
@@ -66,4 +80,121 @@ public:
             DFieldSpVxVyXY allfdistribu,
             DVectorConstFieldXY electric_field,
             double dt) const override;
+
+    /**
+     * @brief Solves a Vlasov equation on a timestep dt for a distribution function
+     * stored in single precision.
+     *
+     * Each species is copied into a double precision buffer before being advected.
+     * The result is rounded to single precision once all the advections of a layout
+     * have been applied. The MPI transposes are
+     * carried out in single precision.
+     *
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function.
+     *                              On output : the value of the distribution function after solving 
+     *                              the Vlasov equation.
+     * @param[in] electric_field The electric field computed at all spatial positions.
+     * @param[in] dt The timestep. 
+     *
+     * @return The distribution function after solving the Vlasov equation.
+     */
+    FieldSpVxVyXY<float> operator()(
+            FieldSpVxVyXY<float> allfdistribu,
+            DVectorConstFieldXY electric_field,
+            double dt) const override;
+
+    /**
+     * @brief Computes the charge density of the solution of the Vlasov equation after a
+     * timestep dt without modifying the distribution function.
+     *
+     * The advections are applied to a copy of the distribution function. The last
+     * advection along x is fused with the integral over the local velocities and the
+     * result is summed over the MPI ranks.
+     *
+     * @param[out] charge_density The charge density of the kinetic species at the end of
+     *                              the timestep.
+     * @param[in] allfdistribu The value of the distribution function at the start of the timestep.
+     * @param[in] electric_field The electric field computed at all spatial positions.
+     * @param[in] quadrature_coeffs The coefficients of the quadrature over the local
+     *                              velocity space of the V2DSplit layout.
+     * @param[in] dt The timestep.
+     *
+     * @return The charge density at the end of the timestep.
+     */
+    DFieldXY charge_density_after_step(
+            DFieldXY charge_density,
+            DConstFieldSpVxVyXY allfdistribu,
+            DVectorConstFieldXY electric_field,
+            DConstFieldVxVy quadrature_coeffs,
+            double dt) const override;
+
+    /**
+     * @brief Computes the charge density of the solution of the Vlasov equation after a
+     * timestep dt without modifying the distribution function stored in single precision.
+     *
+     * @param[out] charge_density The charge density of the kinetic species at the end of
+     *                              the timestep.
+     * @param[in] allfdistribu The value of the distribution function at the start of the timestep.
+     * @param[in] electric_field The electric field computed at all spatial positions.
+     * @param[in] quadrature_coeffs The coefficients of the quadrature over the local
+     *                              velocity space of the V2DSplit layout.
+     * @param[in] dt The timestep.
+     *
+     * @return The charge density at the end of the timestep.
+     */
+    DFieldXY charge_density_after_step(
+            DFieldXY charge_density,
+            ConstFieldSpVxVyXY<float> allfdistribu,
+            DVectorConstFieldXY electric_field,
+            DConstFieldVxVy quadrature_coeffs,
+            double dt) const override;
+
+    /**
+     * @brief Computes the charge density of the solution of the Vlasov equation after a
+     * timestep dt.
+     * This function should be private. It is not due to the inclusion of a KOKKOS_LAMBDA.
+     *
+     * @param[out] charge_density The charge density of the kinetic species at the end of
+     *                              the timestep.
+     * @param[in] allfdistribu The value of the distribution function at the start of the timestep.
+     * @param[in] electric_field The electric field computed at all spatial positions.
+     * @param[in] quadrature_coeffs The coefficients of the quadrature over the local
+     *                              velocity space of the V2DSplit layout.
+     * @param[in] dt The timestep.
+     */
+    template <class ElementType>
+    void compute_charge_density_after_step(
+            DFieldXY charge_density,
+            ConstFieldSpVxVyXY<ElementType> allfdistribu,
+            DVectorConstFieldXY electric_field,
+            DConstFieldVxVy quadrature_coeffs,
+            double dt) const;
+
+private:
+    /**
+     * @brief Carry out the advections of a spatial stage of the splitting scheme.
+     *
+     * @param[in, out] allfdistribu_v2Dsplit The distribution function in the V2DSplit layout.
+     * @param[in] stage The index of the spatial stage.
+     * @param[in] dt The timestep.
+     */
+    void advect_spatial(DFieldSpVxVyXY allfdistribu_v2Dsplit, int stage, double dt) const;
+
+    /**
+     * @brief Carry out the advections of a velocity stage of the splitting scheme.
+     *
+     * @param[in, out] allfdistribu_x2Dsplit The distribution function in the X2DSplit layout.
+     * @param[in] local_electric_field_x The x-component of the electric field on the local
+     *                  spatial positions.
+     * @param[in] local_electric_field_y The y-component of the electric field on the local
+     *                  spatial positions.
+     * @param[in] stage The index of the velocity stage.
+     * @param[in] dt The timestep.
+     */
+    void advect_velocity(
+            DFieldSpXYVxVy allfdistribu_x2Dsplit,
+            DConstFieldXY local_electric_field_x,
+            DConstFieldXY local_electric_field_y,
+            int stage,
+            double dt) const;
 };
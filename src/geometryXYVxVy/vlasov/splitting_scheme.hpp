@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+/**
+ * @brief An enum class that allows choosing the splitting scheme used to solve
+ * the Vlasov equation.
+ */
+enum class SplittingMethod {
+    /// Strang splitting (second order).
+    Strang,
+    /// Forest-Ruth splitting, also known as Yoshida's triple jump (fourth order).
+    ForestRuth,
+    /// Blanes-Moan optimised splitting with 6 stages (fourth order).
+    BlanesMoan
+};
+
+/**
+ * @brief A class containing the coefficients of a symmetric splitting scheme.
+ *
+ * The Vlasov equation is split between a spatial operator A (advections along X and Y)
+ * and a velocity operator B (advections along Vx and Vy). A timestep dt is carried out
+ * by composing the flows of these operators:
+ * @f$ e^{a_0 dt A} e^{b_0 dt B} e^{a_1 dt A} \dots e^{b_{s-1} dt B} e^{a_s dt A} @f$
+ * where @f$ s @f$ is the number of velocity stages. The spatial operator is the
+ * outer operator so that the number of velocity stages (which require changes of layout
+ * in the MPI solver) is as small as possible.
+ *
+ * The fourth order coefficients can be found in:
+ * - E. Forest, R.D. Ruth, "Fourth-order symplectic integration", Physica D, 1990.
+ * - S. Blanes, P.C. Moan, "Practical symplectic partitioned Runge-Kutta and
+ *   Runge-Kutta-Nyström methods", J. Comput. Appl. Math., 2002.
+ *
+ * Some coefficients are negative so some advections are carried out backwards in time.
+ */
+class SplittingScheme
+{
+private:
+    std::vector<double> m_spatial_coeffs;
+    std::vector<double> m_velocity_coeffs;
+
+public:
+    /**
+     * @brief Creates the coefficients of a splitting scheme.
+     * @param[in] method The splitting scheme.
+     */
+    explicit SplittingScheme(SplittingMethod method = SplittingMethod::Strang)
+    {
+        switch (method) {
+        case SplittingMethod::Strang:
+            m_spatial_coeffs = {0.5, 0.5};
+            m_velocity_coeffs = {1.0};
+            break;
+        case SplittingMethod::ForestRuth: {
+            double const theta = 1.0 / (2.0 - std::cbrt(2.0));
+            m_spatial_coeffs = {theta / 2, (1 - theta) / 2, (1 - theta) / 2, theta / 2};
+            m_velocity_coeffs = {theta, 1 - 2 * theta, theta};
+            break;
+        }
+        case SplittingMethod::BlanesMoan: {
+            double const a0 = 0.0792036964311957;
+            double const a1 = 0.353172906049774;
+            double const a2 = -0.0420650803577195;
+            double const a3 = 1 - 2 * (a0 + a1 + a2);
+            double const b0 = 0.209515106613362;
+            double const b1 = -0.143851773179818;
+            double const b2 = 0.5 - (b0 + b1);
+            m_spatial_coeffs = {a0, a1, a2, a3, a2, a1, a0};
+            m_velocity_coeffs = {b0, b1, b2, b2, b1, b0};
+            break;
+        }
+        }
+        assert(m_spatial_coeffs.size() == m_velocity_coeffs.size() + 1);
+    }
+
+    /**
+     * @brief Get the number of velocity stages s of the scheme.
+     * @return The number of velocity stages.
+     */
+    int get_n_velocity_stages() const
+    {
+        return m_velocity_coeffs.size();
+    }
+
+    /**
+     * @brief Get the coefficient @f$ a_i @f$ of a spatial stage.
+     * @param[in] stage The index i of the spatial stage (between 0 and s).
+     * @return The fraction of the timestep on which the spatial advections are carried out.
+     */
+    double get_spatial_coeff(int stage) const
+    {
+        return m_spatial_coeffs[stage];
+    }
+
+    /**
+     * @brief Get the coefficient @f$ b_i @f$ of a velocity stage.
+     * @param[in] stage The index i of the velocity stage (between 0 and s-1).
+     * @return The fraction of the timestep on which the velocity advections are carried out.
+     */
+    double get_velocity_coeff(int stage) const
+    {
+        return m_velocity_coeffs[stage];
+    }
+
+    /**
+     * @brief Indicate whether a spatial stage belongs to the first half of the scheme.
+     *
+     * The advections of the spatial stages in the first half of the scheme are carried
+     * out along X then Y, the others along Y then X, so that the scheme remains symmetric.
+     *
+     * @param[in] stage The index i of the spatial stage (between 0 and s).
+     * @return True if the stage belongs to the first half of the scheme.
+     */
+    bool is_first_half(int stage) const
+    {
+        return 2 * stage < get_n_velocity_stages();
+    }
+};
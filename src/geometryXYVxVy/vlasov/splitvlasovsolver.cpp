@@ -1,5 +1,7 @@
 // SPDX-License-Identifier: MIT
 
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_helper.hpp"
 #include "iadvectionvx.hpp"
 #include "iadvectionx.hpp"
 #include "splitvlasovsolver.hpp"
@@ -8,26 +10,165 @@ SplitVlasovSolver::SplitVlasovSolver(
         IAdvectionSpatial<GeometryVxVyXY, GridX> const& advec_x,
         IAdvectionSpatial<GeometryVxVyXY, GridY> const& advec_y,
         IAdvectionVelocity<GeometryVxVyXY, GridVx> const& advec_vx,
-        IAdvectionVelocity<GeometryVxVyXY, GridVy> const& advec_vy)
+        IAdvectionVelocity<GeometryVxVyXY, GridVy> const& advec_vy,
+        SplittingMethod const splitting_method)
     : m_advec_x(advec_x)
     , m_advec_y(advec_y)
     , m_advec_vx(advec_vx)
     , m_advec_vy(advec_vy)
+    , m_splitting(splitting_method)
 {
 }
 
+void SplitVlasovSolver::advect_spatial(
+        DFieldSpVxVyXY const allfdistribu,
+        int const stage,
+        double const dt) const
+{
+    double const stage_dt = m_splitting.get_spatial_coeff(stage) * dt;
+    if (m_splitting.is_first_half(stage)) {
+        m_advec_x(allfdistribu, stage_dt);
+        m_advec_y(allfdistribu, stage_dt);
+    } else {
+        m_advec_y(allfdistribu, stage_dt);
+        m_advec_x(allfdistribu, stage_dt);
+    }
+}
+
+void SplitVlasovSolver::advect_velocity(
+        DFieldSpVxVyXY const allfdistribu,
+        DVectorConstFieldXY const electric_field,
+        int const stage,
+        double const dt) const
+{
+    double const stage_dt = m_splitting.get_velocity_coeff(stage) * dt;
+    m_advec_vx(allfdistribu, ddcHelper::get<X>(electric_field), stage_dt / 2);
+    m_advec_vy(allfdistribu, ddcHelper::get<Y>(electric_field), stage_dt);
+    m_advec_vx(allfdistribu, ddcHelper::get<X>(electric_field), stage_dt / 2);
+}
+
 DFieldSpVxVyXY SplitVlasovSolver::operator()(
         DFieldSpVxVyXY const allfdistribu,
         DVectorConstFieldXY const electric_field,
         double const dt) const
 {
-    m_advec_x(allfdistribu, dt / 2);
-    m_advec_y(allfdistribu, dt / 2);
-    m_advec_vx(allfdistribu, ddcHelper::get<X>(electric_field), dt / 2);
-    m_advec_vy(allfdistribu, ddcHelper::get<Y>(electric_field), dt);
-    m_advec_vx(allfdistribu, ddcHelper::get<X>(electric_field), dt / 2);
-    m_advec_y(allfdistribu, dt / 2);
-    m_advec_x(allfdistribu, dt / 2);
+    int const n_velocity_stages = m_splitting.get_n_velocity_stages();
+    for (int stage(0); stage < n_velocity_stages; ++stage) {
+        advect_spatial(allfdistribu, stage, dt);
+        advect_velocity(allfdistribu, electric_field, stage, dt);
+    }
+    advect_spatial(allfdistribu, n_velocity_stages, dt);
+
+    return allfdistribu;
+}
+
+FieldSpVxVyXY<float> SplitVlasovSolver::operator()(
+        FieldSpVxVyXY<float> const allfdistribu,
+        DVectorConstFieldXY const electric_field,
+        double const dt) const
+{
+    IdxRangeVxVyXY const idx_range_vxvyxy(get_idx_range(allfdistribu));
+    DFieldMem<IdxRangeVxVyXY> fdistribu_species_alloc(
+            "fdistribu_species (SplitVlasovSolver::operator())",
+            idx_range_vxvyxy);
+
+    for (IdxSp const isp : get_idx_range<Species>(allfdistribu)) {
+        IdxRangeSpVxVyXY const idx_range_isp(IdxRangeSp(isp, IdxStepSp(1)), idx_range_vxvyxy);
+        // Double precision view of the species on the contiguous buffer
+        DFieldSpVxVyXY fdistribu_isp(fdistribu_species_alloc.data_handle(), idx_range_isp);
+        ddcHelper::convert_deepcopy(
+                Kokkos::DefaultExecutionSpace(),
+                fdistribu_isp,
+                get_const_field(allfdistribu[idx_range_isp]));
+        (*this)(fdistribu_isp, electric_field, dt);
+        ddcHelper::convert_deepcopy(
+                Kokkos::DefaultExecutionSpace(),
+                allfdistribu[idx_range_isp],
+                get_const_field(fdistribu_isp));
+    }
 
     return allfdistribu;
 }
+
+template <class ElementType>
+void SplitVlasovSolver::compute_charge_density_after_step(
+        DFieldXY const charge_density,
+        ConstFieldSpVxVyXY<ElementType> const allfdistribu,
+        DVectorConstFieldXY const electric_field,
+        DConstFieldVxVy const quadrature_coeffs,
+        double const dt) const
+{
+    IdxRangeVxVyXY const idx_range_vxvyxy(get_idx_range(allfdistribu));
+    DFieldMem<IdxRangeVxVyXY> fdistribu_species_alloc(
+            "fdistribu_species (SplitVlasovSolver::charge_density_after_step())",
+            idx_range_vxvyxy);
+    DFieldMemXY charge_density_species_alloc(
+            "charge_density_species (SplitVlasovSolver::charge_density_after_step())",
+            get_idx_range(charge_density));
+    DFieldXY charge_density_species = get_field(charge_density_species_alloc);
+
+    int const n_velocity_stages = m_splitting.get_n_velocity_stages();
+    double const last_stage_dt = m_splitting.get_spatial_coeff(n_velocity_stages) * dt;
+
+    ddc::parallel_fill(charge_density, 0.0);
+    for (IdxSp const isp : get_idx_range<Species>(allfdistribu)) {
+        IdxRangeSpVxVyXY const idx_range_isp(IdxRangeSp(isp, IdxStepSp(1)), idx_range_vxvyxy);
+        // Double precision view of the species on the contiguous buffer
+        DFieldSpVxVyXY fdistribu_isp(fdistribu_species_alloc.data_handle(), idx_range_isp);
+        ddcHelper::convert_deepcopy(
+                Kokkos::DefaultExecutionSpace(),
+                fdistribu_isp,
+                allfdistribu[idx_range_isp]);
+        for (int stage(0); stage < n_velocity_stages; ++stage) {
+            advect_spatial(fdistribu_isp, stage, dt);
+            advect_velocity(fdistribu_isp, electric_field, stage, dt);
+        }
+        // The last spatial stage is carried out along Y then X
+        m_advec_y(fdistribu_isp, last_stage_dt);
+        m_advec_x.charge_density_after_transport(
+                charge_density_species,
+                get_const_field(fdistribu_isp),
+                quadrature_coeffs,
+                last_stage_dt);
+        const std::source_location location = std::source_location::current();
+        ddc::parallel_for_each(
+                location.function_name(),
+                Kokkos::DefaultExecutionSpace(),
+                get_idx_range(charge_density),
+                KOKKOS_LAMBDA(IdxXY const ixy) {
+                    charge_density(ixy) += charge_density_species(ixy);
+                });
+    }
+}
+
+DFieldXY SplitVlasovSolver::charge_density_after_step(
+        DFieldXY const charge_density,
+        DConstFieldSpVxVyXY const allfdistribu,
+        DVectorConstFieldXY const electric_field,
+        DConstFieldVxVy const quadrature_coeffs,
+        double const dt) const
+{
+    compute_charge_density_after_step(
+            charge_density,
+            allfdistribu,
+            electric_field,
+            quadrature_coeffs,
+            dt);
+    return charge_density;
+}
+
+DFieldXY SplitVlasovSolver::charge_density_after_step(
+        DFieldXY const charge_density,
+        ConstFieldSpVxVyXY<float> const allfdistribu,
+        DVectorConstFieldXY const electric_field,
+        DConstFieldVxVy const quadrature_coeffs,
+        double const dt) const
+{
+    compute_charge_density_after_step(
+            charge_density,
+            allfdistribu,
+            electric_field,
+            quadrature_coeffs,
+            dt);
+    return charge_density;
+}
@@ -6,15 +6,21 @@
 #include "iadvectionvx.hpp"
 #include "iadvectionx.hpp"
 #include "ivlasovsolver.hpp"
+#include "splitting_scheme.hpp"
 
 /**
- * @brief A class that solves a Vlasov equation using Strang's splitting.
+ * @brief A class that solves a Vlasov equation using a splitting method.
  *
  * The Vlasov equation is split between four advection equations 
- * along the X, Y, Vx and Vy directions. The splitting involves solving 
+ * along the X, Y, Vx and Vy directions. By default Strang's splitting is used.
+ * The splitting involves solving 
  * the advections in the X, Y, and Vx directions first on a time interval
  * of length dt/2, then the Vy-direction advection on a time dt, and
  * finally the X, Y, and Vx directions again in reverse order on dt/2.
+ *
+ * Higher order schemes alternate more spatial and velocity stages (see SplittingScheme).
+ * In each velocity stage of length b dt the advections are carried out along Vx on b dt/2,
+ * along Vy on b dt and along Vx on b dt/2.
  */
 class SplitVlasovSolver : public IVlasovSolver
 {
@@ -28,6 +34,8 @@ class SplitVlasovSolver : public IVlasovSolver
     /// Advection operator in the vy direction
     IAdvectionVelocity<GeometryVxVyXY, GridVy> const& m_advec_vy;
 
+    SplittingScheme m_splitting;
+
 public:
     /**
      * @brief Creates an instance of the split vlasov solver class.
@@ -35,12 +43,14 @@ public:
      * @param[in] advec_y An advection operator along the y direction.
      * @param[in] advec_vx An advection operator along the vx direction.
      * @param[in] advec_vy An advection operator along the vy direction.
+     * @param[in] splitting_method The splitting scheme.
      */
     SplitVlasovSolver(
             IAdvectionSpatial<GeometryVxVyXY, GridX> const& advec_x,
             IAdvectionSpatial<GeometryVxVyXY, GridY> const& advec_y,
             IAdvectionVelocity<GeometryVxVyXY, GridVx> const& advec_vx,
-            IAdvectionVelocity<GeometryVxVyXY, GridVy> const& advec_vy);
+            IAdvectionVelocity<GeometryVxVyXY, GridVy> const& advec_vy,
+            SplittingMethod splitting_method = SplittingMethod::Strang);
 
     ~SplitVlasovSolver() override = default;
 
@@ -59,4 +69,113 @@ public:
             DFieldSpVxVyXY allfdistribu,
             DVectorConstFieldXY electric_field,
             double dt) const override;
+
+    /**
+     * @brief Solves a Vlasov equation on a timestep dt for a distribution function
+     * stored in single precision.
+     *
+     * Each species is copied into a double precision buffer before being advected.
+     * The result is rounded to single precision once all the advections of a layout
+     * have been applied.
+     *
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function.
+     *                              On output : the value of the distribution function after solving 
+     *                              the Vlasov equation.
+     * @param[in] electric_field The electric field computed at all spatial positions.
+     * @param[in] dt The timestep. 
+     *
+     * @return The distribution function after solving the Vlasov equation.
+     */
+    FieldSpVxVyXY<float> operator()(
+            FieldSpVxVyXY<float> allfdistribu,
+            DVectorConstFieldXY electric_field,
+            double dt) const override;
+
+    /**
+     * @brief Computes the charge density of the solution of the Vlasov equation after a
+     * timestep dt without modifying the distribution function.
+     *
+     * Each species is copied into a double precision buffer where all the advections
+     * except the last one are applied. The last advection along x is fused with the
+     * velocity integral.
+     *
+     * @param[out] charge_density The charge density of the kinetic species at the end of
+     *                              the timestep.
+     * @param[in] allfdistribu The value of the distribution function at the start of the timestep.
+     * @param[in] electric_field The electric field computed at all spatial positions.
+     * @param[in] quadrature_coeffs The coefficients of the quadrature over the velocity space.
+     * @param[in] dt The timestep.
+     *
+     * @return The charge density at the end of the timestep.
+     */
+    DFieldXY charge_density_after_step(
+            DFieldXY charge_density,
+            DConstFieldSpVxVyXY allfdistribu,
+            DVectorConstFieldXY electric_field,
+            DConstFieldVxVy quadrature_coeffs,
+            double dt) const override;
+
+    /**
+     * @brief Computes the charge density of the solution of the Vlasov equation after a
+     * timestep dt without modifying the distribution function stored in single precision.
+     *
+     * @param[out] charge_density The charge density of the kinetic species at the end of
+     *                              the timestep.
+     * @param[in] allfdistribu The value of the distribution function at the start of the timestep.
+     * @param[in] electric_field The electric field computed at all spatial positions.
+     * @param[in] quadrature_coeffs The coefficients of the quadrature over the velocity space.
+     * @param[in] dt The timestep.
+     *
+     * @return The charge density at the end of the timestep.
+     */
+    DFieldXY charge_density_after_step(
+            DFieldXY charge_density,
+            ConstFieldSpVxVyXY<float> allfdistribu,
+            DVectorConstFieldXY electric_field,
+            DConstFieldVxVy quadrature_coeffs,
+            double dt) const override;
+
+    /**
+     * @brief Computes the charge density of the solution of the Vlasov equation after a
+     * timestep dt species by species.
+     * This function should be private. It is not due to the inclusion of a KOKKOS_LAMBDA.
+     *
+     * @param[out] charge_density The charge density of the kinetic species at the end of
+     *                              the timestep.
+     * @param[in] allfdistribu The value of the distribution function at the start of the timestep.
+     * @param[in] electric_field The electric field computed at all spatial positions.
+     * @param[in] quadrature_coeffs The coefficients of the quadrature over the velocity space.
+     * @param[in] dt The timestep.
+     */
+    template <class ElementType>
+    void compute_charge_density_after_step(
+            DFieldXY charge_density,
+            ConstFieldSpVxVyXY<ElementType> allfdistribu,
+            DVectorConstFieldXY electric_field,
+            DConstFieldVxVy quadrature_coeffs,
+            double dt) const;
+
+private:
+    /**
+     * @brief Carry out the advections of a spatial stage of the splitting scheme.
+     *
+     * @param[in, out] allfdistribu The distribution function.
+     * @param[in] stage The index of the spatial stage.
+     * @param[in] dt The timestep.
+     */
+    void advect_spatial(DFieldSpVxVyXY allfdistribu, int stage, double dt) const;
+
+    /**
+     * @brief Carry out the advections of a velocity stage of the splitting scheme.
+     *
+     * @param[in, out] allfdistribu The distribution function.
+     * @param[in] electric_field The electric field computed at all spatial positions.
+     * @param[in] stage The index of the velocity stage.
+     * @param[in] dt The timestep.
+     */
+    void advect_velocity(
+            DFieldSpVxVyXY allfdistribu,
+            DVectorConstFieldXY electric_field,
+            int stage,
+            double dt) const;
 };
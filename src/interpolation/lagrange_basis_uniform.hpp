@@ -403,14 +403,15 @@ public:
                 Idx<knot_grid> poly_start,
                 DataType offset) const
         {
-            //DataType dx = ddc::discrete_space<knot_grid>().step();
+            // The terms w_i / (x - x_i) are shared by all the bases so they are only computed once
+            DataType denominator(0.0);
             for (int i(0); i < D + 1; ++i) {
-                DataType numerator = m_weights[i] / (offset - i);
-                DataType denominator(0.0);
-                for (int j(0); j < D + 1; ++j) {
-                    denominator += m_weights[j] / (offset - j);
-                }
-                values(i) = numerator / denominator;
+                values(i) = m_weights[i] / (offset - i);
+                denominator += values(i);
+            }
+            DataType const inv_denominator = 1.0 / denominator;
+            for (int i(0); i < D + 1; ++i) {
+                values(i) *= inv_denominator;
             }
         }
     };
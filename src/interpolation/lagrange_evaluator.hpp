@@ -1,5 +1,7 @@
 // SPDX-License-Identifier: MIT
 #pragma once
+#include <array>
+
 #include "i_interpolation_evaluator.hpp"
 #include "lagrange_basis_non_uniform.hpp"
 #include "lagrange_basis_uniform.hpp"
@@ -277,8 +279,20 @@ public:
                 exec_space(),
                 batch_idx_range,
                 KOKKOS_CLASS_LAMBDA(IdxBatchInterpolation const j) {
-                    for (Idx<InterpolationGrid> const i : evaluation_idx_range) {
-                        lagrange_eval(j, i) = eval(coords_eval(j, i), lagrange_coef[j]);
+                    if constexpr (lagrange_basis_type::is_uniform()) {
+                        // The basis values are shared by consecutive feet with the same
+                        // position relative to their stencil (e.g. for a constant shift)
+                        BasisCache basis_cache;
+                        for (Idx<InterpolationGrid> const i : evaluation_idx_range) {
+                            lagrange_eval(j, i) = eval_with_basis_cache(
+                                    coords_eval(j, i),
+                                    lagrange_coef[j],
+                                    basis_cache);
+                        }
+                    } else {
+                        for (Idx<InterpolationGrid> const i : evaluation_idx_range) {
+                            lagrange_eval(j, i) = eval(coords_eval(j, i), lagrange_coef[j]);
+                        }
                     }
                 });
     }
@@ -449,31 +463,110 @@ public:
     }
 
 private:
+    /// The values of the basis at the last position evaluated with eval_with_basis_cache.
+    struct BasisCache
+    {
+        /// The position of the last evaluation point relative to its stencil (in cells).
+        DataType offset = -1;
+        /// The values of the degree+1 bases of the stencil at this position.
+        std::array<DataType, lagrange_basis_type::degree() + 1> values;
+    };
+
     template <class Layout, class... CoordsDims>
     KOKKOS_INLINE_FUNCTION DataType
     eval(Coord<CoordsDims...> const& coord_eval,
          ConstField<DataType, coeff_idx_range_type, memory_space, Layout> const lagrange_coef) const
     {
-        Coord<continuous_dimension_type> coord_eval_interest(coord_eval);
+        return eval_with_bc(
+                Coord<continuous_dimension_type>(coord_eval),
+                lagrange_coef,
+                [&](Coord<continuous_dimension_type> const& coord_interest) {
+                    return eval_no_bc(Idx<>(), coord_interest, lagrange_coef);
+                });
+    }
+
+    /**
+     * @brief Evaluate a Lagrange polynomial on a uniform basis, reusing the values of the
+     * basis computed for the previous evaluation point if it has the same position relative
+     * to its stencil.
+     *
+     * @param coord_eval The coordinate where the Lagrange polynomial is evaluated.
+     * @param lagrange_coef A Field storing the 1D Lagrange coefficients.
+     * @param[in, out] basis_cache The values of the basis at the previous evaluation point.
+     *
+     * @return The value of the Lagrange polynomial at the desired coordinate.
+     */
+    template <class Layout, class... CoordsDims>
+    KOKKOS_INLINE_FUNCTION DataType eval_with_basis_cache(
+            Coord<CoordsDims...> const& coord_eval,
+            ConstField<DataType, coeff_idx_range_type, memory_space, Layout> const lagrange_coef,
+            BasisCache& basis_cache) const
+    {
+        using knot_grid = UniformLagrangeKnots<LagrangeBasis>;
+        constexpr std::size_t n_basis = lagrange_basis_type::degree() + 1;
+
+        return eval_with_bc(
+                Coord<continuous_dimension_type>(coord_eval),
+                lagrange_coef,
+                [&](Coord<continuous_dimension_type> coord_interest) {
+                    Idx<knot_grid> const first_lagrange_knot = find_stencil(coord_interest);
+                    DataType const offset
+                            = (coord_interest - ddc::coordinate(first_lagrange_knot))
+                              / ddc::step<knot_grid>();
+                    DataType const tolerance
+                            = Kokkos::Experimental::epsilon_v<DataType> * n_basis;
+                    if (Kokkos::abs(offset - basis_cache.offset) > tolerance) {
+                        Kokkos::mdspan<DataType, Kokkos::extents<std::size_t, n_basis>> const
+                                vals(basis_cache.values.data());
+                        ddc::discrete_space<lagrange_basis_type>()
+                                .eval_basis(vals, coord_interest, first_lagrange_knot);
+                        basis_cache.offset = offset;
+                    }
+
+                    DataType y = 0.0;
+                    for (std::size_t i = 0; i < n_basis; ++i) {
+                        y += lagrange_coef(first_lagrange_knot + i) * basis_cache.values[i];
+                    }
+                    return y;
+                });
+    }
+
+    /**
+     * @brief Apply the boundary conditions before evaluating a Lagrange polynomial.
+     *
+     * For a periodic basis the coordinate is wrapped into the domain. Otherwise the
+     * extrapolation rules are used outside the domain.
+     *
+     * @param coord_eval The coordinate where the Lagrange polynomial is evaluated.
+     * @param lagrange_coef A Field storing the 1D Lagrange coefficients.
+     * @param eval_inside The function evaluating the polynomial at a coordinate in the domain.
+     *
+     * @return The value of the Lagrange polynomial at the desired coordinate.
+     */
+    template <class Layout, class EvalInside>
+    KOKKOS_INLINE_FUNCTION DataType eval_with_bc(
+            Coord<continuous_dimension_type> coord_eval,
+            ConstField<DataType, coeff_idx_range_type, memory_space, Layout> const lagrange_coef,
+            EvalInside const& eval_inside) const
+    {
         if constexpr (lagrange_basis_type::is_periodic()) {
-            if (coord_eval_interest < ddc::discrete_space<lagrange_basis_type>().rmin()
-                || coord_eval_interest > ddc::discrete_space<lagrange_basis_type>().rmax()) {
-                coord_eval_interest
-                        -= Kokkos::floor(
-                                   (coord_eval_interest
-                                    - ddc::discrete_space<lagrange_basis_type>().rmin())
-                                   / ddc::discrete_space<lagrange_basis_type>().length())
-                           * ddc::discrete_space<lagrange_basis_type>().length();
+            if (coord_eval < ddc::discrete_space<lagrange_basis_type>().rmin()
+                || coord_eval > ddc::discrete_space<lagrange_basis_type>().rmax()) {
+                coord_eval -= Kokkos::floor(
+                                      (coord_eval
+                                       - ddc::discrete_space<lagrange_basis_type>().rmin())
+                                      / ddc::discrete_space<lagrange_basis_type>().length())
+                              * ddc::discrete_space<lagrange_basis_type>().length();
             }
         } else {
-            if (coord_eval_interest < ddc::discrete_space<lagrange_basis_type>().rmin()) {
-                return m_lower_extrap_rule(coord_eval_interest, lagrange_coef);
+            if (coord_eval < ddc::discrete_space<lagrange_basis_type>().rmin()) {
+                return m_lower_extrap_rule(coord_eval, lagrange_coef);
             }
-            if (coord_eval_interest > ddc::discrete_space<lagrange_basis_type>().rmax()) {
-                return m_upper_extrap_rule(coord_eval_interest, lagrange_coef);
+            if (coord_eval > ddc::discrete_space<lagrange_basis_type>().rmax()) {
+                return m_upper_extrap_rule(coord_eval, lagrange_coef);
             }
         }
-        return eval_no_bc(Idx<>(), coord_eval_interest, lagrange_coef);
+        return eval_inside(coord_eval);
     }
 
     /**
@@ -547,8 +640,6 @@ private:
 
         Coord<continuous_dimension_type> coord_interest(coord_eval);
         Idx<knot_grid> first_lagrange_knot = find_stencil(coord_interest);
-        ddc::discrete_space<lagrange_basis_type>()
-                .eval_basis(vals, coord_interest, first_lagrange_knot);
         if constexpr (sizeof...(DerivDims) == 0) {
             ddc::discrete_space<lagrange_basis_type>()
                     .eval_basis(vals, coord_interest, first_lagrange_knot);
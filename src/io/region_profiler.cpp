@@ -0,0 +1,480 @@
+// SPDX-License-Identifier: MIT
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <string_view>
+
+#include <Kokkos_Core.hpp>
+#include <pdi.h>
+
+#include "region_profiler.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::string_view gslx_region_prefix = "(GSLX)";
+constexpr std::string_view bytes_event_prefix = "(GSLX) bytes ";
+
+/// The data collected on this rank for one region.
+struct RegionData
+{
+    std::string name;
+    long calls = 0;
+    double inclusive = 0.0;
+    double exclusive = 0.0;
+    double bytes = 0.0;
+    double inclusive_at_last_step = 0.0;
+};
+
+/// A region which is currently open.
+struct OpenRegion
+{
+    // The index of the region in RegionProfilerState::regions or -1 for a non-GSLX region.
+    int region_id;
+    Clock::time_point start;
+    // The time spent in GSLX sub-regions.
+    double children_time;
+};
+
+struct RegionProfilerState
+{
+    bool active = false;
+    RegionProfilingOptions options;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    int rank = 0;
+    std::vector<RegionData> regions;
+    std::map<std::string, int, std::less<>> region_ids;
+    std::vector<OpenRegion> open_regions;
+    int step = 0;
+};
+
+RegionProfilerState& get_state()
+{
+    static RegionProfilerState state;
+    return state;
+}
+
+bool mpi_is_usable()
+{
+    int initialised;
+    int finalised;
+    MPI_Initialized(&initialised);
+    MPI_Finalized(&finalised);
+    return initialised && !finalised;
+}
+
+/// Check if an environment variable is set to 1.
+bool environment_flag_is_set(char const* const name)
+{
+    char const* const value = std::getenv(name);
+    return value && std::string_view(value) == "1";
+}
+
+int get_region_id(std::string_view name)
+{
+    RegionProfilerState& state = get_state();
+    auto it = state.region_ids.find(name);
+    if (it != state.region_ids.end()) {
+        return it->second;
+    }
+    int const region_id = state.regions.size();
+    state.regions.push_back(RegionData {std::string(name)});
+    state.region_ids.emplace(std::string(name), region_id);
+    return region_id;
+}
+
+void expose_iteration()
+{
+    RegionProfilerState& state = get_state();
+    std::string names;
+    std::vector<double> step_times(state.regions.size());
+    for (std::size_t i(0); i < state.regions.size(); ++i) {
+        RegionData& region = state.regions[i];
+        names += region.name + '\n';
+        step_times[i] = region.inclusive - region.inclusive_at_last_step;
+        region.inclusive_at_last_step = region.inclusive;
+    }
+    std::size_t names_extents = names.size();
+    std::size_t step_times_extents = step_times.size();
+    PDI_multi_expose(
+            "region_profiling_iteration",
+            "region_profiling_rank",
+            &state.rank,
+            PDI_OUT,
+            "region_profiling_step",
+            &state.step,
+            PDI_OUT,
+            "region_profiling_step_names_extents",
+            &names_extents,
+            PDI_OUT,
+            "region_profiling_step_names",
+            names.data(),
+            PDI_OUT,
+            "region_profiling_step_times_extents",
+            &step_times_extents,
+            PDI_OUT,
+            "region_profiling_step_times",
+            step_times.data(),
+            PDI_OUT,
+            NULL);
+    state.step += 1;
+}
+
+void push_region(char const* name)
+{
+    RegionProfilerState& state = get_state();
+    if (state.options.fence_at_region_boundaries) {
+        Kokkos::fence("region_profiler");
+    }
+    std::string_view const name_view(name);
+    int const region_id = name_view.starts_with(gslx_region_prefix) ? get_region_id(name_view) : -1;
+    state.open_regions.push_back(OpenRegion {region_id, Clock::now(), 0.0});
+}
+
+void pop_region()
+{
+    RegionProfilerState& state = get_state();
+    if (state.open_regions.empty()) {
+        // The region was opened before the profiler started.
+        return;
+    }
+    if (state.options.fence_at_region_boundaries) {
+        Kokkos::fence("region_profiler");
+    }
+    OpenRegion const closed = state.open_regions.back();
+    state.open_regions.pop_back();
+    double const elapsed = std::chrono::duration<double>(Clock::now() - closed.start).count();
+
+    if (closed.region_id < 0) {
+        // Non-GSLX regions are transparent
+        if (!state.open_regions.empty()) {
+            state.open_regions.back().children_time += closed.children_time;
+        }
+        return;
+    }
+
+    RegionData& region = state.regions[closed.region_id];
+    region.calls += 1;
+    region.inclusive += elapsed;
+    region.exclusive += elapsed - closed.children_time;
+    if (!state.open_regions.empty()) {
+        state.open_regions.back().children_time += elapsed;
+    }
+
+    if (state.options.stream_iterations && region.name == state.options.iteration_region) {
+        expose_iteration();
+    }
+}
+
+void profile_event(char const* name)
+{
+    RegionProfilerState& state = get_state();
+    std::string_view const name_view(name);
+    if (!name_view.starts_with(bytes_event_prefix)) {
+        return;
+    }
+    auto region_it = std::find_if(
+            state.open_regions.rbegin(),
+            state.open_regions.rend(),
+            [](OpenRegion const& open_region) { return open_region.region_id >= 0; });
+    if (region_it != state.open_regions.rend()) {
+        state.regions[region_it->region_id].bytes
+                += std::strtod(name + bytes_event_prefix.size(), nullptr);
+    }
+}
+
+} // namespace
+
+void start_region_profiling(RegionProfilingOptions const& options, MPI_Comm comm)
+{
+    RegionProfilerState& state = get_state();
+    if (state.active) {
+        return;
+    }
+    Kokkos::Tools::Experimental::EventSet const callbacks
+            = Kokkos::Tools::Experimental::get_callbacks();
+    if (callbacks.push_region != nullptr || callbacks.pop_region != nullptr) {
+        std::cerr << "A Kokkos tool is already attached. The built-in region profiler is not "
+                     "started."
+                  << std::endl;
+        return;
+    }
+    state = RegionProfilerState();
+    state.options = options;
+    state.comm = comm;
+    if (mpi_is_usable()) {
+        MPI_Comm_rank(comm, &state.rank);
+    }
+    state.active = true;
+    Kokkos::Tools::Experimental::set_push_region_callback(push_region);
+    Kokkos::Tools::Experimental::set_pop_region_callback(pop_region);
+    Kokkos::Tools::Experimental::set_profile_event_callback(profile_event);
+}
+
+bool start_region_profiling_if_requested(MPI_Comm comm)
+{
+    if (!environment_flag_is_set("GSLX_REGION_PROFILING")) {
+        return false;
+    }
+    RegionProfilingOptions options;
+    options.fence_at_region_boundaries = environment_flag_is_set("GSLX_REGION_PROFILING_FENCE");
+    options.stream_iterations = environment_flag_is_set("GSLX_REGION_PROFILING_STREAM");
+    start_region_profiling(options, comm);
+    return true;
+}
+
+bool region_profiling_is_active()
+{
+    return get_state().active;
+}
+
+std::vector<RegionProfile> get_region_profiles()
+{
+    RegionProfilerState const& state = get_state();
+    bool const use_mpi = mpi_is_usable();
+
+    // Collect the names of the regions entered on any rank
+    std::vector<std::string> names;
+    names.reserve(state.regions.size());
+    for (RegionData const& region : state.regions) {
+        names.push_back(region.name);
+    }
+    if (use_mpi) {
+        std::string local_names;
+        for (std::string const& name : names) {
+            local_names += name + '\n';
+        }
+        int comm_size;
+        MPI_Comm_size(state.comm, &comm_size);
+        int const local_size = local_names.size();
+        std::vector<int> sizes(comm_size);
+        MPI_Allgather(&local_size, 1, MPI_INT, sizes.data(), 1, MPI_INT, state.comm);
+        std::vector<int> displacements(comm_size, 0);
+        for (int i(1); i < comm_size; ++i) {
+            displacements[i] = displacements[i - 1] + sizes[i - 1];
+        }
+        std::string all_names(displacements.back() + sizes.back(), '\0');
+        MPI_Allgatherv(
+                local_names.data(),
+                local_size,
+                MPI_CHAR,
+                all_names.data(),
+                sizes.data(),
+                displacements.data(),
+                MPI_CHAR,
+                state.comm);
+        names.clear();
+        std::size_t start = 0;
+        for (std::size_t end = all_names.find('\n'); end != std::string::npos;
+             end = all_names.find('\n', start)) {
+            names.push_back(all_names.substr(start, end - start));
+            start = end + 1;
+        }
+    }
+    std::sort(names.begin(), names.end());
+    names.erase(std::unique(names.begin(), names.end()), names.end());
+
+    // Fill the local data in the global order
+    std::size_t const n_regions = names.size();
+    double constexpr inf = std::numeric_limits<double>::infinity();
+    // [inclusive, exclusive]
+    std::vector<double> minima(2 * n_regions, inf);
+    std::vector<double> maxima(2 * n_regions, 0.0);
+    // [n_ranks, calls, inclusive, exclusive, bytes]
+    std::vector<double> sums(5 * n_regions, 0.0);
+    for (std::size_t i(0); i < n_regions; ++i) {
+        auto it = state.region_ids.find(names[i]);
+        if (it == state.region_ids.end()) {
+            continue;
+        }
+        RegionData const& region = state.regions[it->second];
+        minima[2 * i] = region.inclusive;
+        minima[2 * i + 1] = region.exclusive;
+        maxima[2 * i] = region.inclusive;
+        maxima[2 * i + 1] = region.exclusive;
+        sums[5 * i] = 1.0;
+        sums[5 * i + 1] = region.calls;
+        sums[5 * i + 2] = region.inclusive;
+        sums[5 * i + 3] = region.exclusive;
+        sums[5 * i + 4] = region.bytes;
+    }
+    if (use_mpi) {
+        MPI_Allreduce(
+                MPI_IN_PLACE,
+                minima.data(),
+                minima.size(),
+                MPI_DOUBLE,
+                MPI_MIN,
+                state.comm);
+        MPI_Allreduce(
+                MPI_IN_PLACE,
+                maxima.data(),
+                maxima.size(),
+                MPI_DOUBLE,
+                MPI_MAX,
+                state.comm);
+        MPI_Allreduce(MPI_IN_PLACE, sums.data(), sums.size(), MPI_DOUBLE, MPI_SUM, state.comm);
+    }
+
+    std::vector<RegionProfile> profiles;
+    profiles.reserve(n_regions);
+    for (std::size_t i(0); i < n_regions; ++i) {
+        double const n_ranks = sums[5 * i];
+        profiles.push_back(RegionProfile {
+                names[i],
+                static_cast<int>(n_ranks),
+                sums[5 * i + 1] / n_ranks,
+                minima[2 * i],
+                maxima[2 * i],
+                sums[5 * i + 2] / n_ranks,
+                minima[2 * i + 1],
+                maxima[2 * i + 1],
+                sums[5 * i + 3] / n_ranks,
+                sums[5 * i + 4]});
+    }
+    return profiles;
+}
+
+void print_region_profiles(std::ostream& os, std::vector<RegionProfile> const& profiles)
+{
+    std::size_t name_width = 6;
+    for (RegionProfile const& profile : profiles) {
+        name_width = std::max(name_width, profile.name.size());
+    }
+    std::ios_base::fmtflags const flags = os.flags();
+    os << std::left << std::setw(name_width) << "Region" << std::right << std::setw(10)
+       << "Calls" << std::setw(12) << "Incl. min" << std::setw(12) << "Incl. max"
+       << std::setw(12) << "Incl. mean" << std::setw(12) << "Excl. min" << std::setw(12)
+       << "Excl. max" << std::setw(12) << "Excl. mean" << std::setw(12) << "GB/s" << "\n";
+    for (RegionProfile const& profile : profiles) {
+        os << std::left << std::setw(name_width) << profile.name << std::right
+           << std::setw(10) << std::setprecision(6) << profile.calls << std::scientific
+           << std::setprecision(3) << std::setw(12) << profile.inclusive_min << std::setw(12)
+           << profile.inclusive_max << std::setw(12) << profile.inclusive_mean << std::setw(12)
+           << profile.exclusive_min << std::setw(12) << profile.exclusive_max << std::setw(12)
+           << profile.exclusive_mean << std::setw(12);
+        if (profile.bytes > 0 && profile.inclusive_mean > 0) {
+            os << profile.bytes / profile.n_ranks / profile.inclusive_mean * 1e-9;
+        } else {
+            os << "-";
+        }
+        os << std::defaultfloat << "\n";
+    }
+    os.flags(flags);
+}
+
+void stop_region_profiling()
+{
+    RegionProfilerState& state = get_state();
+    if (!state.active) {
+        return;
+    }
+    Kokkos::Tools::Experimental::set_push_region_callback(nullptr);
+    Kokkos::Tools::Experimental::set_pop_region_callback(nullptr);
+    Kokkos::Tools::Experimental::set_profile_event_callback(nullptr);
+    state = RegionProfilerState();
+}
+
+void finalise_region_profiling(std::ostream& os)
+{
+    if (!region_profiling_is_active()) {
+        return;
+    }
+    std::vector<RegionProfile> const profiles = get_region_profiles();
+
+    int rank = get_state().rank;
+    if (rank == 0) {
+        os << "Region profiling summary (times in s, statistics over MPI ranks):\n";
+        print_region_profiles(os, profiles);
+    }
+
+    std::size_t const n_regions = profiles.size();
+    std::string names;
+    std::vector<double> calls(n_regions);
+    std::vector<double> inclusive_min(n_regions);
+    std::vector<double> inclusive_max(n_regions);
+    std::vector<double> inclusive_mean(n_regions);
+    std::vector<double> exclusive_min(n_regions);
+    std::vector<double> exclusive_max(n_regions);
+    std::vector<double> exclusive_mean(n_regions);
+    std::vector<double> bytes(n_regions);
+    for (std::size_t i(0); i < n_regions; ++i) {
+        names += profiles[i].name + '\n';
+        calls[i] = profiles[i].calls;
+        inclusive_min[i] = profiles[i].inclusive_min;
+        inclusive_max[i] = profiles[i].inclusive_max;
+        inclusive_mean[i] = profiles[i].inclusive_mean;
+        exclusive_min[i] = profiles[i].exclusive_min;
+        exclusive_max[i] = profiles[i].exclusive_max;
+        exclusive_mean[i] = profiles[i].exclusive_mean;
+        bytes[i] = profiles[i].bytes;
+    }
+    std::size_t names_extents = names.size();
+    std::size_t regions_extents = n_regions;
+    PDI_multi_expose(
+            "region_profiling_summary",
+            "region_profiling_rank",
+            &rank,
+            PDI_OUT,
+            "region_profiling_names_extents",
+            &names_extents,
+            PDI_OUT,
+            "region_profiling_names",
+            names.data(),
+            PDI_OUT,
+            "region_profiling_calls_extents",
+            &regions_extents,
+            PDI_OUT,
+            "region_profiling_calls",
+            calls.data(),
+            PDI_OUT,
+            "region_profiling_inclusive_min_extents",
+            &regions_extents,
+            PDI_OUT,
+            "region_profiling_inclusive_min",
+            inclusive_min.data(),
+            PDI_OUT,
+            "region_profiling_inclusive_max_extents",
+            &regions_extents,
+            PDI_OUT,
+            "region_profiling_inclusive_max",
+            inclusive_max.data(),
+            PDI_OUT,
+            "region_profiling_inclusive_mean_extents",
+            &regions_extents,
+            PDI_OUT,
+            "region_profiling_inclusive_mean",
+            inclusive_mean.data(),
+            PDI_OUT,
+            "region_profiling_exclusive_min_extents",
+            &regions_extents,
+            PDI_OUT,
+            "region_profiling_exclusive_min",
+            exclusive_min.data(),
+            PDI_OUT,
+            "region_profiling_exclusive_max_extents",
+            &regions_extents,
+            PDI_OUT,
+            "region_profiling_exclusive_max",
+            exclusive_max.data(),
+            PDI_OUT,
+            "region_profiling_exclusive_mean_extents",
+            &regions_extents,
+            PDI_OUT,
+            "region_profiling_exclusive_mean",
+            exclusive_mean.data(),
+            PDI_OUT,
+            "region_profiling_bytes_extents",
+            &regions_extents,
+            PDI_OUT,
+            "region_profiling_bytes",
+            bytes.data(),
+            PDI_OUT,
+            NULL);
+
+    stop_region_profiling();
+}
@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+/**
+ * @brief The options controlling the built-in region profiler.
+ *
+ * @see start_region_profiling
+ */
+struct RegionProfilingOptions
+{
+    /**
+     * @brief Fence the default execution space when a region opens or closes.
+     *
+     * Without fences the asynchronous device kernels launched inside a region may be
+     * attributed to the region which is open when they finish. The fences serialise the
+     * host and the device so they are off by default.
+     */
+    bool fence_at_region_boundaries = false;
+
+    /**
+     * @brief Stream the timings of each iteration through PDI.
+     *
+     * If this is true then the PDI event "region_profiling_iteration" is triggered each time
+     * the region iteration_region closes. The following data is exposed (each array has an
+     * associated "_extents" array):
+     * - region_profiling_rank : The rank of the process in the communicator.
+     * - region_profiling_step : The index of the iteration.
+     * - region_profiling_step_names : The names of the regions separated by new lines.
+     * - region_profiling_step_times : The inclusive time spent in each region on this rank.
+     */
+    bool stream_iterations = false;
+
+    /// @brief The name of the region which delimits an iteration.
+    std::string iteration_region = "(GSLX) Time step";
+};
+
+/**
+ * @brief The statistics collected for one region, aggregated over the MPI ranks.
+ *
+ * The minimum, maximum and mean are calculated over the ranks which entered the region.
+ */
+struct RegionProfile
+{
+    /// @brief The name of the region.
+    std::string name;
+    /// @brief The number of ranks which entered the region.
+    int n_ranks;
+    /// @brief The mean (over the ranks) number of times the region was entered.
+    double calls;
+    /// @brief The minimum time (s) spent in the region on one rank (including sub-regions).
+    double inclusive_min;
+    /// @brief The maximum time (s) spent in the region on one rank (including sub-regions).
+    double inclusive_max;
+    /// @brief The mean time (s) spent in the region on one rank (including sub-regions).
+    double inclusive_mean;
+    /// @brief The minimum time (s) spent in the region on one rank (excluding sub-regions).
+    double exclusive_min;
+    /// @brief The maximum time (s) spent in the region on one rank (excluding sub-regions).
+    double exclusive_max;
+    /// @brief The mean time (s) spent in the region on one rank (excluding sub-regions).
+    double exclusive_mean;
+    /// @brief The total number of bytes annotated in the region on all ranks.
+    double bytes;
+};
+
+/**
+ * @brief Start the built-in region profiler.
+ *
+ * The profiler registers Kokkos Tools callbacks and collects the inclusive times, the
+ * exclusive times, the call counts and the bytes annotations (see annotate_region_bytes)
+ * of all regions whose name begins with "(GSLX)". Other regions are transparent: the time
+ * spent inside them is attributed to the enclosing "(GSLX)" region.
+ *
+ * If an external Kokkos tool is already attached then the profiler does not start so
+ * that the tool's callbacks are not overwritten.
+ *
+ * The profiler is not thread-safe. Regions must be pushed and popped from the host thread
+ * which started the profiler.
+ *
+ * @param[in] options The options controlling the profiler.
+ * @param[in] comm The MPI communicator over which the statistics are aggregated. It is
+ *              only used if MPI is initialised.
+ */
+void start_region_profiling(
+        RegionProfilingOptions const& options = RegionProfilingOptions(),
+        MPI_Comm comm = MPI_COMM_WORLD);
+
+/**
+ * @brief Start the built-in region profiler if it was requested through the environment.
+ *
+ * Profiling is opt-in. The profiler is only started if the environment variable
+ * GSLX_REGION_PROFILING is set to 1. The options are also read from the environment:
+ * - GSLX_REGION_PROFILING_FENCE=1 sets fence_at_region_boundaries;
+ * - GSLX_REGION_PROFILING_STREAM=1 sets stream_iterations.
+ *
+ * @param[in] comm The MPI communicator over which the statistics are aggregated.
+ *
+ * @returns True if the profiler was requested.
+ *
+ * @see start_region_profiling
+ */
+bool start_region_profiling_if_requested(MPI_Comm comm = MPI_COMM_WORLD);
+
+/**
+ * @brief Check if the built-in region profiler is collecting data.
+ *
+ * @returns True if start_region_profiling was called successfully and the profiler
+ *          has not been stopped.
+ */
+bool region_profiling_is_active();
+
+/**
+ * @brief Aggregate the statistics collected by the region profiler over the MPI ranks.
+ *
+ * This function is collective over the communicator passed to start_region_profiling.
+ * The regions are sorted by name.
+ *
+ * @returns The statistics for every region entered on at least one rank.
+ */
+std::vector<RegionProfile> get_region_profiles();
+
+/**
+ * @brief Print a table describing the statistics of the regions.
+ *
+ * @param[inout] os The stream where the table is printed.
+ * @param[in] profiles The statistics to be printed.
+ */
+void print_region_profiles(std::ostream& os, std::vector<RegionProfile> const& profiles);
+
+/**
+ * @brief Stop the region profiler and discard the collected data.
+ *
+ * The Kokkos Tools callbacks are unregistered.
+ */
+void stop_region_profiling();
+
+/**
+ * @brief Write the summary of the region profiler and stop it.
+ *
+ * The statistics are aggregated over the MPI ranks, printed by rank 0 and exposed through
+ * the PDI event "region_profiling_summary". This function must therefore be called before
+ * PDI_finalize. It is collective over the communicator passed to start_region_profiling.
+ * It does nothing if the profiler is not active.
+ *
+ * The following data is exposed (each array has an associated "_extents" array):
+ * - region_profiling_rank : The rank of the process in the communicator.
+ * - region_profiling_names : The names of the regions separated by new lines.
+ * - region_profiling_calls : The mean number of calls.
+ * - region_profiling_inclusive_{min,max,mean} : The inclusive times.
+ * - region_profiling_exclusive_{min,max,mean} : The exclusive times.
+ * - region_profiling_bytes : The total number of annotated bytes.
+ *
+ * @param[inout] os The stream where rank 0 prints the summary.
+ */
+void finalise_region_profiling(std::ostream& os = std::cout);
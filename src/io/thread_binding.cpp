@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: MIT
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include <Kokkos_Core.hpp>
+
+#include "thread_binding.hpp"
+
+namespace {
+
+/// Get the CPU on which the calling thread is running or -1 if this is unknown.
+int get_current_cpu()
+{
+#if defined(__linux__)
+    return sched_getcpu();
+#else
+    return -1;
+#endif
+}
+
+std::string get_environment_variable(char const* const name)
+{
+    char const* const value = std::getenv(name);
+    return value ? value : "";
+}
+
+} // namespace
+
+void print_thread_binding(std::ostream& os, MPI_Comm comm)
+{
+    using HostExecSpace = Kokkos::DefaultHostExecutionSpace;
+
+    int rank;
+    int size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    // With a static schedule each index is handled by a different thread
+    int const n_threads = HostExecSpace().concurrency();
+    Kokkos::View<int*, Kokkos::HostSpace> cpus("cpus (print_thread_binding)", n_threads);
+    Kokkos::parallel_for(
+            "thread_binding",
+            Kokkos::RangePolicy<HostExecSpace, Kokkos::Schedule<Kokkos::Static>>(0, n_threads),
+            [=](int const i) { cpus(i) = get_current_cpu(); });
+    HostExecSpace().fence();
+
+    std::vector<char> host_name(MPI_MAX_PROCESSOR_NAME, '\0');
+    int host_name_length;
+    MPI_Get_processor_name(host_name.data(), &host_name_length);
+
+    std::vector<int> all_n_threads(rank == 0 ? size : 0);
+    MPI_Gather(&n_threads, 1, MPI_INT, all_n_threads.data(), 1, MPI_INT, 0, comm);
+    std::vector<char> all_host_names(rank == 0 ? size * MPI_MAX_PROCESSOR_NAME : 0);
+    MPI_Gather(
+            host_name.data(),
+            MPI_MAX_PROCESSOR_NAME,
+            MPI_CHAR,
+            all_host_names.data(),
+            MPI_MAX_PROCESSOR_NAME,
+            MPI_CHAR,
+            0,
+            comm);
+    std::vector<int> displacements(rank == 0 ? size : 0);
+    int n_threads_total = 0;
+    for (int i(0); i < static_cast<int>(all_n_threads.size()); ++i) {
+        displacements[i] = n_threads_total;
+        n_threads_total += all_n_threads[i];
+    }
+    std::vector<int> all_cpus(n_threads_total);
+    MPI_Gatherv(
+            cpus.data(),
+            n_threads,
+            MPI_INT,
+            all_cpus.data(),
+            all_n_threads.data(),
+            displacements.data(),
+            MPI_INT,
+            0,
+            comm);
+
+    if (rank != 0) {
+        return;
+    }
+
+    std::string const proc_bind = get_environment_variable("OMP_PROC_BIND");
+    std::string const places = get_environment_variable("OMP_PLACES");
+    os << "Thread binding (OMP_PROC_BIND=" << proc_bind << ", OMP_PLACES=" << places << ")"
+       << std::endl;
+
+    // The number of threads running on each CPU of each node
+    std::map<std::pair<std::string, int>, int> n_threads_per_cpu;
+    bool cpu_is_known = true;
+    for (int i(0); i < size; ++i) {
+        std::string const name(&all_host_names[i * MPI_MAX_PROCESSOR_NAME]);
+        os << "  rank " << i << " on " << name << " : " << all_n_threads[i]
+           << " thread(s) on CPU(s)";
+        for (int j(0); j < all_n_threads[i]; ++j) {
+            int const cpu = all_cpus[displacements[i] + j];
+            cpu_is_known = cpu_is_known && (cpu >= 0);
+            os << " " << cpu;
+            n_threads_per_cpu[{name, cpu}] += 1;
+        }
+        os << std::endl;
+    }
+
+    if (proc_bind.empty() && n_threads_total > size) {
+        os << "Warning: The threads are not bound to cores. Set OMP_PROC_BIND (e.g. to spread) "
+              "and OMP_PLACES (e.g. to cores) to keep the data close to the threads."
+           << std::endl;
+    }
+    if (cpu_is_known) {
+        for (auto const& [host_cpu, n] : n_threads_per_cpu) {
+            if (n > 1) {
+                os << "Warning: " << n << " threads are running on CPU " << host_cpu.second
+                   << " of " << host_cpu.first << "." << std::endl;
+            }
+        }
+    } else {
+        os << "The CPUs used by the threads are unknown on this system." << std::endl;
+    }
+}
@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <iostream>
+
+#include <mpi.h>
+
+/**
+ * @brief Print the CPU on which each host thread of each MPI rank is running.
+ *
+ * The memory of a field is mapped on the NUMA node of the thread which first writes to it
+ * (see first_touch). This placement is only useful if the threads stay on the same core
+ * for the whole simulation. This function reports the binding of the threads so that a bad
+ * configuration can be spotted at startup. The CPUs used by the threads of the default
+ * host execution space are collected on every rank and printed by rank 0 along with the
+ * values of the environment variables OMP_PROC_BIND and OMP_PLACES.
+ *
+ * A warning is printed if the threads are not bound or if several threads (possibly from
+ * different ranks) are running on the same CPU of a node.
+ *
+ * The CPU is only available on Linux systems. This function is collective over the
+ * communicator and must be called after Kokkos is initialised.
+ *
+ * @param[inout] os The stream where rank 0 prints the report.
+ * @param[in] comm The MPI communicator whose ranks are described.
+ */
+void print_thread_binding(std::ostream& os = std::cout, MPI_Comm comm = MPI_COMM_WORLD);
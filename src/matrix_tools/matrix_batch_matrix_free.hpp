@@ -0,0 +1,310 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <cassert>
+#include <optional>
+#include <stdexcept>
+
+#include <Kokkos_Core.hpp>
+
+#include "matrix_batch.hpp"
+
+/**
+ * @brief A tag to choose between the batched iterative solvers of MatrixBatchMatrixFree.
+ *
+ * BICGSTAB BiConjugate Gradient Stabilised method. BICGSTAB is able to solve general problems.
+ * CG Conjugate Gradient method (For symmetric positive definite matrices).
+ * If the matrices structures verify CG requirements, we encourage the use of this method for its lower computation cost.
+ */
+enum class MatrixBatchMatrixFreeSolver { CG, BICGSTAB };
+
+namespace matrix_free_detail {
+
+/**
+ * @brief Two scalar products accumulated in the same loop over the vectors.
+ */
+struct DotProducts
+{
+    /// The first scalar product.
+    double first = 0.0;
+    /// The second scalar product.
+    double second = 0.0;
+
+    /**
+     * @brief Add the contributions of another part of the vectors.
+     * @param[in] other The scalar products computed on another part of the vectors.
+     * @return A reference to this object.
+     */
+    KOKKOS_FUNCTION DotProducts& operator+=(DotProducts const& other)
+    {
+        first += other.first;
+        second += other.second;
+        return *this;
+    }
+};
+
+} // namespace matrix_free_detail
+
+/// @cond
+namespace Kokkos {
+template <>
+struct reduction_identity<matrix_free_detail::DotProducts>
+{
+    KOKKOS_FORCEINLINE_FUNCTION static matrix_free_detail::DotProducts sum()
+    {
+        return matrix_free_detail::DotProducts();
+    }
+};
+} // namespace Kokkos
+/// @endcond
+
+/**
+ * @brief Matrix class which is able to solve a batch of linear systems whose matrices are not stored.
+ * Executes on either CPU or GPU without any dependency on Ginkgo.
+ *
+ * The matrices are only known through a linear operator provided by the user which computes
+ * one component of a matrix-vector product. It must be copyable to the device and provide the
+ * following KOKKOS_FUNCTION:
+ * @code
+ * template <class VectorType>
+ * KOKKOS_FUNCTION double operator()(int batch_idx, int row, VectorType const& x) const;
+ * @endcode
+ * which returns the component row of the product between the matrix of the system batch_idx
+ * and the vector x. This is well suited to matrices with a stencil or a tensor-product
+ * structure for which the product can be computed without reading the matrix from memory.
+ *
+ * Each system is solved by a team of threads. The scalar products needed by the iterative
+ * solver are computed in the same loops as the vector updates to limit the number of passes
+ * over the vectors. The initial guess is zero and the stopping criterion is a reduction
+ * factor ||Ax-b||/||b||<tol with max_iter maximum iterations.
+ *
+ * @tparam ExecSpace Execution space,needed by Kokkos for allocations and parallelism.
+ * The simplest choice is to follow Kokkos, for that: specify Kokkos::DefaultExecutionSpace
+ * @tparam LinearOperator The type of the operator computing the matrix-vector products.
+ * @tparam Solver Refers to the solver type, default value is the Bicgstab which is more general.
+ * The use of a CG solver is also possible, in this case, please make sure that matrices structure fulfils CG requirements.
+ */
+template <
+        class ExecSpace,
+        class LinearOperator,
+        MatrixBatchMatrixFreeSolver Solver = MatrixBatchMatrixFreeSolver::BICGSTAB>
+class MatrixBatchMatrixFree : public MatrixBatch<ExecSpace>
+{
+public:
+    using typename MatrixBatch<ExecSpace>::BatchedRHS;
+    using MatrixBatch<ExecSpace>::size;
+    using MatrixBatch<ExecSpace>::batch_size;
+
+private:
+    /**
+     * @brief Alias for 2D double Kokkos views, LayoutRight is specified.
+    */
+    using DKokkosView2D
+            = Kokkos::View<double**, Kokkos::LayoutRight, typename ExecSpace::memory_space>;
+
+    LinearOperator m_operator;
+    int m_max_iter;
+    double m_tol;
+
+public:
+    /**
+     * @brief The constructor for MatrixBatchMatrixFree class.
+     *
+     * @param[in] batch_size Number of linear systems to solve.
+     * @param[in] mat_size Common matrix size for all the systems.
+     * @param[in] linear_operator The operator computing the matrix-vector products.
+     * @param[in] max_iter maximal number of iterations for the solver, default mat_size.
+     * @param[in] res_tol relative residual tolerance parameter, to ensure convergence. Default value is set to 1e-15.
+     */
+    explicit MatrixBatchMatrixFree(
+            const int batch_size,
+            const int mat_size,
+            LinearOperator const& linear_operator,
+            std::optional<int> max_iter = std::nullopt,
+            std::optional<double> res_tol = std::nullopt)
+        : MatrixBatch<ExecSpace>(batch_size, mat_size)
+        , m_operator(linear_operator)
+        , m_max_iter(max_iter.value_or(mat_size))
+        , m_tol(res_tol.value_or(1e-15))
+    {
+    }
+
+    /**
+     * @brief Perform a pre-process operation on the solver.
+     *
+     * There is nothing to prepare as the matrices are not stored.
+     */
+    void setup_solver() final {}
+
+    /**
+     * @brief Solve the batched linear problem Ax=b.
+     *
+     * An exception is raised if one of the systems has not converged.
+     *
+     * @param[in, out] b A 2D Kokkos::View storing the batched right-hand sides of the problem and receiving the corresponding solutions.
+     */
+    void solve(BatchedRHS const b) const final
+    {
+        assert(batch_size() == b.extent(0));
+        assert(size() == b.extent(1));
+
+        using TeamPolicy = Kokkos::TeamPolicy<ExecSpace>;
+        using TeamMember = typename TeamPolicy::member_type;
+        using matrix_free_detail::DotProducts;
+
+        int const mat_size = size();
+        int const max_iter = m_max_iter;
+        double const tol = m_tol;
+        LinearOperator const linear_operator = m_operator;
+
+        DKokkosView2D const x("x", batch_size(), size());
+        DKokkosView2D const r("r", batch_size(), size());
+        DKokkosView2D const p("p", batch_size(), size());
+        DKokkosView2D const v("v", batch_size(), size());
+        // Only used by BiCGStab
+        bool constexpr is_bicgstab = Solver == MatrixBatchMatrixFreeSolver::BICGSTAB;
+        DKokkosView2D const r_hat("r_hat", is_bicgstab ? batch_size() : 0, size());
+        DKokkosView2D const t("t", is_bicgstab ? batch_size() : 0, size());
+
+        int n_not_converged = 0;
+        Kokkos::parallel_reduce(
+                is_bicgstab ? "Matrix-free batched BiCGStab" : "Matrix-free batched CG",
+                TeamPolicy(batch_size(), Kokkos::AUTO),
+                KOKKOS_LAMBDA(TeamMember const& team, int& not_converged) {
+                    int const batch_idx = team.league_rank();
+                    auto b_k = Kokkos::subview(b, batch_idx, Kokkos::ALL);
+                    auto x_k = Kokkos::subview(x, batch_idx, Kokkos::ALL);
+                    auto r_k = Kokkos::subview(r, batch_idx, Kokkos::ALL);
+                    auto p_k = Kokkos::subview(p, batch_idx, Kokkos::ALL);
+                    auto v_k = Kokkos::subview(v, batch_idx, Kokkos::ALL);
+
+                    // x = 0, r = p = b
+                    double rr = 0.0;
+                    Kokkos::parallel_reduce(
+                            Kokkos::TeamThreadRange(team, mat_size),
+                            [&](int i, double& sum) {
+                                x_k(i) = 0.0;
+                                r_k(i) = b_k(i);
+                                p_k(i) = b_k(i);
+                                sum += b_k(i) * b_k(i);
+                            },
+                            rr);
+                    double const threshold = tol * tol * rr;
+
+                    if constexpr (Solver == MatrixBatchMatrixFreeSolver::CG) {
+                        for (int iter = 0; iter < max_iter && rr > threshold; ++iter) {
+                            team.team_barrier();
+                            // v = A p with the scalar product (p, v)
+                            double pv = 0.0;
+                            Kokkos::parallel_reduce(
+                                    Kokkos::TeamThreadRange(team, mat_size),
+                                    [&](int i, double& sum) {
+                                        v_k(i) = linear_operator(batch_idx, i, p_k);
+                                        sum += p_k(i) * v_k(i);
+                                    },
+                                    pv);
+                            double const alpha = rr / pv;
+                            // Update x and r with the scalar product (r, r)
+                            double rr_new = 0.0;
+                            Kokkos::parallel_reduce(
+                                    Kokkos::TeamThreadRange(team, mat_size),
+                                    [&](int i, double& sum) {
+                                        x_k(i) += alpha * p_k(i);
+                                        r_k(i) -= alpha * v_k(i);
+                                        sum += r_k(i) * r_k(i);
+                                    },
+                                    rr_new);
+                            double const beta = rr_new / rr;
+                            Kokkos::parallel_for(
+                                    Kokkos::TeamThreadRange(team, mat_size),
+                                    [&](int i) { p_k(i) = r_k(i) + beta * p_k(i); });
+                            rr = rr_new;
+                        }
+                    } else {
+                        auto r_hat_k = Kokkos::subview(r_hat, batch_idx, Kokkos::ALL);
+                        auto t_k = Kokkos::subview(t, batch_idx, Kokkos::ALL);
+                        Kokkos::parallel_for(
+                                Kokkos::TeamThreadRange(team, mat_size),
+                                [&](int i) { r_hat_k(i) = b_k(i); });
+                        double rho = rr;
+                        for (int iter = 0; iter < max_iter && rr > threshold; ++iter) {
+                            team.team_barrier();
+                            // v = A p with the scalar product (r_hat, v)
+                            double r_hat_v = 0.0;
+                            Kokkos::parallel_reduce(
+                                    Kokkos::TeamThreadRange(team, mat_size),
+                                    [&](int i, double& sum) {
+                                        v_k(i) = linear_operator(batch_idx, i, p_k);
+                                        sum += r_hat_k(i) * v_k(i);
+                                    },
+                                    r_hat_v);
+                            double const alpha = rho / r_hat_v;
+                            // s = r - alpha v is stored in r, with the scalar product (s, s)
+                            double ss = 0.0;
+                            Kokkos::parallel_reduce(
+                                    Kokkos::TeamThreadRange(team, mat_size),
+                                    [&](int i, double& sum) {
+                                        r_k(i) -= alpha * v_k(i);
+                                        sum += r_k(i) * r_k(i);
+                                    },
+                                    ss);
+                            if (ss <= threshold) {
+                                Kokkos::parallel_for(
+                                        Kokkos::TeamThreadRange(team, mat_size),
+                                        [&](int i) { x_k(i) += alpha * p_k(i); });
+                                rr = ss;
+                                break;
+                            }
+                            team.team_barrier();
+                            // t = A s with the scalar products (t, s) and (t, t)
+                            DotProducts ts_tt;
+                            Kokkos::parallel_reduce(
+                                    Kokkos::TeamThreadRange(team, mat_size),
+                                    [&](int i, DotProducts& sum) {
+                                        t_k(i) = linear_operator(batch_idx, i, r_k);
+                                        sum.first += t_k(i) * r_k(i);
+                                        sum.second += t_k(i) * t_k(i);
+                                    },
+                                    ts_tt);
+                            double const omega = ts_tt.first / ts_tt.second;
+                            // Update x and r with the scalar products (r_hat, r) and (r, r)
+                            DotProducts rho_rr;
+                            Kokkos::parallel_reduce(
+                                    Kokkos::TeamThreadRange(team, mat_size),
+                                    [&](int i, DotProducts& sum) {
+                                        x_k(i) += alpha * p_k(i) + omega * r_k(i);
+                                        r_k(i) -= omega * t_k(i);
+                                        sum.first += r_hat_k(i) * r_k(i);
+                                        sum.second += r_k(i) * r_k(i);
+                                    },
+                                    rho_rr);
+                            double const beta = (rho_rr.first / rho) * (alpha / omega);
+                            Kokkos::parallel_for(
+                                    Kokkos::TeamThreadRange(team, mat_size),
+                                    [&](int i) {
+                                        p_k(i) = r_k(i) + beta * (p_k(i) - omega * v_k(i));
+                                    });
+                            rho = rho_rr.first;
+                            rr = rho_rr.second;
+                        }
+                    }
+
+                    team.team_barrier();
+                    Kokkos::parallel_for(
+                            Kokkos::TeamThreadRange(team, mat_size),
+                            [&](int i) { b_k(i) = x_k(i); });
+                    Kokkos::single(Kokkos::PerTeam(team), [&]() {
+                        // A NaN residual is not considered as converged
+                        if (!(rr <= threshold)) {
+                            not_converged += 1;
+                        }
+                    });
+                },
+                n_not_converged);
+
+        if (n_not_converged > 0) {
+            throw std::runtime_error(
+                    "The iterative solver did not converge in MatrixBatchMatrixFree");
+        }
+    }
+};
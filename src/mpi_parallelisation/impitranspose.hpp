@@ -34,4 +34,14 @@ public:
      * @param comm The MPI communicator
      */
     explicit IMPITranspose(MPI_Comm comm) : m_comm(comm) {}
+
+    /**
+     * @brief Get the MPI communicator over which the data is transposed.
+     *
+     * @returns The MPI communicator.
+     */
+    MPI_Comm get_comm() const
+    {
+        return m_comm;
+    }
 };
@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <mpi.h>
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "mpitools.hpp"
+#include "region_annotations.hpp"
+
+/**
+ * @brief A class which fills the halo cells of a field distributed along a periodic dimension.
+ *
+ * Each MPI rank owns a contiguous block of the periodic dimension GridDist. The halo-extended
+ * copy of the local data is described on the dimension GridHalo. The index 0 of GridHalo is
+ * associated with the point located halo_width points before the first local point. The
+ * halo cells are received from the neighbouring ranks along GridDist using non-blocking
+ * point-to-point communications. The volume of the communications is therefore proportional
+ * to the surface of the local block rather than to its volume (as would be the case for a
+ * transpose).
+ *
+ * The ranks which own the same index range along all other dimensions form a periodic ring
+ * along GridDist. If only one rank is found along GridDist then it is its own neighbour and
+ * the halo cells are filled with the periodic images of the local data.
+ *
+ * @tparam GridDist The periodic dimension distributed across MPI ranks.
+ * @tparam GridHalo The dimension on which the halo-extended data is described.
+ */
+template <class GridDist, class GridHalo>
+class MPIHaloExchange
+{
+    static int constexpr s_tag_upwards = 0;
+    static int constexpr s_tag_downwards = 1;
+
+    MPI_Comm m_comm;
+    int m_rank_lower;
+    int m_rank_upper;
+    int m_halo_width;
+    IdxRange<GridDist> m_local_idx_range;
+
+public:
+    /**
+     * @brief The index range type of the halo-extended version of a field.
+     * @tparam IdxRangeLocal The index range of the local field.
+     */
+    template <class IdxRangeLocal>
+    using halo_idx_range_type = ddc::replace_dim_of_t<IdxRangeLocal, GridDist, GridHalo>;
+
+public:
+    /**
+     * @brief A constructor for the halo exchange operator.
+     *
+     * This constructor must be called collectively by all ranks of the communicator.
+     *
+     * @param[in] comm The MPI communicator across which the data is distributed.
+     * @param[in] local_idx_range The index range of the data owned by the current rank.
+     * @param[in] halo_width The number of points received from each neighbour.
+     */
+    template <class... Grids>
+    MPIHaloExchange(MPI_Comm comm, IdxRange<Grids...> local_idx_range, int halo_width)
+        : m_halo_width(halo_width)
+        , m_local_idx_range(local_idx_range)
+    {
+        static_assert((std::is_same_v<Grids, GridDist> || ...));
+        if (halo_width < 0 || halo_width > m_local_idx_range.size()) {
+            throw std::runtime_error("The halo must be smaller than the local index range.");
+        }
+
+        // Ranks on the same ring own the same index range along the other dimensions
+        std::array<unsigned long, 2 * sizeof...(Grids)> const ring_key {
+                (std::is_same_v<Grids, GridDist>
+                         ? 0ul
+                         : static_cast<unsigned long>(
+                                 ddc::select<Grids>(local_idx_range).front().uid()))...,
+                (std::is_same_v<Grids, GridDist>
+                         ? 0ul
+                         : static_cast<unsigned long>(
+                                 ddc::select<Grids>(local_idx_range).size()))...};
+        int comm_size;
+        MPI_Comm_size(comm, &comm_size);
+        std::vector<unsigned long> all_ring_keys(ring_key.size() * comm_size);
+        MPI_Allgather(
+                ring_key.data(),
+                ring_key.size(),
+                MPI_type_descriptor_t<unsigned long>,
+                all_ring_keys.data(),
+                ring_key.size(),
+                MPI_type_descriptor_t<unsigned long>,
+                comm);
+        int ring_id = 0;
+        while (!std::equal(
+                ring_key.begin(),
+                ring_key.end(),
+                all_ring_keys.begin() + ring_id * ring_key.size())) {
+            ring_id++;
+        }
+
+        // Ranks are ordered along the ring by the position of their local block
+        MPI_Comm_split(
+                comm,
+                ring_id,
+                static_cast<int>(m_local_idx_range.front().uid()),
+                &m_comm);
+        int ring_size;
+        int ring_rank;
+        MPI_Comm_size(m_comm, &ring_size);
+        MPI_Comm_rank(m_comm, &ring_rank);
+        m_rank_lower = (ring_rank + ring_size - 1) % ring_size;
+        m_rank_upper = (ring_rank + 1) % ring_size;
+    }
+
+    MPIHaloExchange(MPIHaloExchange const& x) = delete;
+
+    MPIHaloExchange& operator=(MPIHaloExchange const& x) = delete;
+
+    ~MPIHaloExchange()
+    {
+        int finalized;
+        MPI_Finalized(&finalized);
+        if (!finalized) {
+            MPI_Comm_free(&m_comm);
+        }
+    }
+
+    /**
+     * @brief Get the number of points received from each neighbour.
+     * @returns The width of the halo.
+     */
+    int get_halo_width() const
+    {
+        return m_halo_width;
+    }
+
+    /**
+     * @brief Get the index range of the halo-extended version of a local field.
+     *
+     * @param[in] local_idx_range The index range of the local field.
+     *
+     * @returns The index range of the halo-extended field.
+     */
+    template <class... Grids>
+    halo_idx_range_type<IdxRange<Grids...>> get_halo_idx_range(
+            IdxRange<Grids...> local_idx_range) const
+    {
+        using IdxRangeBatch = ddc::remove_dims_of_t<IdxRange<Grids...>, GridDist>;
+        IdxRange<GridHalo> const halo_idx_range_dist(
+                Idx<GridHalo>(0),
+                IdxStep<GridHalo>(m_local_idx_range.size() + 2 * m_halo_width));
+        return halo_idx_range_type<IdxRange<Grids...>>(
+                halo_idx_range_dist,
+                IdxRangeBatch(local_idx_range));
+    }
+
+    /**
+     * @brief Copy the local data into a halo-extended field and fill its halo cells with the
+     * data of the neighbouring ranks.
+     *
+     * @param[in] execution_space The execution space (Host/Device) where the code will run.
+     * @param[out] halo_field The halo-extended field defined on the index range returned by
+     *                      get_halo_idx_range.
+     * @param[in] local_field The contiguous local data.
+     */
+    template <class ExecSpace, class ElementType, class MemSpace, class... Grids>
+    void operator()(
+            ExecSpace const& execution_space,
+            Field<ElementType, halo_idx_range_type<IdxRange<Grids...>>, MemSpace> const halo_field,
+            ConstField<ElementType, IdxRange<Grids...>, MemSpace> const local_field) const
+    {
+        static_assert(Kokkos::SpaceAccessibility<ExecSpace, MemSpace>::accessible);
+        using IdxRangeLocal = IdxRange<Grids...>;
+        using IdxRangeHalo = halo_idx_range_type<IdxRangeLocal>;
+        using IdxRangeBatch = ddc::remove_dims_of_t<IdxRangeLocal, GridDist>;
+
+        Kokkos::Profiling::pushRegion("(GSLX) MpiHaloExchange");
+        IdxRangeLocal const local_idx_range = get_idx_range(local_field);
+        IdxRangeBatch const batch_idx_range(local_idx_range);
+        assert(IdxRange<GridDist>(local_idx_range) == m_local_idx_range);
+        assert(get_idx_range(halo_field) == get_halo_idx_range(local_idx_range));
+
+        IdxStep<GridHalo> const halo_width(m_halo_width);
+        IdxRange<GridHalo> const halo_idx_range_dist(get_idx_range(halo_field));
+        IdxRange<GridHalo> const lower_halo = halo_idx_range_dist.take_first(halo_width);
+        IdxRange<GridHalo> const upper_halo = halo_idx_range_dist.take_last(halo_width);
+        IdxRange<GridHalo> const interior
+                = halo_idx_range_dist.remove_first(halo_width).remove_last(halo_width);
+
+        // The local data described with the indices of the halo-extended field
+        ConstField<ElementType, IdxRangeHalo, MemSpace> const local_field_on_halo(
+                local_field.data_handle(),
+                IdxRangeHalo(interior, batch_idx_range));
+
+        IdxRangeHalo const lower_slab_idx_range(lower_halo, batch_idx_range);
+        IdxRangeHalo const upper_slab_idx_range(upper_halo, batch_idx_range);
+        FieldMem<ElementType, IdxRangeHalo, MemSpace> send_lower_alloc(
+                "send_lower (MPIHaloExchange::operator())",
+                lower_slab_idx_range);
+        FieldMem<ElementType, IdxRangeHalo, MemSpace> send_upper_alloc(
+                "send_upper (MPIHaloExchange::operator())",
+                upper_slab_idx_range);
+        FieldMem<ElementType, IdxRangeHalo, MemSpace> recv_lower_alloc(
+                "recv_lower (MPIHaloExchange::operator())",
+                lower_slab_idx_range);
+        FieldMem<ElementType, IdxRangeHalo, MemSpace> recv_upper_alloc(
+                "recv_upper (MPIHaloExchange::operator())",
+                upper_slab_idx_range);
+        annotate_region_bytes(4 * send_lower_alloc.size() * sizeof(ElementType));
+
+        // Pack the first and last local points into contiguous buffers
+        ddc::parallel_deepcopy(
+                execution_space,
+                get_field(send_lower_alloc),
+                local_field_on_halo[interior.take_first(halo_width)]);
+        ddc::parallel_deepcopy(
+                execution_space,
+                get_field(send_upper_alloc),
+                local_field_on_halo[interior.take_last(halo_width)]);
+        execution_space.fence("fencing before mpi halo exchange");
+
+        int const n_elems = send_lower_alloc.size();
+        std::array<MPI_Request, 4> requests;
+        MPI_Irecv(
+                recv_lower_alloc.data_handle(),
+                n_elems,
+                MPI_type_descriptor_t<ElementType>,
+                m_rank_lower,
+                s_tag_upwards,
+                m_comm,
+                &requests[0]);
+        MPI_Irecv(
+                recv_upper_alloc.data_handle(),
+                n_elems,
+                MPI_type_descriptor_t<ElementType>,
+                m_rank_upper,
+                s_tag_downwards,
+                m_comm,
+                &requests[1]);
+        MPI_Isend(
+                send_upper_alloc.data_handle(),
+                n_elems,
+                MPI_type_descriptor_t<ElementType>,
+                m_rank_upper,
+                s_tag_upwards,
+                m_comm,
+                &requests[2]);
+        MPI_Isend(
+                send_lower_alloc.data_handle(),
+                n_elems,
+                MPI_type_descriptor_t<ElementType>,
+                m_rank_lower,
+                s_tag_downwards,
+                m_comm,
+                &requests[3]);
+
+        // The copy of the interior overlaps with the communications
+        ddc::parallel_deepcopy(execution_space, halo_field[interior], local_field_on_halo);
+
+        MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+        ddc::parallel_deepcopy(
+                execution_space,
+                halo_field[lower_halo],
+                get_const_field(recv_lower_alloc));
+        ddc::parallel_deepcopy(
+                execution_space,
+                halo_field[upper_halo],
+                get_const_field(recv_upper_alloc));
+        execution_space.fence("fencing after mpi halo exchange");
+        Kokkos::Profiling::popRegion();
+    }
+};
@@ -33,6 +33,15 @@ struct MPITypeDescriptor<double>
     }
 };
 
+template <>
+struct MPITypeDescriptor<float>
+{
+    static MPI_Datatype get_type() noexcept
+    {
+        return MPI_FLOAT;
+    }
+};
+
 template <>
 struct MPITypeDescriptor<unsigned long>
 {
@@ -10,6 +10,7 @@
 #include "impitranspose.hpp"
 #include "mpilayout.hpp"
 #include "mpitools.hpp"
+#include "region_annotations.hpp"
 #include "transpose.hpp"
 
 /**
@@ -140,6 +141,7 @@ public:
             ConstField<ElementType, InIdxRange, MemSpace> send_field) const
     {
         Kokkos::Profiling::pushRegion("(GSLX) MpiTranspose");
+        annotate_region_bytes((send_field.size() + recv_field.size()) * sizeof(ElementType));
         static_assert(!std::is_same_v<InIdxRange, IdxRangeOut>);
         static_assert(
                 (std::is_same_v<InIdxRange, typename Layout1::discrete_domain_type>)
@@ -8,6 +8,7 @@
 #include "edge.hpp"
 #include "edge_transformation.hpp"
 #include "geometry_descriptors.hpp"
+#include "single_interface_derivatives_weights.hpp"
 #include "types.hpp"
 
 
@@ -134,6 +135,10 @@ private:
     host_t<DField<IdxRange1DPerp_1>> m_weights_patch_1;
     host_t<DField<IdxRange1DPerp_2>> m_weights_patch_2;
 
+    // Copies of the weights on device. The weight at the interface is set to zero on patch 2.
+    DFieldMem<IdxRange1DPerp_1> m_weights_patch_1_device_alloc;
+    DFieldMem<IdxRange1DPerp_2> m_weights_patch_2_device_alloc;
+
 public:
     /**
      * @brief Instantiate SingleInterfaceDerivativesCalculator. 
@@ -183,6 +188,14 @@ public:
                   m_idx_range_perp_2)
         , m_weights_patch_1(m_weights_patch_1_alloc)
         , m_weights_patch_2(m_weights_patch_2_alloc)
+        , m_weights_patch_1_device_alloc(
+                  "m_weights_patch_1_device "
+                  "(SingleInterfaceDerivativesCalculator::SingleInterfaceDerivativesCalculator)",
+                  m_idx_range_perp_1)
+        , m_weights_patch_2_device_alloc(
+                  "m_weights_patch_2_device "
+                  "(SingleInterfaceDerivativesCalculator::SingleInterfaceDerivativesCalculator)",
+                  m_idx_range_perp_2)
     {
         assert(Bound1 != ddc::BoundCond::PERIODIC);
         assert(Bound2 != ddc::BoundCond::PERIODIC);
@@ -228,6 +241,8 @@ public:
         } else {
             set_coefficients_non_uniform_case();
         }
+
+        copy_weights_to_device();
     }
 
 
@@ -416,8 +431,94 @@ public:
         return get_function_coefficients(function_1, function_2);
     }
 
+    /**
+     * @brief Get a device-copyable view on the weights @f$\omega_k@f$ stored on device.
+     *
+     * The returned object can be captured in a KOKKOS_LAMBDA to compute the linear
+     * combination of the function values (c) inside a kernel.
+     *
+     * @return The weights stored on device.
+     */
+    SingleInterfaceDerivativesWeights<InterfaceType> get_weights() const
+    {
+        return SingleInterfaceDerivativesWeights<InterfaceType>(
+                get_const_field(m_weights_patch_1_device_alloc),
+                get_const_field(m_weights_patch_2_device_alloc));
+    }
+
+    /**
+     * @brief Get the linear combination of the function values (c) for every
+     * index along the interface.
+     *
+     * The coefficients are computed on device in a single kernel batched over the
+     * grid parallel to the interface. The meshes are assumed to be conforming
+     * along the interface.
+     *
+     * @param[in] exec_space The execution space where the kernel is launched.
+     * @param[out] coefficients The linear combination of the function values (c)
+     *          at each index of the parallel grid of the patch 1.
+     * @param[in] function_1 Function values at the interpolation points on patch 1.
+     * @param[in] function_2 Function values at the interpolation points on patch 2.
+     */
+    template <class ExecSpace, class Layout1, class Layout2>
+    void get_function_coefficients(
+            ExecSpace const& exec_space,
+            DField<IdxRange1DPar_1, typename ExecSpace::memory_space> const& coefficients,
+            DConstField<IdxRange2D_1, typename ExecSpace::memory_space, Layout1> const& function_1,
+            DConstField<IdxRange2D_2, typename ExecSpace::memory_space, Layout2> const& function_2)
+            const
+    {
+        static_assert(
+                Kokkos::SpaceAccessibility<
+                        ExecSpace,
+                        typename SingleInterfaceDerivativesWeights<
+                                InterfaceType>::memory_space>::accessible,
+                "The weights are not accessible from the given execution space.");
+
+        IdxRange1DPar_1 const idx_range_par_1 = get_idx_range(coefficients);
+        IdxRange1DPar_2 const idx_range_par_2(get_idx_range(function_2));
+        assert(idx_range_par_1.size() == idx_range_par_2.size());
+
+        SingleInterfaceDerivativesWeights<InterfaceType> const weights = get_weights();
+        ddc::parallel_for_each(
+                "get_function_coefficients (SingleInterfaceDerivativesCalculator)",
+                exec_space,
+                idx_range_par_1,
+                KOKKOS_LAMBDA(Idx<EdgeParGrid1> const idx_par_1) {
+                    Idx<EdgeParGrid2> const idx_par_2 = SingleInterfaceDerivativesWeights<
+                            InterfaceType>::
+                            get_equivalent_idx_on_patch_2(
+                                    idx_par_1,
+                                    idx_range_par_1,
+                                    idx_range_par_2);
+                    coefficients(idx_par_1) = weights.get_function_coefficients(
+                            function_1[idx_par_1],
+                            function_2[idx_par_2]);
+                });
+    }
+
 
 private:
+    /**
+     * @brief Copy the weights computed on host to device. The weight at the interface
+     * is only kept on the patch 1.
+     */
+    void copy_weights_to_device()
+    {
+        host_t<DFieldMem<IdxRange1DPerp_2>> weights_2_without_interface_alloc(m_idx_range_perp_2);
+        host_t<DField<IdxRange1DPerp_2>> weights_2_without_interface
+                = get_field(weights_2_without_interface_alloc);
+        ddc::parallel_deepcopy(weights_2_without_interface, get_const_field(m_weights_patch_2));
+        weights_2_without_interface(get_extremity_idx(m_extremity_2, m_idx_range_perp_2)) = 0.0;
+
+        ddc::parallel_deepcopy(
+                get_field(m_weights_patch_1_device_alloc),
+                get_const_field(m_weights_patch_1));
+        ddc::parallel_deepcopy(
+                get_field(m_weights_patch_2_device_alloc),
+                get_const_field(weights_2_without_interface));
+    }
+
     template <typename BSplinesPerp, typename GridBreakPt, typename EdgePerpGrid>
     void check_break_points_are_interpolation_points(
             bool const is_cell_bound_with_extra_interpol_pt,
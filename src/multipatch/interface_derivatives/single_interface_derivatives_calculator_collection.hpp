@@ -4,7 +4,10 @@
 
 #include <ddc/ddc.hpp>
 
+#include "multipatch_field.hpp"
 #include "single_interface_derivatives_calculator.hpp"
+#include "single_interface_derivatives_weights.hpp"
+#include "types.hpp"
 
 template <class T>
 inline constexpr bool enable_single_derivative_calculator_collection = false;
@@ -75,6 +78,129 @@ public:
         return std::get<SingleInterfaceDerivativesCalculator<Interface> const&>(
                 m_derivative_calculator_collection);
     }
+
+    /**
+     * @brief Get the linear combination of the function values (c) for every index
+     * along every interface of the collection.
+     *
+     * All the interfaces and all the indices along the interfaces are treated in a
+     * single kernel. The weights used are the ones precomputed on device by the
+     * interface derivative calculators. The meshes are assumed to be conforming
+     * along the interfaces.
+     *
+     * @param[in] exec_space The execution space where the kernel is launched.
+     * @param[out] coefficients The linear combination of the function values (c) for each
+     *          interface, defined on the parallel grid of the first patch of the interface.
+     *          The fields are given in the same order as the interfaces of the collection.
+     * @param[in] functions The function values at the interpolation points on every patch.
+     */
+    template <class ExecSpace, class... Patches>
+    void get_function_coefficients(
+            ExecSpace const& exec_space,
+            std::tuple<DField<
+                    IdxRange<typename Interfaces::Edge1::parallel_grid>,
+                    typename ExecSpace::memory_space>...> const& coefficients,
+            MultipatchField<DConstFieldOnPatch, Patches...> const& functions) const
+    {
+        static_assert(
+                Kokkos::SpaceAccessibility<ExecSpace, Kokkos::DefaultExecutionSpace::memory_space>::
+                        accessible,
+                "The weights are not accessible from the given execution space.");
+
+        std::tuple<SingleInterfaceDerivativesWeights<Interfaces>...> const weights(
+                this->template get<Interfaces>().get_weights()...);
+
+        // Position of the first index of each interface in the flattened iteration space.
+        Kokkos::Array<std::size_t, n_interfaces + 1> const offsets
+                = get_offsets(std::make_index_sequence<n_interfaces>(), coefficients);
+
+        Kokkos::parallel_for(
+                "get_function_coefficients (SingleInterfaceDerivativesCalculatorCollection)",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 0, offsets[n_interfaces]),
+                KOKKOS_LAMBDA(std::size_t const flat_idx) {
+                    set_function_coefficients(
+                            std::make_index_sequence<n_interfaces>(),
+                            flat_idx,
+                            offsets,
+                            coefficients,
+                            weights,
+                            functions);
+                });
+    }
+
+private:
+    static constexpr std::size_t n_interfaces = sizeof...(Interfaces);
+
+    /**
+     * @brief Get the position of the first index of each interface in the flattened
+     * iteration space over all interfaces. The last element is the total size.
+     */
+    template <std::size_t... I, class CoeffsTuple>
+    static Kokkos::Array<std::size_t, n_interfaces + 1> get_offsets(
+            std::index_sequence<I...>,
+            CoeffsTuple const& coefficients)
+    {
+        Kokkos::Array<std::size_t, n_interfaces + 1> offsets;
+        offsets[0] = 0;
+        ((offsets[I + 1] = offsets[I] + get_idx_range(std::get<I>(coefficients)).size()), ...);
+        return offsets;
+    }
+
+    /**
+     * @brief Compute the coefficient (c) at the position flat_idx of the flattened
+     * iteration space over all interfaces.
+     */
+    template <std::size_t... I, class CoeffsTuple, class WeightsTuple, class Functions>
+    KOKKOS_FUNCTION static void set_function_coefficients(
+            std::index_sequence<I...>,
+            std::size_t const flat_idx,
+            Kokkos::Array<std::size_t, n_interfaces + 1> const& offsets,
+            CoeffsTuple const& coefficients,
+            WeightsTuple const& weights,
+            Functions const& functions)
+    {
+        ((((offsets[I] <= flat_idx) && (flat_idx < offsets[I + 1]))
+                  ? set_function_coefficient_on_interface(
+                          std::get<I>(coefficients),
+                          std::get<I>(weights),
+                          functions,
+                          flat_idx - offsets[I])
+                  : void()),
+         ...);
+    }
+
+    /**
+     * @brief Compute the coefficient (c) at the i-th index along a given interface.
+     */
+    template <class Interface, class Functions>
+    KOKKOS_FUNCTION static void set_function_coefficient_on_interface(
+            DField<IdxRange<typename Interface::Edge1::parallel_grid>,
+                   typename Functions::memory_space> const& coefficients,
+            SingleInterfaceDerivativesWeights<Interface> const& weights,
+            Functions const& functions,
+            std::size_t const i)
+    {
+        using Patch1 = typename Interface::Edge1::associated_patch;
+        using Patch2 = typename Interface::Edge2::associated_patch;
+        using EdgeParGrid1 = typename Interface::Edge1::parallel_grid;
+        using EdgeParGrid2 = typename Interface::Edge2::parallel_grid;
+
+        DConstFieldOnPatch<Patch1> const function_1 = functions.template get<Patch1>();
+        DConstFieldOnPatch<Patch2> const function_2 = functions.template get<Patch2>();
+
+        IdxRange<EdgeParGrid1> const idx_range_par_1 = get_idx_range(coefficients);
+        IdxRange<EdgeParGrid2> const idx_range_par_2(get_idx_range(function_2));
+
+        Idx<EdgeParGrid1> const idx_par_1 = idx_range_par_1.front() + IdxStep<EdgeParGrid1>(i);
+        Idx<EdgeParGrid2> const idx_par_2
+                = SingleInterfaceDerivativesWeights<Interface>::get_equivalent_idx_on_patch_2(
+                        idx_par_1,
+                        idx_range_par_1,
+                        idx_range_par_2);
+
+        coefficients(idx_par_1)
+                = weights.get_function_coefficients(function_1[idx_par_1], function_2[idx_par_2]);
+    }
 };
 
 
@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_aliases.hpp"
+#include "edge.hpp"
+
+/**
+ * @brief A device-copyable view on the weights @f$ \omega_k @f$ computed by a
+ * SingleInterfaceDerivativesCalculator.
+ *
+ * This class does not own any memory. It only stores constant fields pointing to the
+ * weights saved on device in the SingleInterfaceDerivativesCalculator. It can therefore
+ * be captured in a KOKKOS_LAMBDA to compute the linear combination of the function
+ * values (c) inside a kernel.
+ *
+ * The weight associated with the interpolation point on the interface is only stored
+ * on the patch 1. On the patch 2, this weight is set to zero to avoid counting twice
+ * the value at the interface.
+ *
+ * @tparam InterfaceType The interface between two patches where we want
+ * to compute the derivatives.
+ *
+ * @see SingleInterfaceDerivativesCalculator
+ */
+template <class InterfaceType>
+class SingleInterfaceDerivativesWeights
+{
+    using EdgePerpGrid1 = typename InterfaceType::Edge1::perpendicular_grid;
+    using EdgePerpGrid2 = typename InterfaceType::Edge2::perpendicular_grid;
+
+    using EdgeParGrid1 = typename InterfaceType::Edge1::parallel_grid;
+    using EdgeParGrid2 = typename InterfaceType::Edge2::parallel_grid;
+
+    using IdxRange1DPerp_1 = IdxRange<EdgePerpGrid1>;
+    using IdxRange1DPerp_2 = IdxRange<EdgePerpGrid2>;
+
+public:
+    /// @brief Interface between the two involved patches.
+    using associated_interface = InterfaceType;
+
+    /// @brief The memory space where the weights are saved.
+    using memory_space = Kokkos::DefaultExecutionSpace::memory_space;
+
+private:
+    DConstField<IdxRange1DPerp_1, memory_space> m_weights_patch_1;
+    DConstField<IdxRange1DPerp_2, memory_space> m_weights_patch_2;
+
+public:
+    /**
+     * @brief Instantiate a SingleInterfaceDerivativesWeights.
+     *
+     * @param weights_patch_1 The weights in front of the function values on the patch 1.
+     * @param weights_patch_2 The weights in front of the function values on the patch 2.
+     *          The weight at the interface is expected to be zero.
+     */
+    KOKKOS_FUNCTION SingleInterfaceDerivativesWeights(
+            DConstField<IdxRange1DPerp_1, memory_space> weights_patch_1,
+            DConstField<IdxRange1DPerp_2, memory_space> weights_patch_2)
+        : m_weights_patch_1(weights_patch_1)
+        , m_weights_patch_2(weights_patch_2)
+    {
+    }
+
+    /**
+     * @brief Get the linear combination of the function values (c) for a single
+     * line perpendicular to the interface.
+     *
+     * @param function_1 Function values at the interpolation points on patch 1.
+     * @param function_2 Function values at the interpolation points on patch 2.
+     * @return the linear combination of the function values (c).
+     */
+    template <class Layout1, class Layout2>
+    KOKKOS_FUNCTION double get_function_coefficients(
+            DConstField<IdxRange1DPerp_1, memory_space, Layout1> const& function_1,
+            DConstField<IdxRange1DPerp_2, memory_space, Layout2> const& function_2) const
+    {
+        double coeff_values = 0.0;
+        for (Idx<EdgePerpGrid1> const idx : get_idx_range(m_weights_patch_1)) {
+            coeff_values += function_1(idx) * m_weights_patch_1(idx);
+        }
+        for (Idx<EdgePerpGrid2> const idx : get_idx_range(m_weights_patch_2)) {
+            coeff_values += function_2(idx) * m_weights_patch_2(idx);
+        }
+        return coeff_values;
+    }
+
+    /**
+     * @brief Get the index on the parallel grid of the patch 2 which is located at the
+     * same position on the interface as the given index on the parallel grid of the patch 1.
+     *
+     * The meshes are assumed to be conforming along the interface.
+     *
+     * @param idx_par_1 An index on the parallel grid of the patch 1.
+     * @param idx_range_par_1 The index range of the parallel grid of the patch 1.
+     * @param idx_range_par_2 The index range of the parallel grid of the patch 2.
+     * @return The equivalent index on the parallel grid of the patch 2.
+     */
+    KOKKOS_FUNCTION static Idx<EdgeParGrid2> get_equivalent_idx_on_patch_2(
+            Idx<EdgeParGrid1> const& idx_par_1,
+            IdxRange<EdgeParGrid1> const& idx_range_par_1,
+            IdxRange<EdgeParGrid2> const& idx_range_par_2)
+    {
+        IdxStep<EdgeParGrid2> const shift((idx_par_1 - idx_range_par_1.front()).value());
+        if constexpr (InterfaceType::orientations_agree) {
+            return idx_range_par_2.front() + shift;
+        } else {
+            return idx_range_par_2.back() - shift;
+        }
+    }
+};
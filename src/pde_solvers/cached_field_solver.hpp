@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <cstddef>
+#include <optional>
+
+#include <ddc/ddc.hpp>
+
+#include "buffer_version.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "vector_field_common.hpp"
+
+/**
+ * @brief A field solver which does not repeat a solve if its source has not changed.
+ *
+ * The class wraps a solver computing the electrostatic potential and the electric field from
+ * a source (e.g. IQNSolver which takes the distribution function, or FFTPoissonSolver which
+ * takes the charge density). The modifications of one source buffer are tracked by a
+ * BufferVersion. The results computed from this buffer are stored and, if the solver is called
+ * again on the same buffer before its version changes, they are copied into the output fields
+ * instead of solving the equation again. Sources stored in other buffers are always solved.
+ *
+ * @tparam FieldSolver The type of the wrapped solver.
+ * @tparam PotentialFieldMem The type of the memory block where the potential is stored.
+ * @tparam ElectricFieldMem The type of the memory block where the electric field is stored.
+ */
+template <class FieldSolver, class PotentialFieldMem, class ElectricFieldMem>
+class CachedFieldSolver
+{
+    FieldSolver const& m_field_solver;
+
+    BufferVersion const& m_source_version;
+
+    // The stored results are not part of the observable state of the solver
+    mutable PotentialFieldMem m_potential;
+
+    mutable ElectricFieldMem m_electric_field;
+
+    // The version of the source from which the stored results were computed
+    mutable std::optional<std::size_t> m_cached_version;
+
+public:
+    /**
+     * @brief Create a cached field solver.
+     *
+     * @param[in] field_solver The solver called when the results are not stored.
+     * @param[in] source_version The version counter of the tracked source buffer.
+     * @param[in] idx_range The index range on which the potential and the electric field are
+     *                      defined.
+     */
+    template <class IdxRangeType>
+    CachedFieldSolver(
+            FieldSolver const& field_solver,
+            BufferVersion const& source_version,
+            IdxRangeType idx_range)
+        : m_field_solver(field_solver)
+        , m_source_version(source_version)
+        , m_potential("potential (CachedFieldSolver::CachedFieldSolver())", idx_range)
+        , m_electric_field("electric_field (CachedFieldSolver::CachedFieldSolver())", idx_range)
+    {
+    }
+
+    CachedFieldSolver(CachedFieldSolver const& x) = delete;
+
+    CachedFieldSolver& operator=(CachedFieldSolver const& x) = delete;
+
+    ~CachedFieldSolver() = default;
+
+    /**
+     * @brief Compute the potential and the electric field from the source.
+     *
+     * @param[out] potential The electrostatic potential.
+     * @param[out] electric_field The electric field.
+     * @param[in] source The source passed to the wrapped solver.
+     */
+    template <class PotentialField, class ElectricField, class SourceField>
+    void operator()(PotentialField potential, ElectricField electric_field, SourceField source)
+            const
+    {
+        bool const is_tracked = m_source_version.tracks(source.data_handle());
+        if (is_tracked && m_cached_version == m_source_version.get()) {
+            copy(potential, get_const_field(m_potential));
+            copy(electric_field, get_const_field(m_electric_field));
+            return;
+        }
+        m_field_solver(potential, electric_field, source);
+        if (is_tracked) {
+            copy(get_field(m_potential), get_const_field(potential));
+            copy(get_field(m_electric_field), get_const_field(electric_field));
+            m_cached_version = m_source_version.get();
+        }
+    }
+
+private:
+    template <class FieldDst, class FieldSrc>
+    static void copy(FieldDst dst, FieldSrc src)
+    {
+        if constexpr (is_vector_field_v<FieldDst>) {
+            ddcHelper::deepcopy(dst, src);
+        } else {
+            ddc::parallel_deepcopy(dst, src);
+        }
+    }
+};
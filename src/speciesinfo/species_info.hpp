@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <cmath>
+
 #include <ddc/ddc.hpp>
 
 #include "ddc_alias_inline_functions.hpp"
@@ -47,6 +49,18 @@ public:
         // workaround to access masses on the device
         DConstField<index_range_type, MemorySpace> m_mass_view;
 
+        // square root of the ratio between the electron mass and the mass of the particles
+        DFieldMem<index_range_type, MemorySpace> m_sqrt_me_on_mass;
+
+        // ratio between the charge and the mass of the particles
+        DFieldMem<index_range_type, MemorySpace> m_charge_on_mass;
+
+        // workaround to access the mass ratios on the device
+        DConstField<index_range_type, MemorySpace> m_sqrt_me_on_mass_view;
+
+        // workaround to access the charge on mass ratios on the device
+        DConstField<index_range_type, MemorySpace> m_charge_on_mass_view;
+
         discrete_element_type m_ielec;
 
     public:
@@ -61,12 +75,18 @@ public:
         explicit Impl(Impl<Grid1D, OMemorySpace> const& impl)
             : m_charge(get_idx_range(impl.m_charge))
             , m_mass(get_idx_range(impl.m_mass))
+            , m_sqrt_me_on_mass(get_idx_range(impl.m_sqrt_me_on_mass))
+            , m_charge_on_mass(get_idx_range(impl.m_charge_on_mass))
             , m_ielec(impl.m_ielec)
         {
             m_charge_view = get_const_field(m_charge);
             m_mass_view = get_const_field(m_mass);
+            m_sqrt_me_on_mass_view = get_const_field(m_sqrt_me_on_mass);
+            m_charge_on_mass_view = get_const_field(m_charge_on_mass);
             ddc::parallel_deepcopy(m_charge, impl.m_charge);
             ddc::parallel_deepcopy(m_mass, impl.m_mass);
+            ddc::parallel_deepcopy(m_sqrt_me_on_mass, impl.m_sqrt_me_on_mass);
+            ddc::parallel_deepcopy(m_charge_on_mass, impl.m_charge_on_mass);
         }
 
         /**
@@ -78,6 +98,8 @@ public:
              DFieldMem<index_range_type, MemorySpace> mass)
             : m_charge(std::move(charge))
             , m_mass(std::move(mass))
+            , m_sqrt_me_on_mass(get_idx_range(m_mass))
+            , m_charge_on_mass(get_idx_range(m_mass))
         {
             m_charge_view = get_const_field(m_charge);
             m_mass_view = get_const_field(m_mass);
@@ -92,6 +114,13 @@ public:
             if (!electron_found) {
                 throw std::runtime_error("electron not found");
             }
+            // The ratios are computed once so they can be read in the kernels
+            for (discrete_element_type const isp : get_idx_range(m_mass)) {
+                m_sqrt_me_on_mass(isp) = std::sqrt(m_mass(m_ielec) / m_mass(isp));
+                m_charge_on_mass(isp) = m_charge(isp) / m_mass(isp);
+            }
+            m_sqrt_me_on_mass_view = get_const_field(m_sqrt_me_on_mass);
+            m_charge_on_mass_view = get_const_field(m_charge_on_mass);
         }
 
         /// @return the discrete element representing the electron species
@@ -118,6 +147,25 @@ public:
             return m_mass_view(isp);
         }
 
+        /**
+         * @param[in] isp a discrete element of either a kinetic or adiabatic species
+         * @return the square root of the ratio between the electron mass and the mass
+         *         associated to the discrete element
+         */
+        KOKKOS_FUNCTION double sqrt_me_on_mass(discrete_element_type const isp) const
+        {
+            return m_sqrt_me_on_mass_view(isp);
+        }
+
+        /**
+         * @param[in] isp a discrete element of either a kinetic or adiabatic species
+         * @return the ratio between the charge and the mass associated to the discrete element
+         */
+        KOKKOS_FUNCTION double charge_on_mass(discrete_element_type const isp) const
+        {
+            return m_charge_on_mass_view(isp);
+        }
+
         /// @return kinetic and adiabatic charges array
         auto charges() const
         {
@@ -165,6 +213,25 @@ KOKKOS_INLINE_FUNCTION double mass(Idx<Species> const isp)
     return ddc::discrete_space<Species>().mass(isp);
 }
 
+/**
+ * @param[in] isp a discrete element of either a kinetic or adiabatic species
+ * @return the square root of the ratio between the electron mass and the mass
+ *         associated to the discrete element
+ */
+KOKKOS_INLINE_FUNCTION double sqrt_me_on_mass(Idx<Species> const isp)
+{
+    return ddc::discrete_space<Species>().sqrt_me_on_mass(isp);
+}
+
+/**
+ * @param[in] isp a discrete element of either a kinetic or adiabatic species
+ * @return the ratio between the charge and the mass associated to the discrete element
+ */
+KOKKOS_INLINE_FUNCTION double charge_on_mass(Idx<Species> const isp)
+{
+    return ddc::discrete_space<Species>().charge_on_mass(isp);
+}
+
 using IdxSp = Idx<Species>;
 using IdxRangeSp = IdxRange<Species>;
 using IdxStepSp = IdxStep<Species>;
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_aliases.hpp"
+
+/**
+ * @brief A class which chooses the time step of a simulation from a CFL condition.
+ *
+ * The time step is chosen so that the maximum displacement of the characteristics
+ * during one time step does not exceed a given fraction (the CFL number) of a cell:
+ * @f$ dt = C / \max(|A|/\Delta x) @f$
+ * where @f$ A @f$ is the advection field and @f$ \Delta x @f$ the cell width. The
+ * time step is then bounded by the user-defined minimum and maximum values.
+ *
+ * The simulation is divided into output intervals. The time step is reduced
+ * so that each output interval is split into steps of equal size. The output
+ * times are therefore reached exactly. If the remaining time in an output interval
+ * is smaller than the minimum time step then the minimum is not respected.
+ */
+class CFLTimeStepController
+{
+private:
+    double m_cfl;
+    double m_dt_min;
+    double m_dt_max;
+    double m_output_period;
+
+public:
+    /**
+     * @brief Create a CFLTimeStepController.
+     *
+     * @param[in] cfl The maximum fraction of a cell crossed by the characteristics in one time step.
+     * @param[in] dt_min The smallest time step allowed.
+     * @param[in] dt_max The largest time step allowed.
+     * @param[in] output_period The time between two outputs.
+     */
+    CFLTimeStepController(double cfl, double dt_min, double dt_max, double output_period)
+        : m_cfl(cfl)
+        , m_dt_min(dt_min)
+        , m_dt_max(dt_max)
+        , m_output_period(output_period)
+    {
+        assert(cfl > 0);
+        assert(dt_min > 0);
+        assert(dt_min <= dt_max);
+        assert(output_period > 0);
+    }
+
+    /**
+     * @brief Get the time between two outputs.
+     *
+     * @return The output period.
+     */
+    double get_output_period() const
+    {
+        return m_output_period;
+    }
+
+    /**
+     * @brief Choose the next time step.
+     *
+     * @param[in] max_displacement_rate The maximum over the grid of the number of cells crossed
+     *              by the characteristics per unit of time (@f$ \max(|A|/\Delta x) @f$).
+     * @param[in] time_to_output The time remaining until the next output.
+     *
+     * @return The time step. If this is the last step before the output then the returned
+     *          value is exactly equal to time_to_output.
+     */
+    double get_time_step(double max_displacement_rate, double time_to_output) const
+    {
+        double dt = m_dt_max;
+        if (max_displacement_rate > 0) {
+            dt = std::clamp(m_cfl / max_displacement_rate, m_dt_min, m_dt_max);
+        }
+        // Allow for the rounding errors accumulated while advancing through the interval
+        double const n_steps = std::ceil(time_to_output / dt * (1.0 - 1e-12));
+        if (n_steps <= 1) {
+            return time_to_output;
+        }
+        return time_to_output / n_steps;
+    }
+};
+
+/**
+ * @brief Get the smallest distance between two consecutive points of an index range.
+ *
+ * @param[in] idx_range The index range.
+ *
+ * @return The smallest cell width.
+ */
+template <class Grid1D>
+double min_cell_width(IdxRange<Grid1D> idx_range)
+{
+    double width = std::numeric_limits<double>::max();
+    for (Idx<Grid1D> const idx : idx_range.remove_last(IdxStep<Grid1D>(1))) {
+        width = std::min(width, double(ddc::coordinate(idx + 1) - ddc::coordinate(idx)));
+    }
+    return width;
+}
@@ -1,5 +1,11 @@
 // SPDX-License-Identifier: MIT
 #pragma once
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <memory>
+#include <vector>
 
 #include "ddc_alias_inline_functions.hpp"
 #include "ddc_aliases.hpp"
@@ -9,6 +15,194 @@
 #include "multipatch_math_tools.hpp"
 #include "vector_field_common.hpp"
 
+/// @cond
+namespace timestepper_detail {
+
+/**
+ * Calculate the scalar product of two scalar derivatives.
+ *
+ * @param[in] a The first derivative.
+ * @param[in] b The second derivative.
+ * @return The product.
+ */
+KOKKOS_INLINE_FUNCTION double element_dot(double const a, double const b)
+{
+    return a * b;
+}
+
+/**
+ * Calculate the scalar product of two vector derivatives on an orthonormal coordinate system.
+ *
+ * @param[in] a The first derivative.
+ * @param[in] b The second derivative.
+ * @return The sum of the products of the components.
+ */
+template <class... Tags>
+KOKKOS_FUNCTION double element_dot(DVector<Tags...> const& a, DVector<Tags...> const& b)
+{
+    return ((ddcHelper::get<Tags>(a) * ddcHelper::get<Tags>(b)) + ...);
+}
+
+template <class ExecSpace, class DerivFieldType>
+struct reduce_helper;
+
+template <class ExecSpace, class ElementType, class IdxRangeType, class MemSpace>
+struct reduce_helper<ExecSpace, FieldMem<ElementType, IdxRangeType, MemSpace>>
+{
+    static_assert(std::is_floating_point_v<ElementType>);
+
+    using DerivFieldType = Field<ElementType, IdxRangeType, MemSpace>;
+    using DerivConstFieldType = ConstField<ElementType, IdxRangeType, MemSpace>;
+
+    /**
+     * Calculate the scalar product of two fields.
+     * This function should be private but is public due to Cuda restrictions.
+     *
+     * @param[in] exec_space The space (CPU/GPU) where the calculation should be executed.
+     * @param[in] a The first field.
+     * @param[in] b The second field.
+     * @return The sum over the index range of the products of the elements.
+     */
+    static double dot(ExecSpace const& exec_space, DerivConstFieldType a, DerivConstFieldType b)
+    {
+        using Idx = typename IdxRangeType::discrete_element_type;
+        const std::source_location location = std::source_location::current();
+        return ddc::parallel_transform_reduce(
+                location.function_name(),
+                exec_space,
+                get_idx_range(a),
+                0.0,
+                ddc::reducer::sum<double>(),
+                KOKKOS_LAMBDA(Idx const i) { return a(i) * b(i); });
+    }
+
+    /**
+     * Calculate the residual k_new - k and its infinity norm in a single pass.
+     * This function should be private but is public due to Cuda restrictions.
+     *
+     * @param[in] exec_space The space (CPU/GPU) where the calculation should be executed.
+     * @param[out] residual The field to be filled with the residual.
+     * @param[in] k_new The derivative calculated from the current iterate.
+     * @param[in] k The derivative used to calculate the current iterate.
+     * @return The infinity norm of the residual.
+     */
+    static double residual_norm_inf(
+            ExecSpace const& exec_space,
+            DerivFieldType residual,
+            DerivConstFieldType k_new,
+            DerivConstFieldType k)
+    {
+        using Idx = typename IdxRangeType::discrete_element_type;
+        const std::source_location location = std::source_location::current();
+        return ddc::parallel_transform_reduce(
+                location.function_name(),
+                exec_space,
+                get_idx_range(residual),
+                0.0,
+                ddc::reducer::max<double>(),
+                KOKKOS_LAMBDA(Idx const i) {
+                    residual(i) = k_new(i) - k(i);
+                    return Kokkos::fabs(residual(i));
+                });
+    }
+};
+
+template <class ExecSpace, class ElementType, class IdxRangeType, class... Dims, class MemSpace>
+struct reduce_helper<
+        ExecSpace,
+        VectorFieldMem<ElementType, IdxRangeType, VectorIndexSet<Dims...>, MemSpace>>
+{
+    using DerivFieldType
+            = VectorField<ElementType, IdxRangeType, VectorIndexSet<Dims...>, MemSpace>;
+    using DerivConstFieldType
+            = VectorConstField<ElementType, IdxRangeType, VectorIndexSet<Dims...>, MemSpace>;
+    using component_helper
+            = reduce_helper<ExecSpace, FieldMem<ElementType, IdxRangeType, MemSpace>>;
+
+    /**
+     * Calculate the scalar product of two vector fields.
+     *
+     * @param[in] exec_space The space (CPU/GPU) where the calculation should be executed.
+     * @param[in] a The first vector field.
+     * @param[in] b The second vector field.
+     * @return The sum over the index range of the scalar products of the elements.
+     */
+    static double dot(ExecSpace const& exec_space, DerivConstFieldType a, DerivConstFieldType b)
+    {
+        return (component_helper::dot(exec_space, ddcHelper::get<Dims>(a), ddcHelper::get<Dims>(b))
+                + ...);
+    }
+
+    /**
+     * Calculate the residual k_new - k and its infinity norm in a single pass for each component.
+     *
+     * @param[in] exec_space The space (CPU/GPU) where the calculation should be executed.
+     * @param[out] residual The vector field to be filled with the residual.
+     * @param[in] k_new The derivative calculated from the current iterate.
+     * @param[in] k The derivative used to calculate the current iterate.
+     * @return The infinity norm of the residual.
+     */
+    static double residual_norm_inf(
+            ExecSpace const& exec_space,
+            DerivFieldType residual,
+            DerivConstFieldType k_new,
+            DerivConstFieldType k)
+    {
+        return std::max({component_helper::residual_norm_inf(
+                exec_space,
+                ddcHelper::get<Dims>(residual),
+                ddcHelper::get<Dims>(k_new),
+                ddcHelper::get<Dims>(k))...});
+    }
+};
+
+template <class ExecSpace, template <typename P> typename T, class... Patches>
+struct reduce_helper<ExecSpace, MultipatchFieldMem<T, Patches...>>
+{
+    using DerivFieldType = typename MultipatchFieldMem<T, Patches...>::span_type;
+    using DerivConstFieldType = typename MultipatchFieldMem<T, Patches...>::view_type;
+
+    /**
+     * Calculate the scalar product of two MultipatchFields.
+     *
+     * @param[in] exec_space The space (CPU/GPU) where the calculation should be executed.
+     * @param[in] a The first field.
+     * @param[in] b The second field.
+     * @return The sum over all the patches of the scalar products.
+     */
+    static double dot(ExecSpace const& exec_space, DerivConstFieldType a, DerivConstFieldType b)
+    {
+        return (reduce_helper<ExecSpace, T<Patches>>::
+                        dot(exec_space, a.template get<Patches>(), b.template get<Patches>())
+                + ...);
+    }
+
+    /**
+     * Calculate the residual k_new - k and its infinity norm over all the patches.
+     *
+     * @param[in] exec_space The space (CPU/GPU) where the calculation should be executed.
+     * @param[out] residual The field to be filled with the residual.
+     * @param[in] k_new The derivative calculated from the current iterate.
+     * @param[in] k The derivative used to calculate the current iterate.
+     * @return The infinity norm of the residual.
+     */
+    static double residual_norm_inf(
+            ExecSpace const& exec_space,
+            DerivFieldType residual,
+            DerivConstFieldType k_new,
+            DerivConstFieldType k)
+    {
+        return std::max({reduce_helper<ExecSpace, T<Patches>>::residual_norm_inf(
+                exec_space,
+                residual.template get<Patches>(),
+                k_new.template get<Patches>(),
+                k.template get<Patches>())...});
+    }
+};
+
+} // namespace timestepper_detail
+/// @endcond
+
 
 /**
  * @brief A class which provides an implementation of a Crank-Nicolson method.
@@ -24,7 +218,12 @@
  * @f$ y^{k} =  y^{n} + \frac{dt}{2} \left(f(t^{n}, y^{n}) + f(t^{k}, y^{k}) \right)@f$.
  *
  * The method is an implicit method.
- * If @f$ |y^{k+1} -  y^{k}| < \varepsilon @f$, then we set @f$ y^{n+1} = y^{k+1} @f$.
+ * If @f$ |y^{k+1} -  y^{k}| < \varepsilon |y^{k}| @f$, then we set @f$ y^{n+1} = y^{k+1} @f$.
+ *
+ * If an Anderson depth m > 0 is provided, the iteration is carried out on the derivative
+ * @f$ k = f(t^{k}, y^{k}) @f$ and accelerated with the Anderson method using the previous
+ * iteration only (m = 1) so that no memory is required. The iteration then stops when
+ * @f$ \frac{dt}{2} |k^{j+1} -  k^{j}| < \varepsilon |y^{n}| @f$.
  *
  * The method is order 2.
  *
@@ -48,6 +247,7 @@ public:
 private:
     int const m_max_counter;
     double const m_epsilon;
+    int const m_anderson_depth;
 
 public:
     /**
@@ -55,13 +255,24 @@ public:
      * @param[in] counter
      *      The maximal number of loops for the implicit method.
      * @param[in] epsilon
-     *      The @f$ \varepsilon @f$ upperbound of the difference of two steps
-     *      in the implicit method: @f$ |y^{k+1} -  y^{k}| < \varepsilon @f$.
+     *      The @f$ \varepsilon @f$ upperbound of the relative difference of two steps
+     *      in the implicit method: @f$ |y^{k+1} -  y^{k}| < \varepsilon |y^{k}| @f$.
+     *      With the Anderson acceleration the iteration stops when
+     *      @f$ \frac{dt}{2} |k^{j+1} -  k^{j}| < \varepsilon |y^{n}| @f$.
+     * @param[in] anderson_depth
+     *      If it is positive, the implicit method is accelerated with the Anderson method
+     *      using the previous iteration only, whatever the value (no history can be stored
+     *      in a device function). If it is 0, the plain fixed point iteration is used.
      */
-    explicit CrankNicolson(int const counter = int(20), double const epsilon = 1e-12)
+    explicit CrankNicolson(
+            int const counter = int(20),
+            double const epsilon = 1e-12,
+            int const anderson_depth = 0)
         : m_max_counter(counter)
         , m_epsilon(epsilon)
+        , m_anderson_depth(anderson_depth)
     {
+        assert(anderson_depth >= 0);
     }
 
     /**
@@ -89,6 +300,11 @@ public:
             = timestepper_detail::serial_y_update<ValType&, DerivType const&>) const
     {
         static_assert(std::is_invocable_v<DYFunctor, DerivType&, ValType>);
+        if (m_anderson_depth > 0) {
+            update_anderson(y, dt, dy_calculator, y_update);
+            return;
+        }
+
         ValType y_init;
         ValType y_old;
         DerivType k1;
@@ -128,6 +344,94 @@ public:
 
         } while (not_converged and (counter < m_max_counter));
     }
+
+private:
+    /**
+     * @brief Carry out one step of the Crank-Nicolson scheme on a scalar, solving the
+     * implicit equation with an iteration on the derivative accelerated with the Anderson
+     * method using the previous iteration.
+     *
+     * @param[inout] y
+     *     The value(s) which should be evolved over time.
+     * @param[in] dt
+     *     The time step over which the values should be evolved.
+     * @param[in] dy_calculator
+     *     The function describing how the derivative of the evolve function is calculated.
+     * @param[in] y_update
+     *     The function describing how the value(s) are updated using the derivative.
+     */
+    template <class DYFunctor, class YFunctor>
+    KOKKOS_FUNCTION void update_anderson(
+            ValType& y,
+            double dt,
+            DYFunctor dy_calculator,
+            YFunctor y_update) const
+    {
+        ValType y_init;
+        DerivType k1;
+        DerivType k;
+        DerivType k_new;
+        DerivType k_new_prev;
+        DerivType k_total;
+        DerivType residual;
+        DerivType residual_prev;
+
+        // Save initial conditions
+        timestepper_detail::copy_helper<ValType>::copy(y_init, y);
+        double const y_norm = norm_inf(y_init);
+        // The tolerance is absolute if the initial value is 0
+        double const tolerance = m_epsilon * (y_norm > 0 ? y_norm : 1.0);
+
+        // --------- Calculate k1 ------------
+        // Calculate k1 = f(y_n)
+        dy_calculator(k1, y);
+
+        // The first guess for f(y_{n+1}) is f(y_n)
+        timestepper_detail::copy_helper<DerivType>::copy(k, k1);
+
+        // -------- Calculate k_new ----------
+        bool not_converged = true;
+        int counter = 0;
+        do {
+            counter++;
+
+            // Calculate y_new := y_n + h/2*(k_1 + k)
+            k_total = k1 + k;
+            timestepper_detail::copy_helper<ValType>::copy(y, y_init);
+            y_update(y, k_total, 0.5 * dt);
+
+            // Calculate k_new = f(y_new)
+            dy_calculator(k_new, y);
+
+            // Check convergence
+            residual = k_new - k;
+            not_converged = (0.5 * dt * norm_inf(residual)) >= tolerance;
+
+            if (not_converged and (counter < m_max_counter)) {
+                timestepper_detail::copy_helper<DerivType>::copy(k, k_new);
+                if (counter > 1) {
+                    // Minimise |residual - gamma * (residual - residual_prev)|
+                    DerivType const delta_residual = residual - residual_prev;
+                    double const delta_norm2
+                            = timestepper_detail::element_dot(delta_residual, delta_residual);
+                    if (delta_norm2 > 0) {
+                        double const gamma
+                                = timestepper_detail::element_dot(delta_residual, residual)
+                                  / delta_norm2;
+                        k = k_new - (k_new - k_new_prev) * gamma;
+                    }
+                }
+                timestepper_detail::copy_helper<DerivType>::copy(residual_prev, residual);
+                timestepper_detail::copy_helper<DerivType>::copy(k_new_prev, k_new);
+            }
+
+        } while (not_converged and (counter < m_max_counter));
+
+        // Calculate y_{n+1} := y_n + h/2*(k_1 + k_new) with the last calculated derivative
+        k_total = k1 + k_new;
+        timestepper_detail::copy_helper<ValType>::copy(y, y_init);
+        y_update(y, k_total, 0.5 * dt);
+    }
 };
 
 /**
@@ -145,8 +449,21 @@ public:
  * the Crank-Nicolson method is given by :
  * @f$ y^{k} =  y^{n} + \frac{dt}{2} \left(f(t^{n}, y^{n}) + f(t^{k}, y^{k}) \right)@f$.
  *
- * The method is an implicit method.
- * If @f$ |y^{k+1} -  y^{k}| < \varepsilon @f$, then we set @f$ y^{n+1} = y^{k+1} @f$.
+ * The method is an implicit method. The implicit equation is solved with a fixed point
+ * iteration. If @f$ |y^{k+1} -  y^{k}| < \varepsilon |y^{k}| @f$, then we set
+ * @f$ y^{n+1} = y^{k+1} @f$.
+ *
+ * If a history depth m > 0 is provided, the iteration is carried out on the derivative
+ * @f$ k = f(t^{k}, y^{k}) @f$ and accelerated with the Anderson method. The next iterate is
+ * a combination of the m previous evaluations of f which minimises the L2 norm of the
+ * combined residual. This requires the derivative to contain floating point elements. It is
+ * useful when @f$ dt |\partial_y f| @f$ is close to 2 where the fixed point iteration
+ * converges slowly or diverges. The first guess is @f$ f(t^{n}, y^{n}) @f$ and the iteration
+ * stops when @f$ \frac{dt}{2} |k^{j+1} -  k^{j}| < \varepsilon |y^{n}| @f$ (or
+ * @f$ \varepsilon @f$ if @f$ y^{n} = 0 @f$).
+ *
+ * The buffers (including the history) are allocated once at the start of each update, so
+ * that the iterations do not allocate memory and the object can be shared.
  *
  * The method is order 2.
  *
@@ -173,6 +490,24 @@ private:
     IdxRange const m_idx_range;
     int const m_max_counter;
     double const m_epsilon;
+    int const m_anderson_depth;
+
+    /**
+     * The history of the Anderson acceleration. It is allocated at the start of an update.
+     */
+    struct AndersonHistory
+    {
+        /// The differences between the residuals of two successive iterations.
+        std::vector<std::unique_ptr<DerivFieldMem>> delta_residual_allocs;
+        /// The differences between the derivatives of two successive iterations.
+        std::vector<std::unique_ptr<DerivFieldMem>> delta_k_new_allocs;
+        /// The Gram matrix of the residual differences, stored with a stride equal to the depth.
+        std::vector<double> gram;
+        /// A copy of the Gram matrix which is modified by the Gaussian elimination.
+        std::vector<double> system;
+        /// The right hand side and then the solution of the least squares problem.
+        std::vector<double> coefs;
+    };
 
 public:
     using base_type::update;
@@ -185,17 +520,25 @@ public:
      * @param[in] counter
      *      The maximal number of loops for the implicit method.
      * @param[in] epsilon
-     *      The @f$ \varepsilon @f$ upperbound of the difference of two steps
-     *      in the implicit method: @f$ |y^{k+1} -  y^{k}| < \varepsilon @f$.
+     *      The @f$ \varepsilon @f$ upperbound of the relative difference of two steps
+     *      in the implicit method: @f$ |y^{k+1} -  y^{k}| < \varepsilon |y^{k}| @f$.
+     *      With the Anderson acceleration the iteration stops when
+     *      @f$ \frac{dt}{2} |k^{j+1} -  k^{j}| < \varepsilon |y^{n}| @f$.
+     * @param[in] anderson_depth
+     *      The number m of previous iterations used by the Anderson acceleration.
+     *      If it is 0, the plain fixed point iteration is used.
      */
     explicit CrankNicolson(
             IdxRange idx_range,
             int const counter = int(20),
-            double const epsilon = 1e-12)
+            double const epsilon = 1e-12,
+            int const anderson_depth = 0)
         : m_idx_range(idx_range)
         , m_max_counter(counter)
         , m_epsilon(epsilon)
+        , m_anderson_depth(anderson_depth)
     {
+        assert(anderson_depth >= 0);
     }
 
     /**
@@ -219,6 +562,37 @@ public:
             double dt,
             std::function<void(DerivField, ValConstField)> dy_calculator,
             std::function<void(ValField, DerivConstField, double)> y_update) const final
+    {
+        if (m_anderson_depth == 0) {
+            update_fixed_point(exec_space, y, dt, dy_calculator, y_update);
+        } else {
+            update_anderson(exec_space, y, dt, dy_calculator, y_update);
+        }
+    }
+
+    /**
+     * @brief Carry out one step of the Crank-Nicolson scheme solving the implicit equation
+     * with a fixed point iteration.
+     * This function should be private but is public due to Cuda restrictions.
+     *
+     * @param[in] exec_space
+     *     The space on which the function is executed (CPU/GPU).
+     * @param[inout] y
+     *     The value(s) which should be evolved over time defined on each of the dimensions at each point
+     *     of the index range.
+     * @param[in] dt
+     *     The time step over which the values should be evolved.
+     * @param[in] dy_calculator
+     *     The function describing how the derivative of the evolve function is calculated.
+     * @param[in] y_update
+     *     The function describing how the value(s) are updated using the derivative.
+     */
+    void update_fixed_point(
+            ExecSpace const& exec_space,
+            ValField y,
+            double dt,
+            std::function<void(DerivField, ValConstField)> const& dy_calculator,
+            std::function<void(ValField, DerivConstField, double)> const& y_update) const
     {
         using element_type = typename timestepper_detail::ElementType<DerivField>::type;
 
@@ -277,6 +651,338 @@ public:
 
         } while (not_converged and (counter < m_max_counter));
     }
+
+    /**
+     * @brief Carry out one step of the Crank-Nicolson scheme solving the implicit equation
+     * with an iteration on the derivative accelerated with the Anderson method.
+     * This function should be private but is public due to Cuda restrictions.
+     *
+     * @param[in] exec_space
+     *     The space on which the function is executed (CPU/GPU).
+     * @param[inout] y
+     *     The value(s) which should be evolved over time defined on each of the dimensions at each point
+     *     of the index range.
+     * @param[in] dt
+     *     The time step over which the values should be evolved.
+     * @param[in] dy_calculator
+     *     The function describing how the derivative of the evolve function is calculated.
+     * @param[in] y_update
+     *     The function describing how the value(s) are updated using the derivative.
+     */
+    void update_anderson(
+            ExecSpace const& exec_space,
+            ValField y,
+            double dt,
+            std::function<void(DerivField, ValConstField)> const& dy_calculator,
+            std::function<void(ValField, DerivConstField, double)> const& y_update) const
+    {
+        using element_type = typename timestepper_detail::ElementType<DerivField>::type;
+
+        FieldMem y_init_alloc("y_init (CrankNicholson::update)", m_idx_range);
+        DerivFieldMem k1_alloc("k1 (CrankNicholson::update)", m_idx_range);
+        DerivFieldMem k_alloc("k (CrankNicholson::update)", m_idx_range);
+        DerivFieldMem k_total_alloc("k_total (CrankNicholson::update)", m_idx_range);
+        // The residual and the derivative of the current and of the previous iteration
+        // alternate between the two buffers of each array.
+        std::array<DerivFieldMem, 2> k_new_allocs {
+                DerivFieldMem("k_new (CrankNicholson::update)", m_idx_range),
+                DerivFieldMem("k_new (CrankNicholson::update)", m_idx_range)};
+        std::array<DerivFieldMem, 2> residual_allocs {
+                DerivFieldMem("residual (CrankNicholson::update)", m_idx_range),
+                DerivFieldMem("residual (CrankNicholson::update)", m_idx_range)};
+        AndersonHistory history;
+        history.gram.resize(m_anderson_depth * m_anderson_depth);
+        history.system.resize(m_anderson_depth * m_anderson_depth);
+        history.coefs.resize(m_anderson_depth);
+        for (int i(0); i < m_anderson_depth; ++i) {
+            history.delta_residual_allocs.push_back(std::make_unique<DerivFieldMem>(
+                    "delta_residual (CrankNicholson::update)",
+                    m_idx_range));
+            history.delta_k_new_allocs.push_back(std::make_unique<DerivFieldMem>(
+                    "delta_k_new (CrankNicholson::update)",
+                    m_idx_range));
+        }
+
+        ValField y_init = get_field(y_init_alloc);
+        DerivField k1 = get_field(k1_alloc);
+        DerivField k = get_field(k_alloc);
+        DerivField k_total = get_field(k_total_alloc);
+
+        // Save initial conditions
+        timestepper_detail::copy_helper<FieldMem>::copy(y_init, get_const_field(y));
+        double const y_norm = norm_inf(exec_space, get_const_field(y_init));
+        // The tolerance is absolute if the initial value is 0
+        double const tolerance = m_epsilon * (y_norm > 0 ? y_norm : 1.0);
+
+        // --------- Calculate k1 ------------
+        // Calculate k1 = f(y_n)
+        dy_calculator(k1, get_const_field(y));
+
+        // The first guess for f(y_{n+1}) is f(y_n)
+        timestepper_detail::copy_helper<DerivFieldMem>::copy(k, get_const_field(k1));
+
+        // -------- Calculate k_new ----------
+        bool not_converged = true;
+        int counter = 0;
+        int n_updates = 0;
+        int n_history = 0;
+        do {
+            counter++;
+
+            // The derivative of the previous iteration is kept for the history
+            DerivField k_new = get_field(k_new_allocs[counter % 2]);
+
+            // Calculation of step
+            // k_total = k1 + k
+            timestepper_detail::assemble_helper<ExecSpace, DerivFieldMem>::assemble_k_total(
+                    exec_space,
+                    k_total,
+                    KOKKOS_LAMBDA(std::array<element_type, 2> k_arr) {
+                        return k_arr[0] + k_arr[1];
+                    },
+                    k1,
+                    k);
+
+            // Re-initialise the characteristic feet
+            timestepper_detail::copy_helper<FieldMem>::copy(y, get_const_field(y_init));
+
+            // Calculate y_new := y_n + h/2*(k_1 + k)
+            y_update(y, get_const_field(k_total), 0.5 * dt);
+
+            // Calculate k_new = f(y_new)
+            dy_calculator(k_new, get_const_field(y));
+
+            // Check convergence
+            DerivField residual = get_field(residual_allocs[counter % 2]);
+            double const residual_norm
+                    = timestepper_detail::reduce_helper<ExecSpace, DerivFieldMem>::
+                            residual_norm_inf(
+                                    exec_space,
+                                    residual,
+                                    get_const_field(k_new),
+                                    get_const_field(k));
+            not_converged = (0.5 * dt * residual_norm) >= tolerance;
+
+            if (not_converged and (counter < m_max_counter)) {
+                DerivField k_new_prev = get_field(k_new_allocs[(counter + 1) % 2]);
+                DerivField residual_prev = get_field(residual_allocs[(counter + 1) % 2]);
+                if (counter > 1) {
+                    n_history = add_anderson_history(
+                            exec_space,
+                            history,
+                            n_updates % m_anderson_depth,
+                            n_history,
+                            residual,
+                            residual_prev,
+                            k_new,
+                            k_new_prev);
+                    n_updates++;
+                }
+                if (!anderson_mixing(exec_space, history, n_history, k, k_new, residual)) {
+                    // The history is degenerate so the iteration is restarted
+                    n_updates = 0;
+                    n_history = 0;
+                }
+            }
+
+        } while (not_converged and (counter < m_max_counter));
+
+        // Calculate y_{n+1} := y_n + h/2*(k_1 + k_new) with the last calculated derivative
+        DerivField k_new = get_field(k_new_allocs[counter % 2]);
+        timestepper_detail::assemble_helper<ExecSpace, DerivFieldMem>::assemble_k_total(
+                exec_space,
+                k_total,
+                KOKKOS_LAMBDA(std::array<element_type, 2> k_arr) { return k_arr[0] + k_arr[1]; },
+                k1,
+                k_new);
+        timestepper_detail::copy_helper<FieldMem>::copy(y, get_const_field(y_init));
+        y_update(y, get_const_field(k_total), 0.5 * dt);
+    }
+
+    /**
+     * @brief Save the differences between two successive iterations in the history of the
+     * Anderson acceleration and update the Gram matrix.
+     * This function should be private but is public due to Cuda restrictions.
+     *
+     * @param[in] exec_space
+     *     The space on which the function is executed (CPU/GPU).
+     * @param[inout] history
+     *     The history of the Anderson acceleration.
+     * @param[in] slot
+     *     The index of the history entry which is overwritten.
+     * @param[in] n_history
+     *     The number of entries in the history before the call.
+     * @param[in] residual
+     *     The residual of the current iteration.
+     * @param[in] residual_prev
+     *     The residual of the previous iteration.
+     * @param[in] k_new
+     *     The derivative calculated in the current iteration.
+     * @param[in] k_new_prev
+     *     The derivative calculated in the previous iteration.
+     *
+     * @return The number of entries in the history after the call.
+     */
+    int add_anderson_history(
+            ExecSpace const& exec_space,
+            AndersonHistory& history,
+            int const slot,
+            int const n_history,
+            DerivField residual,
+            DerivField residual_prev,
+            DerivField k_new,
+            DerivField k_new_prev) const
+    {
+        using element_type = typename timestepper_detail::ElementType<DerivField>::type;
+        using reduce_helper = timestepper_detail::reduce_helper<ExecSpace, DerivFieldMem>;
+
+        DerivField delta_residual = get_field(*history.delta_residual_allocs[slot]);
+        DerivField delta_k_new = get_field(*history.delta_k_new_allocs[slot]);
+        timestepper_detail::assemble_helper<ExecSpace, DerivFieldMem>::assemble_k_total(
+                exec_space,
+                delta_residual,
+                KOKKOS_LAMBDA(std::array<element_type, 2> k_arr) { return k_arr[0] - k_arr[1]; },
+                residual,
+                residual_prev);
+        timestepper_detail::assemble_helper<ExecSpace, DerivFieldMem>::assemble_k_total(
+                exec_space,
+                delta_k_new,
+                KOKKOS_LAMBDA(std::array<element_type, 2> k_arr) { return k_arr[0] - k_arr[1]; },
+                k_new,
+                k_new_prev);
+
+        int const n_history_new = std::min(n_history + 1, m_anderson_depth);
+        for (int i(0); i < n_history_new; ++i) {
+            double const gram_elem = reduce_helper::dot(
+                    exec_space,
+                    get_const_field(delta_residual),
+                    get_const_field(*history.delta_residual_allocs[i]));
+            history.gram[slot * m_anderson_depth + i] = gram_elem;
+            history.gram[i * m_anderson_depth + slot] = gram_elem;
+        }
+        return n_history_new;
+    }
+
+    /**
+     * @brief Calculate the derivative used in the next iteration with the Anderson method:
+     * @f$ k = k_{new} - \sum_i \gamma_i \Delta k_{new,i} @f$ where @f$ \gamma @f$ minimises
+     * @f$ |r - \sum_i \gamma_i \Delta r_i|_2 @f$.
+     * This function should be private but is public due to Cuda restrictions.
+     *
+     * @param[in] exec_space
+     *     The space on which the function is executed (CPU/GPU).
+     * @param[inout] history
+     *     The history of the Anderson acceleration.
+     * @param[in] n_history
+     *     The number of entries in the history.
+     * @param[out] k
+     *     The derivative used in the next iteration.
+     * @param[in] k_new
+     *     The derivative calculated in the current iteration.
+     * @param[in] residual
+     *     The residual of the current iteration.
+     *
+     * @return False if the least squares problem is degenerate. In this case k = k_new.
+     */
+    bool anderson_mixing(
+            ExecSpace const& exec_space,
+            AndersonHistory& history,
+            int const n_history,
+            DerivField k,
+            DerivField k_new,
+            DerivField residual) const
+    {
+        using element_type = typename timestepper_detail::ElementType<DerivField>::type;
+        using reduce_helper = timestepper_detail::reduce_helper<ExecSpace, DerivFieldMem>;
+
+        for (int i(0); i < n_history; ++i) {
+            history.coefs[i] = reduce_helper::
+                    dot(exec_space,
+                        get_const_field(*history.delta_residual_allocs[i]),
+                        get_const_field(residual));
+        }
+        bool const success = solve_anderson_system(history, n_history);
+
+        timestepper_detail::copy_helper<DerivFieldMem>::copy(k, get_const_field(k_new));
+        if (success) {
+            for (int i(0); i < n_history; ++i) {
+                double const coef = history.coefs[i];
+                timestepper_detail::assemble_helper<ExecSpace, DerivFieldMem>::assemble_k_total(
+                        exec_space,
+                        k,
+                        KOKKOS_LAMBDA(std::array<element_type, 2> k_arr) {
+                            return k_arr[0] - coef * k_arr[1];
+                        },
+                        k,
+                        get_field(*history.delta_k_new_allocs[i]));
+            }
+        }
+        return success;
+    }
+
+private:
+    /**
+     * @brief Solve the normal equations of the least squares problem of the Anderson method.
+     * The right hand side is read from history.coefs and the solution is saved in
+     * history.coefs.
+     *
+     * @param[inout] history The history of the Anderson acceleration.
+     * @param[in] n_history The number of entries in the history.
+     *
+     * @return False if the Gram matrix is singular.
+     */
+    bool solve_anderson_system(AndersonHistory& history, int const n_history) const
+    {
+        std::vector<double> const& gram = history.gram;
+        std::vector<double>& system = history.system;
+        std::vector<double>& coefs = history.coefs;
+        int const n = n_history;
+        int const stride = m_anderson_depth;
+        double max_diag = 0.0;
+        for (int i(0); i < n; ++i) {
+            max_diag = std::max(max_diag, gram[i * stride + i]);
+            for (int j(0); j < n; ++j) {
+                system[i * stride + j] = gram[i * stride + j];
+            }
+        }
+        if (n > 0 && max_diag == 0.0) {
+            return false;
+        }
+
+        // Gaussian elimination with partial pivoting
+        for (int col(0); col < n; ++col) {
+            int pivot = col;
+            for (int row(col + 1); row < n; ++row) {
+                if (std::abs(system[row * stride + col])
+                    > std::abs(system[pivot * stride + col])) {
+                    pivot = row;
+                }
+            }
+            if (std::abs(system[pivot * stride + col]) <= 1e-14 * max_diag) {
+                return false;
+            }
+            if (pivot != col) {
+                for (int j(0); j < n; ++j) {
+                    std::swap(system[col * stride + j], system[pivot * stride + j]);
+                }
+                std::swap(coefs[col], coefs[pivot]);
+            }
+            for (int row(col + 1); row < n; ++row) {
+                double const factor = system[row * stride + col] / system[col * stride + col];
+                for (int j(col); j < n; ++j) {
+                    system[row * stride + j] -= factor * system[col * stride + j];
+                }
+                coefs[row] -= factor * coefs[col];
+            }
+        }
+        for (int row(n - 1); row >= 0; --row) {
+            for (int j(row + 1); j < n; ++j) {
+                coefs[row] -= system[row * stride + j] * coefs[j];
+            }
+            coefs[row] /= system[row * stride + row];
+        }
+        return true;
+    }
 };
 
 /**
@@ -291,6 +997,7 @@ class CrankNicolsonBuilder
 private:
     int const m_max_counter;
     double const m_epsilon;
+    int const m_anderson_depth;
 
 public:
     /**
@@ -298,12 +1005,23 @@ public:
      * @param[in] counter
      *      The maximal number of loops for the implicit method.
      * @param[in] epsilon
-     *      The @f$ \varepsilon @f$ upperbound of the difference of two steps
-     *      in the implicit method: @f$ |y^{k+1} -  y^{k}| < \varepsilon @f$.
+     *      The @f$ \varepsilon @f$ upperbound of the relative difference of two steps
+     *      in the implicit method: @f$ |y^{k+1} -  y^{k}| < \varepsilon |y^{k}| @f$.
+     *      With the Anderson acceleration the iteration stops when
+     *      @f$ \frac{dt}{2} |k^{j+1} -  k^{j}| < \varepsilon |y^{n}| @f$.
+     * @param[in] anderson_depth
+     *      The number of previous iterations used by the Anderson acceleration of the
+     *      implicit method. For scalar types any positive value uses the previous iteration
+     *      only.
+     *      If it is 0, the plain fixed point iteration is used.
      */
-    explicit CrankNicolsonBuilder(int const counter = 20, double const epsilon = 1e-12)
+    explicit CrankNicolsonBuilder(
+            int const counter = 20,
+            double const epsilon = 1e-12,
+            int const anderson_depth = 0)
         : m_max_counter(counter)
         , m_epsilon(epsilon)
+        , m_anderson_depth(anderson_depth)
     {
     }
 
@@ -331,7 +1049,7 @@ public:
                               typename TimeStepper::ValFieldMem,
                               typename TimeStepper::DerivFieldMem,
                               typename TimeStepper::exec_space>>);
-        return TimeStepper(idx_range, m_max_counter, m_epsilon);
+        return TimeStepper(idx_range, m_max_counter, m_epsilon, m_anderson_depth);
     }
 
     /**
@@ -350,7 +1068,7 @@ public:
                               typename TimeStepper::ValFieldMem,
                               typename TimeStepper::DerivFieldMem,
                               typename TimeStepper::exec_space>>);
-        return TimeStepper(m_max_counter, m_epsilon);
+        return TimeStepper(m_max_counter, m_epsilon, m_anderson_depth);
     }
 };
 
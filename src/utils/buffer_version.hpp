@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <cstddef>
+
+/**
+ * @brief A counter identifying the successive states of the data stored in a buffer.
+ *
+ * The code which owns the buffer increments the version each time it modifies the data.
+ * Operators which store results computed from the buffer (see CachedFieldSolver) compare
+ * the versions to determine whether these results are still valid. The counter is not
+ * incremented automatically so it can only be used for buffers whose modifications are
+ * all known to their owner.
+ */
+class BufferVersion
+{
+    void const* m_data_handle;
+
+    std::size_t m_version;
+
+public:
+    /**
+     * @brief Start tracking the modifications of the buffer of a field.
+     *
+     * @param[in] field A field whose data is stored in the tracked buffer.
+     */
+    template <class FieldType>
+    explicit BufferVersion(FieldType const& field)
+        : m_data_handle(field.data_handle())
+        , m_version(0)
+    {
+    }
+
+    /**
+     * @brief Indicate that the data stored in the buffer has been modified.
+     */
+    void increment()
+    {
+        ++m_version;
+    }
+
+    /**
+     * @brief Get the current version of the data stored in the buffer.
+     * @return The number of modifications since the creation of the counter.
+     */
+    std::size_t get() const
+    {
+        return m_version;
+    }
+
+    /**
+     * @brief Check if a pointer refers to the tracked buffer.
+     *
+     * @param[in] data_handle The pointer to the data of a field.
+     * @return True if the field is stored in the tracked buffer.
+     */
+    bool tracks(void const* data_handle) const
+    {
+        return data_handle == m_data_handle;
+    }
+};
@@ -180,6 +180,40 @@ inline void dump_coordinates(
             KOKKOS_LAMBDA(Idx<Grid1D> i) { dump_coord(i) = ddc::coordinate(i); });
 }
 
+/**
+ * @brief Copy the values of a field into a field with a different element type.
+ *
+ * This is notably useful to change the precision in which a field is stored.
+ * Both fields must be defined on the same index range.
+ *
+ * @param[in] exec_space The execution space on which the code will run.
+ * @param[out] dst The field which will contain the converted values.
+ * @param[in] src The field whose values are copied.
+ */
+template <
+        class ExecSpace,
+        class ElementTypeDst,
+        class ElementTypeSrc,
+        class IdxRangeType,
+        class MemorySpace,
+        class LayoutDst,
+        class LayoutSrc>
+inline void convert_deepcopy(
+        ExecSpace exec_space,
+        Field<ElementTypeDst, IdxRangeType, MemorySpace, LayoutDst> dst,
+        ConstField<ElementTypeSrc, IdxRangeType, MemorySpace, LayoutSrc> src)
+{
+    static_assert(Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible);
+    assert(dst.domain() == src.domain());
+    using IdxType = typename IdxRangeType::discrete_element_type;
+    const std::source_location location = std::source_location::current();
+    ddc::parallel_for_each(
+            location.function_name(),
+            exec_space,
+            dst.domain(),
+            KOKKOS_LAMBDA(IdxType const idx) { dst(idx) = static_cast<ElementTypeDst>(src(idx)); });
+}
+
 /**
  * @brief Computes the maximum distance between two adjacent points 
  * within an IdxRange.
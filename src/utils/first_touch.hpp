@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <cstddef>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc_aliases.hpp"
+
+/**
+ * @brief Write to every element of a freshly allocated field in parallel so that its memory
+ * pages are placed close to the threads which use them.
+ *
+ * DDC does not initialise the memory of a FieldMem. On a multi-socket CPU node the memory
+ * pages are therefore mapped on the NUMA node of the thread which writes to them first. If
+ * this first write is carried out by a single thread (e.g. by an MPI call) then all the
+ * pages are mapped on one socket and the kernels running on the other socket use remote
+ * accesses. This function writes zeros to the field with a static decomposition of the
+ * contiguous memory between the threads. This is the decomposition used by the kernels
+ * which iterate over the outermost dimensions of the field with ddc::parallel_for_each.
+ *
+ * Nothing is done if the memory is not accessible from the host (e.g. GPU memory).
+ *
+ * @param[in] execution_space The execution space which will run the kernels using the field.
+ * @param[out] field The contiguous field to be initialised.
+ */
+template <class ExecSpace, class ElementType, class IdxRangeType, class MemSpace>
+void first_touch(
+        ExecSpace const& execution_space,
+        Field<ElementType, IdxRangeType, MemSpace> const field)
+{
+    static_assert(Kokkos::SpaceAccessibility<ExecSpace, MemSpace>::accessible);
+    if constexpr (Kokkos::SpaceAccessibility<Kokkos::HostSpace, MemSpace>::accessible) {
+        ElementType* const data = field.data_handle();
+        Kokkos::parallel_for(
+                "first_touch",
+                Kokkos::RangePolicy<ExecSpace, Kokkos::Schedule<Kokkos::Static>>(
+                        execution_space,
+                        0,
+                        field.size()),
+                KOKKOS_LAMBDA(std::size_t const i) { data[i] = ElementType(); });
+    }
+}
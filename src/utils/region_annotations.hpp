@@ -0,0 +1,22 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <cstddef>
+#include <string>
+
+#include <Kokkos_Core.hpp>
+
+/**
+ * @brief Annotate the innermost open "(GSLX)" region with the number of bytes it moves.
+ *
+ * The annotation is sent as a Kokkos Tools profiling event. It is collected by the built-in
+ * region profiler (see region_profiler.hpp) to report the bandwidth of the region. Nothing
+ * is done if no tool listens to the profiling events.
+ *
+ * @param[in] n_bytes The number of bytes read or written by the region.
+ */
+inline void annotate_region_bytes(std::size_t const n_bytes)
+{
+    if (Kokkos::Tools::Experimental::get_callbacks().profile_event != nullptr) {
+        Kokkos::Profiling::markEvent("(GSLX) bytes " + std::to_string(n_bytes));
+    }
+}
@@ -0,0 +1,221 @@
+/*
+    Unsplit advection along X and Y on (X, Y).
+*/
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/splines.hpp>
+
+#include <gtest/gtest.h>
+
+#include "bsl_advection_2d.hpp"
+#include "ddc_helper.hpp"
+#include "rk2.hpp"
+#include "vector_field.hpp"
+#include "vector_field_mem.hpp"
+
+namespace {
+// Continuous dimensions
+/// @brief A class which describes the real space in the first spatial direction X.
+struct X
+{
+    /// @brief A boolean indicating if the dimension is periodic.
+    static bool constexpr PERIODIC = true;
+};
+/// @brief A class which describes the real space in the second spatial direction Y.
+struct Y
+{
+    /// @brief A boolean indicating if the dimension is periodic.
+    static bool constexpr PERIODIC = true;
+};
+
+using CoordX = Coord<X>;
+using CoordY = Coord<Y>;
+
+// Splines
+struct BSplinesX : ddc::UniformBSplines<X, 3>
+{
+};
+struct BSplinesY : ddc::UniformBSplines<Y, 3>
+{
+};
+
+ddc::BoundCond constexpr SplineXBoundary = ddc::BoundCond::PERIODIC;
+ddc::BoundCond constexpr SplineYBoundary = ddc::BoundCond::PERIODIC;
+
+
+// Discrete dimensions
+struct GridX : UniformGridBase<X>
+{
+};
+struct GridY : UniformGridBase<Y>
+{
+};
+
+using SplineInterpPointsX
+        = ddc::GrevilleInterpolationPoints<BSplinesX, SplineXBoundary, SplineXBoundary>;
+using SplineInterpPointsY
+        = ddc::GrevilleInterpolationPoints<BSplinesY, SplineYBoundary, SplineYBoundary>;
+
+using IdxRangeX = IdxRange<GridX>;
+using IdxRangeY = IdxRange<GridY>;
+using IdxRangeXY = IdxRange<GridX, GridY>;
+using IdxXY = Idx<GridX, GridY>;
+using IdxStepX = IdxStep<GridX>;
+using IdxStepY = IdxStep<GridY>;
+
+
+// Field types
+using DFieldMemXY = DFieldMem<IdxRangeXY>;
+using DFieldXY = DField<IdxRangeXY>;
+using DVectorFieldMemXY = DVectorFieldMem<IdxRangeXY, VectorIndexSet<X, Y>>;
+
+
+// Operators
+using SplineXYBuilder = ddc::SplineBuilder2D<
+        Kokkos::DefaultExecutionSpace,
+        typename Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesX,
+        BSplinesY,
+        GridX,
+        GridY,
+        SplineXBoundary,
+        SplineXBoundary,
+        SplineYBoundary,
+        SplineYBoundary,
+        ddc::SplineSolver::LAPACK>;
+
+using SplineXYEvaluator = ddc::SplineEvaluator2D<
+        Kokkos::DefaultExecutionSpace,
+        typename Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesX,
+        BSplinesY,
+        GridX,
+        GridY,
+        ddc::PeriodicExtrapolationRule<X>,
+        ddc::PeriodicExtrapolationRule<X>,
+        ddc::PeriodicExtrapolationRule<Y>,
+        ddc::PeriodicExtrapolationRule<Y>>;
+
+
+class XYAdvection2DTest : public ::testing::Test
+{
+protected:
+    static constexpr CoordX x_min = CoordX(-M_PI);
+    static constexpr CoordX x_max = CoordX(M_PI);
+    static constexpr IdxStepX x_size = IdxStepX(32);
+
+    static constexpr CoordY y_min = CoordY(-M_PI);
+    static constexpr CoordY y_max = CoordY(M_PI);
+    static constexpr IdxStepY y_size = IdxStepY(32);
+
+    IdxRangeXY const interpolation_idx_range;
+
+public:
+    XYAdvection2DTest()
+        : interpolation_idx_range(
+                  SplineInterpPointsX::get_domain<GridX>(),
+                  SplineInterpPointsY::get_domain<GridY>()) {};
+
+    ~XYAdvection2DTest() = default;
+
+    static void SetUpTestSuite()
+    {
+        ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_size);
+        ddc::init_discrete_space<BSplinesY>(y_min, y_max, y_size);
+        ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+        ddc::init_discrete_space<GridY>(SplineInterpPointsY::get_sampling<GridY>());
+    }
+
+    /// The foot at time t of the characteristic of dz/dt = sin(z) passing by z0 at time 0.
+    static double exact_foot(
+            double const z0,
+            double const t,
+            double const z_min,
+            double const z_max)
+    {
+        double z = 2 * std::atan(std::tan(z0 / 2.) * std::exp(-t));
+        // Replace the foot inside the periodic domain
+        z = std::fmod(z - z_min, z_max - z_min) + z_min;
+        return z > z_min ? z : z + (z_max - z_min);
+    }
+};
+
+} // end namespace
+
+
+
+TEST_F(XYAdvection2DTest, AdvectionXY)
+{
+    // CREATING OPERATORS ------------------------------------------------------------------------
+    SplineXYBuilder const builder(interpolation_idx_range);
+    ddc::PeriodicExtrapolationRule<X> extrapolation_rule_x;
+    ddc::PeriodicExtrapolationRule<Y> extrapolation_rule_y;
+    SplineXYEvaluator const evaluator(
+            extrapolation_rule_x,
+            extrapolation_rule_x,
+            extrapolation_rule_y,
+            extrapolation_rule_y);
+
+    RK2Builder time_stepper;
+    BslAdvection2D<IdxRangeXY, SplineXYBuilder, SplineXYEvaluator, RK2Builder> const
+            advection(builder, evaluator, time_stepper);
+
+    // TIME PARAMETERS ---------------------------------------------------------------------------
+    double const dt = 0.05;
+    double const final_t = 0.4;
+    int const time_iter = int(final_t / dt);
+
+    // INITIALISATION ----------------------------------------------------------------------------
+    DFieldMemXY function_alloc(interpolation_idx_range);
+    DFieldXY function = get_field(function_alloc);
+
+    DVectorFieldMemXY advection_field_alloc(interpolation_idx_range);
+    DFieldXY advection_field_x = ddcHelper::get<X>(get_field(advection_field_alloc));
+    DFieldXY advection_field_y = ddcHelper::get<Y>(get_field(advection_field_alloc));
+
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            interpolation_idx_range,
+            KOKKOS_LAMBDA(IdxXY const idx) {
+                double const x = ddc::coordinate(ddc::select<GridX>(idx));
+                double const y = ddc::coordinate(ddc::select<GridY>(idx));
+                function(idx) = Kokkos::sin(2 * x) * Kokkos::cos(y);
+                advection_field_x(idx) = Kokkos::sin(x);
+                advection_field_y(idx) = Kokkos::sin(y);
+            });
+
+
+    // EXACT ADVECTED FUNCTION -------------------------------------------------------------------
+    host_t<DFieldMemXY> exact_function(interpolation_idx_range);
+    ddc::host_for_each(interpolation_idx_range, [&](IdxXY const idx) {
+        double const x = exact_foot(
+                ddc::coordinate(ddc::select<GridX>(idx)),
+                final_t,
+                double(x_min),
+                double(x_max));
+        double const y = exact_foot(
+                ddc::coordinate(ddc::select<GridY>(idx)),
+                final_t,
+                double(y_min),
+                double(y_max));
+        exact_function(idx) = std::sin(2 * x) * std::cos(y);
+    });
+
+
+    // SIMULATION --------------------------------------------------------------------------------
+    for (int i(0); i < time_iter; i++) {
+        advection(function, get_const_field(advection_field_alloc), dt);
+    };
+
+    // CHECK ERRORS ------------------------------------------------------------------------------
+    auto function_host = ddc::create_mirror_view_and_copy(function);
+    double max_relative_error = 0;
+    ddc::host_for_each(interpolation_idx_range, [&](IdxXY const idx) {
+        double const relative_error = std::abs(function_host(idx) - exact_function(idx));
+        max_relative_error
+                = max_relative_error > relative_error ? max_relative_error : relative_error;
+    });
+    EXPECT_LE(max_relative_error, 5.e-3);
+    std::cout << "Test on " << x_size << "x" << y_size
+              << " grid: max relative error = " << max_relative_error << std::endl;
+}
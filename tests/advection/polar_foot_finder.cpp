@@ -3,6 +3,7 @@
 
 #include "../test_utils.hpp"
 
+#include "bsl_advection_polar.hpp"
 #include "cartesian_to_circular.hpp"
 #include "cartesian_to_czarny.hpp"
 #include "circular_to_cartesian.hpp"
@@ -317,4 +318,92 @@ TYPED_TEST(PolarAdvectionFixture, Analytical)
     EXPECT_NEAR(error, 0.0, TOL);
 }
 
+TEST(BatchedPolarAdvection, SharedAdvectionField)
+{
+    using Mapping = CircularToCartesian<R, Theta, X, Y>;
+
+    Coord<R> const r_min(0.0);
+    Coord<R> const r_max(1.0);
+    IdxStep<GridR> const nr_cells(20);
+
+    Coord<Theta> const theta_min(0.0);
+    Coord<Theta> const theta_max(2.0 * M_PI);
+    IdxStep<GridTheta> const ntheta_cells(40);
+
+    IdxStepSp const nb_kinspecies(3);
+    IdxRangeSp const idx_range_sp(IdxSp(0), nb_kinspecies);
+
+    ddc::init_discrete_space<BSplinesR>(
+            build_random_non_uniform_break_points(r_min, r_max, nr_cells, 0.5));
+    ddc::init_discrete_space<BSplinesTheta>(
+            build_random_non_uniform_break_points(theta_min, theta_max, ntheta_cells, 0.5));
+
+    ddc::init_discrete_space<GridR>(SplineInterpPointsR::template get_sampling<GridR>());
+    ddc::init_discrete_space<GridTheta>(
+            SplineInterpPointsTheta::template get_sampling<GridTheta>());
+
+    IdxRangeR r_idx_range(SplineInterpPointsR::template get_domain<GridR>());
+    IdxRangeTheta theta_idx_range(SplineInterpPointsTheta::template get_domain<GridTheta>());
+    IdxRangeRTheta idx_range(r_idx_range, theta_idx_range);
+    IdxRangeSpRTheta batched_idx_range(idx_range_sp, idx_range);
+
+    ddc::NullExtrapolationRule r_min_extrap;
+    ddc::PeriodicExtrapolationRule<Theta> theta_extrap;
+    SplineRThetaBuilder builder(idx_range);
+    ddc::ConstantExtrapolationRule<R, Theta> r_max_extrap(r_max);
+    SplineRThetaEvaluator evaluator(r_min_extrap, r_max_extrap, theta_extrap, theta_extrap);
+
+    Mapping const to_physical = init_mapping<Mapping>();
+    RK4Builder time_stepper;
+    AdvectionField_translation<X, Y> const advection_field
+            = init_field<AdvectionField_translation<X, Y>>();
+
+    SplinePolarFootFinder const foot_finder(
+            batched_idx_range,
+            time_stepper,
+            to_physical,
+            to_physical,
+            builder,
+            evaluator);
+    BslAdvectionPolar const advection_operator(builder, evaluator, foot_finder, to_physical);
+
+    DVectorFieldMem<IdxRangeRTheta, CartBasis> adv_field_alloc(idx_range);
+    DVectorFieldMem<IdxRangeSpRTheta, CartBasis> batched_adv_field_alloc(batched_idx_range);
+    DFieldMem<IdxRangeSpRTheta> function_alloc(batched_idx_range);
+    DFieldMem<IdxRangeSpRTheta> function_shared_feet_alloc(batched_idx_range);
+
+    DVectorField<IdxRangeRTheta, CartBasis> adv_field = get_field(adv_field_alloc);
+    DVectorField<IdxRangeSpRTheta, CartBasis> batched_adv_field
+            = get_field(batched_adv_field_alloc);
+    DField<IdxRangeSpRTheta> function = get_field(function_alloc);
+
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            batched_idx_range,
+            KOKKOS_LAMBDA(IdxSpRTheta idx) {
+                IdxRTheta idx_rtheta(idx);
+                CoordXY coord_xy = to_physical(ddc::coordinate(idx_rtheta));
+                double const x = ddc::get<X>(coord_xy);
+                double const y = ddc::get<Y>(coord_xy);
+                DVector<X, Y> const adv = advection_field(coord_xy, 0.0);
+                ddcHelper::assign_vector_field_element(batched_adv_field, idx, adv);
+                if (IdxSp(idx) == IdxSp(0)) {
+                    ddcHelper::assign_vector_field_element(adv_field, idx_rtheta, adv);
+                }
+                function(idx) = (1 + (IdxSp(idx) - IdxSp(0)))
+                                * Kokkos::exp(-((x - 0.2) * (x - 0.2) + y * y) / 0.1);
+            });
+    ddc::parallel_deepcopy(function_shared_feet_alloc, function_alloc);
+
+    double const dt = 0.05;
+    advection_operator(function, get_const_field(batched_adv_field), dt);
+    advection_operator(get_field(function_shared_feet_alloc), get_const_field(adv_field), dt);
+
+    double const error = error_norm_inf(
+            Kokkos::DefaultExecutionSpace(),
+            get_const_field(function_alloc),
+            get_const_field(function_shared_feet_alloc));
+    EXPECT_LE(error, 1e-13);
+}
+
 }; // namespace
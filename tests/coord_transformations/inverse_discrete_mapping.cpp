@@ -0,0 +1,144 @@
+#include <cmath>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/splines.hpp>
+
+#include <gtest/gtest.h>
+
+#include "czarny_to_cartesian.hpp"
+#include "discrete_poloidal_cs_spline_mapping.hpp"
+#include "discrete_poloidal_cs_spline_mapping_builder.hpp"
+#include "geometry_coord_transformations_tests.hpp"
+#include "inverse_discrete_poloidal_cs_spline_mapping.hpp"
+
+namespace {
+
+using CzarnyMapping = CzarnyToCartesian<R, Theta, X, Y>;
+
+class InverseDiscreteMapping : public ::testing::Test
+{
+protected:
+    static int constexpr Nr = 16;
+    static int constexpr Nt = 32;
+
+    static constexpr CoordR r_min = CoordR(0.0);
+    static constexpr CoordR r_max = CoordR(1.0);
+
+    static constexpr CoordTheta theta_min = CoordTheta(0.0);
+    static constexpr CoordTheta theta_max = CoordTheta(2.0 * M_PI);
+
+public:
+    static void SetUpTestSuite()
+    {
+        double const dr((r_max - r_min) / Nr);
+        double const dp((theta_max - theta_min) / Nt);
+
+        std::vector<CoordR> r_break_points(Nr + 1);
+        std::vector<CoordTheta> theta_break_points(Nt + 1);
+
+        for (int i(0); i < Nr; ++i) {
+            r_break_points[i] = CoordR(r_min + i * dr);
+        }
+        r_break_points[Nr] = CoordR(r_max);
+        for (int i(0); i < Nt; ++i) {
+            theta_break_points[i] = CoordTheta(theta_min + i * dp);
+        }
+        theta_break_points[Nt] = CoordTheta(theta_max);
+
+        ddc::init_discrete_space<BSplinesR>(r_break_points);
+        ddc::init_discrete_space<BSplinesTheta>(theta_break_points);
+
+        ddc::init_discrete_space<GridR>(InterpPointsR::get_sampling<GridR>());
+        ddc::init_discrete_space<GridTheta>(InterpPointsTheta::get_sampling<GridTheta>());
+    }
+};
+
+template <class ExecSpace>
+void test_czarny_round_trip()
+{
+    using MemSpace = typename ExecSpace::memory_space;
+
+    const CzarnyMapping analytical_mapping(0.3, 1.4);
+
+    IdxRangeR interpolation_idx_range_r(InterpPointsR::get_domain<GridR>());
+    IdxRangeTheta interpolation_idx_range_theta(InterpPointsTheta::get_domain<GridTheta>());
+    IdxRangeRTheta grid(interpolation_idx_range_r, interpolation_idx_range_theta);
+
+    SplineRThetaBuilder<ExecSpace> builder(grid);
+    ddc::NullExtrapolationRule boundary_condition_r_left;
+    ddc::NullExtrapolationRule boundary_condition_r_right;
+    SplineRThetaEvaluator<ExecSpace> spline_evaluator(
+            boundary_condition_r_left,
+            boundary_condition_r_right,
+            ddc::PeriodicExtrapolationRule<Theta>(),
+            ddc::PeriodicExtrapolationRule<Theta>());
+
+    DiscretePoloidalCSSplineMappingBuilder<
+            X,
+            Y,
+            SplineRThetaBuilder<ExecSpace>,
+            SplineRThetaEvaluator<ExecSpace>>
+            mapping_builder(ExecSpace(), analytical_mapping, builder, spline_evaluator);
+    DiscretePoloidalCSSplineMapping discrete_mapping = mapping_builder();
+
+    InverseDiscretePoloidalCSSplineMappingBuilder<decltype(discrete_mapping), ExecSpace>
+            inverse_builder(ExecSpace(), discrete_mapping);
+    auto inverse_mapping = inverse_builder();
+
+    // Test points away from the grid points and away from the O-point.
+    double const dp = ddc::discrete_space<BSplinesTheta>().length() / Nt;
+    FieldMem<CoordRTheta, IdxRangeRTheta, MemSpace> logical_coords_alloc(grid);
+    FieldMem<CoordXY, IdxRangeRTheta, MemSpace> cartesian_coords_alloc(grid);
+    FieldMem<CoordXY, IdxRangeRTheta, MemSpace> round_trip_alloc(grid);
+    FieldMem<CoordXY, IdxRangeRTheta, MemSpace> round_trip_single_alloc(grid);
+    Field<CoordRTheta, IdxRangeRTheta, MemSpace> logical_coords = get_field(logical_coords_alloc);
+    Field<CoordXY, IdxRangeRTheta, MemSpace> cartesian_coords = get_field(cartesian_coords_alloc);
+    Field<CoordXY, IdxRangeRTheta, MemSpace> round_trip = get_field(round_trip_alloc);
+    Field<CoordXY, IdxRangeRTheta, MemSpace> round_trip_single
+            = get_field(round_trip_single_alloc);
+    ddc::parallel_for_each(
+            ExecSpace(),
+            grid,
+            KOKKOS_LAMBDA(IdxRTheta const irtheta) {
+                double const r = 0.05 + 0.9 * ddc::coordinate(ddc::select<GridR>(irtheta));
+                double const theta = ddc::coordinate(ddc::select<GridTheta>(irtheta)) + 0.5 * dp;
+                cartesian_coords(irtheta) = discrete_mapping(CoordRTheta(r, theta));
+            });
+
+    inverse_mapping(ExecSpace(), logical_coords, get_const_field(cartesian_coords));
+
+    ddc::parallel_for_each(
+            ExecSpace(),
+            grid,
+            KOKKOS_LAMBDA(IdxRTheta const irtheta) {
+                round_trip(irtheta) = discrete_mapping(logical_coords(irtheta));
+                round_trip_single(irtheta)
+                        = discrete_mapping(inverse_mapping(cartesian_coords(irtheta)));
+            });
+
+    auto cartesian_coords_host = ddc::create_mirror_view_and_copy(cartesian_coords);
+    auto round_trip_host = ddc::create_mirror_view_and_copy(round_trip);
+    auto round_trip_single_host = ddc::create_mirror_view_and_copy(round_trip_single);
+    ddc::host_for_each(grid, [&](IdxRTheta const irtheta) {
+        CoordXY const expected = cartesian_coords_host(irtheta);
+        CoordXY const round_trip_coord = round_trip_host(irtheta);
+        CoordXY const round_trip_single_coord = round_trip_single_host(irtheta);
+        EXPECT_NEAR(ddc::get<X>(round_trip_coord), ddc::get<X>(expected), 1e-12);
+        EXPECT_NEAR(ddc::get<Y>(round_trip_coord), ddc::get<Y>(expected), 1e-12);
+        EXPECT_NEAR(ddc::get<X>(round_trip_single_coord), ddc::get<X>(round_trip_coord), 1e-14);
+        EXPECT_NEAR(ddc::get<Y>(round_trip_single_coord), ddc::get<Y>(round_trip_coord), 1e-14);
+    });
+}
+
+} // namespace
+
+TEST_F(InverseDiscreteMapping, CzarnyRoundTripHost)
+{
+    test_czarny_round_trip<Kokkos::DefaultHostExecutionSpace>();
+}
+
+TEST_F(InverseDiscreteMapping, CzarnyRoundTripDevice)
+{
+    test_czarny_round_trip<Kokkos::DefaultExecutionSpace>();
+}
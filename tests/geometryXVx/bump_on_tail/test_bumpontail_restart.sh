@@ -1,9 +1,9 @@
 #!/bin/bash
 set -xe
 
-if [ $# -lt 4 ] || [ $# -gt 6 ]
+if [ $# -lt 4 ] || [ $# -gt 8 ]
 then
-    echo "Usage: $0 <GYSELALIBXX_SRCDIR> <GYSELALIBXX_EXEC> <PYTHON3_EXE> <SIMULATION_NAME> [<RELATIVE_RESTART_TOLERANCE> <ABSOLUTE_RESTART_TOLERANCE>]"
+    echo "Usage: $0 <GYSELALIBXX_SRCDIR> <GYSELALIBXX_EXEC> <PYTHON3_EXE> <SIMULATION_NAME> [<RELATIVE_RESTART_TOLERANCE> <ABSOLUTE_RESTART_TOLERANCE> [<MPIEXEC_EXE> <RESTART_NPROCS>]]"
     exit 1
 fi
 GYSELALIBXX_SRCDIR="$1"
@@ -18,6 +18,12 @@ if [ -n "$6" ]
 then
     ABSOLUTE_RESTART_TOLERANCE="$6"
 fi
+# The restarted simulation can be run on a different number of MPI processes
+RESTART_LAUNCHER=""
+if [ -n "$7" ]
+then
+    RESTART_LAUNCHER="$7 -n $8"
+fi
 
 OUTDIR="${PWD}/${SIMULATION_NAME}"
 
@@ -42,6 +48,7 @@ sed -i.save 's/^  vx_size: .*/  vx_size: 16/' bumpontail.yaml
 sed -i.save 's/^  nbiter: .*/  nbiter: 10/' bumpontail.yaml
 sed -i.save 's/^  deltat: .*/  deltat: 0.125/' bumpontail.yaml
 sed -i.save 's/^  time_diag: .*/  time_diag: 0.25/' bumpontail.yaml
+sed -i.save 's/^  time_checkpoint: .*/  time_checkpoint: 0.25/' bumpontail.yaml
 
 "${GYSELALIBXX_EXEC}" "${PWD}/bumpontail.yaml"
 
@@ -50,7 +57,7 @@ cp "${RSTDIR}/GYSELALIBXX_initstate.h5" .
 cp "${RSTDIR}/GYSELALIBXX_00003.h5" .
 cp "${RSTDIR}/bumpontail.yaml" bumpontail_restart.yaml
 
-"${GYSELALIBXX_EXEC}" --iter-restart 3 "${PWD}/bumpontail_restart.yaml"
+${RESTART_LAUNCHER} "${GYSELALIBXX_EXEC}" --iter-restart 3 "${PWD}/bumpontail_restart.yaml"
 sed -i.save 's/^  nbiter: .*/  nbiter: 2/' bumpontail_restart.yaml
 sed -i.save 's/^  time_diag: .*/  time_diag: 0.5/' bumpontail_restart.yaml
 
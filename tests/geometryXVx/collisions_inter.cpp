@@ -165,3 +165,156 @@ TEST(CollisionsInter, CollisionsInter)
     PC_tree_destroy(&conf_pdi);
     PDI_finalize();
 }
+
+TEST(CollisionsInter, CollisionsInterExponential)
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(1.0);
+    IdxStepX const x_size(5);
+
+    CoordVx const vx_min(-10);
+    CoordVx const vx_max(10);
+    IdxStepVx const vx_size(600);
+
+    IdxStepSp const nb_kinspecies(2);
+
+    IdxRangeSp const idx_range_sp(IdxSp(0), nb_kinspecies);
+    IdxSp const my_iion = idx_range_sp.front();
+    IdxSp const my_ielec = idx_range_sp.back();
+
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    // Creating mesh & supports
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_size);
+
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_size);
+
+    ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+    ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+
+    IdxRangeX gridx(SplineInterpPointsX::get_domain<GridX>());
+    IdxRangeVx gridvx(SplineInterpPointsVx::get_domain<GridVx>());
+
+    IdxRangeSpXVx const mesh(idx_range_sp, gridx, gridvx);
+    IdxRangeSpX const mesh_spx(idx_range_sp, gridx);
+
+    host_t<DFieldMemSp> charges(idx_range_sp);
+    charges(my_ielec) = -1.;
+    charges(my_iion) = 1.;
+    host_t<DFieldMemSp> masses(idx_range_sp);
+    double const mass_ion(400.), mass_elec(1.);
+    masses(my_ielec) = mass_elec;
+    masses(my_iion) = mass_ion;
+
+    ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+
+    DFieldMemVx quadrature_coeffs
+            = trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(gridvx);
+    Quadrature<IdxRangeVx, IdxRangeSpXVx> integrate(get_const_field(quadrature_coeffs));
+    FluidMoments moments(integrate);
+
+    // Initialisation of the distribution functions as maxwellians with different
+    // electron and ion temperatures and mean velocities
+    double const density_init(1.);
+    host_t<DFieldMemSp> temperature_init(idx_range_sp);
+    temperature_init(my_iion) = 1.;
+    temperature_init(my_ielec) = 1.2;
+    host_t<DFieldMemSp> fluid_velocity_init(idx_range_sp);
+    fluid_velocity_init(my_iion) = 0.;
+    fluid_velocity_init(my_ielec) = 0.2;
+    auto initialise = [&](DFieldSpXVx allfdistribu) {
+        ddc::host_for_each(mesh_spx, [&](IdxSpX const ispx) {
+            DFieldMemVx finit(gridvx);
+            MaxwellianEquilibrium::compute_maxwellian(
+                    get_field(finit),
+                    density_init,
+                    temperature_init(ddc::select<Species>(ispx)),
+                    fluid_velocity_init(ddc::select<Species>(ispx)));
+            ddc::parallel_deepcopy(allfdistribu[ispx], get_const_field(finit));
+        });
+    };
+    auto compute_moments = [&](host_t<DFieldSpX> density,
+                               host_t<DFieldSpX> temperature,
+                               DConstFieldSpXVx allfdistribu) {
+        auto allfdistribu_host = ddc::create_mirror_view_and_copy(allfdistribu);
+        host_t<DFieldMemSpX> fluid_velocity(mesh_spx);
+        ddc::host_for_each(mesh_spx, [&](IdxSpX const ispx) {
+            moments(density(ispx),
+                    get_const_field(allfdistribu_host[ispx]),
+                    FluidMoments::s_density);
+            moments(fluid_velocity(ispx),
+                    get_const_field(allfdistribu_host[ispx]),
+                    density(ispx),
+                    FluidMoments::s_velocity);
+            moments(temperature(ispx),
+                    get_const_field(allfdistribu_host[ispx]),
+                    density(ispx),
+                    fluid_velocity(ispx),
+                    FluidMoments::s_temperature);
+        });
+    };
+
+    double const nustar0(0.1);
+    CollisionsInter collisions_explicit(mesh, nustar0, CollisionsInterMethod::Explicit, 10);
+    CollisionsInter collisions_exponential(mesh, nustar0, CollisionsInterMethod::Exponential);
+
+    // The exponential integrator agrees with the sub-cycled explicit integrator
+    DFieldMemSpXVx allfdistribu_explicit(mesh);
+    DFieldMemSpXVx allfdistribu_exponential(mesh);
+    initialise(get_field(allfdistribu_explicit));
+    initialise(get_field(allfdistribu_exponential));
+    double const deltat(0.5);
+    int const nbiter(20);
+    for (int iter(0); iter < nbiter; iter++) {
+        collisions_explicit(get_field(allfdistribu_explicit), deltat);
+        collisions_exponential(get_field(allfdistribu_exponential), deltat);
+    }
+
+    host_t<DFieldMemSpX> density_explicit(mesh_spx);
+    host_t<DFieldMemSpX> temperature_explicit(mesh_spx);
+    host_t<DFieldMemSpX> density_exponential(mesh_spx);
+    host_t<DFieldMemSpX> temperature_exponential(mesh_spx);
+    compute_moments(
+            get_field(density_explicit),
+            get_field(temperature_explicit),
+            get_const_field(allfdistribu_explicit));
+    compute_moments(
+            get_field(density_exponential),
+            get_field(temperature_exponential),
+            get_const_field(allfdistribu_exponential));
+    ddc::host_for_each(gridx, [&](IdxX const ix) {
+        double const temperature_diff_explicit
+                = temperature_explicit(my_ielec, ix) - temperature_explicit(my_iion, ix);
+        double const temperature_diff_exponential
+                = temperature_exponential(my_ielec, ix) - temperature_exponential(my_iion, ix);
+        EXPECT_NEAR(
+                temperature_diff_exponential,
+                temperature_diff_explicit,
+                1e-3 * std::fabs(temperature_diff_explicit));
+    });
+
+    // The exponential integrator is stable for timesteps much larger than the collision time.
+    // The temperatures relax to a common temperature and the density is conserved.
+    initialise(get_field(allfdistribu_exponential));
+    double const deltat_large(1000.);
+    int const nbiter_large(20);
+    for (int iter(0); iter < nbiter_large; iter++) {
+        collisions_exponential(get_field(allfdistribu_exponential), deltat_large);
+    }
+    compute_moments(
+            get_field(density_exponential),
+            get_field(temperature_exponential),
+            get_const_field(allfdistribu_exponential));
+    ddc::host_for_each(gridx, [&](IdxX const ix) {
+        EXPECT_NEAR(density_exponential(my_ielec, ix), density_init, 1e-8);
+        EXPECT_NEAR(density_exponential(my_iion, ix), density_init, 1e-8);
+        EXPECT_NEAR(
+                temperature_exponential(my_ielec, ix),
+                temperature_exponential(my_iion, ix),
+                1e-6);
+    });
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
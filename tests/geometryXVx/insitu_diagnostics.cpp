@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: MIT
+#include <cmath>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+#include <paraconf.h>
+#include <pdi.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "geometry_xvx.hpp"
+#include "insitu_diagnostics.hpp"
+#include "spline_definitions_xvx.hpp"
+#include "trapezoid_quadrature.hpp"
+
+namespace {
+
+constexpr char const* const PDI_CFG = R"PDI_CFG(
+metadata:
+  diag_write_index: int
+  diag_n_records: int
+  diag_n_modes: int
+  diag_n_species: int
+  diag_n_x: int
+
+data:
+  diag_mass: { type: array, subtype: double, size: [ '$diag_n_records', '$diag_n_species' ] }
+  diag_density: { type: array, subtype: double, size: [ '$diag_n_records', '$diag_n_species', '$diag_n_x' ] }
+
+plugins:
+  decl_hdf5:
+    - file: 'test_insitu_diagnostics.h5'
+      on_event: insitu_diagnostics
+      collision_policy: replace_and_warn
+      write: [diag_mass, diag_density]
+    - file: 'test_insitu_diagnostics.h5'
+      on_event: read_diagnostics
+      read: [diag_mass, diag_density]
+)PDI_CFG";
+
+/**
+ * Distribute several species over the MPI ranks (see VxSplit) and check that the masses and
+ * the densities computed by the in-situ diagnostics are those of the full distribution
+ * function.
+ */
+TEST(InSituDiagnostics, SpeciesDistributedMoments)
+{
+    int comm_size;
+    int rank;
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    PC_tree_t conf_pdi = PC_parse_string(PDI_CFG);
+    PC_errhandler(PC_NULL_HANDLER);
+    PDI_init(conf_pdi);
+
+    CoordX const x_min(0.0);
+    CoordX const x_max(1.0);
+    IdxStepX const x_ncells(8);
+
+    CoordVx const vx_min(-6.0);
+    CoordVx const vx_max(6.0);
+    IdxStepVx const vx_ncells(16);
+
+    // Several species are held by each rank
+    IdxStepSp const nb_species(2 * comm_size);
+    IdxRangeSp const idx_range_sp(IdxSp(0), nb_species);
+
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_ncells);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_ncells);
+    ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+    ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+    IdxRangeX const idx_range_x(SplineInterpPointsX::get_domain<GridX>());
+    IdxRangeVx const idx_range_vx(SplineInterpPointsVx::get_domain<GridVx>());
+
+    host_t<DFieldMemSp> charges(idx_range_sp);
+    host_t<DFieldMemSp> masses(idx_range_sp);
+    ddc::parallel_fill(charges, 1.);
+    charges(idx_range_sp.front()) = -1.;
+    ddc::parallel_fill(masses, 1.);
+    ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+
+    IdxRangeSpXVx const idx_range(idx_range_sp, idx_range_x, idx_range_vx);
+    IdxRangeSpXVx const local_idx_range
+            = VxSplit::distribute_idx_range(idx_range, comm_size, rank);
+    IdxRangeVx const local_idx_range_vx(local_idx_range);
+    EXPECT_EQ(IdxRangeSp(local_idx_range).size(), 2);
+
+    DFieldMemX const quadrature_coeffs_x
+            = trapezoid_quadrature_coefficients_1d<Kokkos::DefaultExecutionSpace>(idx_range_x);
+    DFieldMemVx const quadrature_coeffs_vx
+            = trapezoid_quadrature_coefficients_1d<Kokkos::DefaultExecutionSpace>(idx_range_vx);
+    DFieldMemVx local_quadrature_coeffs_vx(local_idx_range_vx);
+    ddc::parallel_deepcopy(
+            get_field(local_quadrature_coeffs_vx),
+            quadrature_coeffs_vx[local_idx_range_vx]);
+
+    // Each species has a different density so mixing the species would change the results
+    auto fdistribu_value = [&](IdxSpXVx const ispxvx) {
+        double const x = ddc::coordinate(ddc::select<GridX>(ispxvx));
+        double const v = ddc::coordinate(ddc::select<GridVx>(ispxvx));
+        int const isp = (ddc::select<Species>(ispxvx) - idx_range_sp.front()).value();
+        double const amplitude = 1.0 + isp;
+        return amplitude * (1.0 + 0.5 * std::cos(2 * M_PI * x)) * std::exp(-0.5 * v * v);
+    };
+    host_t<DFieldMemSpXVx> local_fdistribu_host(local_idx_range);
+    ddc::for_each(local_idx_range, [&](IdxSpXVx const ispxvx) {
+        local_fdistribu_host(ispxvx) = fdistribu_value(ispxvx);
+    });
+    DFieldMemSpXVx local_fdistribu(local_idx_range);
+    ddc::parallel_deepcopy(local_fdistribu, local_fdistribu_host);
+
+    DFieldMemX electrostatic_potential(idx_range_x);
+    DFieldMemX electric_field(idx_range_x);
+    ddc::parallel_fill(get_field(electrostatic_potential), 0.);
+    ddc::parallel_fill(get_field(electric_field), 0.);
+
+    InSituDiagnostics diagnostics(
+            MPI_COMM_WORLD,
+            idx_range_sp,
+            get_const_field(quadrature_coeffs_x),
+            get_const_field(local_quadrature_coeffs_vx),
+            std::vector<int> {},
+            1);
+    diagnostics(
+            0.0,
+            get_const_field(local_fdistribu),
+            get_const_field(electrostatic_potential),
+            get_const_field(electric_field));
+    EXPECT_EQ(diagnostics.get_n_pending_records(), 0);
+
+    if (rank == 0) {
+        // The reference values are computed on the full distribution function
+        auto quadrature_coeffs_x_host
+                = ddc::create_mirror_view_and_copy(get_field(quadrature_coeffs_x));
+        auto quadrature_coeffs_vx_host
+                = ddc::create_mirror_view_and_copy(get_field(quadrature_coeffs_vx));
+        int const n_x = idx_range_x.size();
+        std::vector<double> mass_ref(idx_range_sp.size(), 0.0);
+        std::vector<double> density_ref(idx_range_sp.size() * n_x, 0.0);
+        ddc::for_each(idx_range, [&](IdxSpXVx const ispxvx) {
+            IdxX const ix(ispxvx);
+            IdxVx const ivx(ispxvx);
+            int const isp = (ddc::select<Species>(ispxvx) - idx_range_sp.front()).value();
+            int const ispx = isp * n_x + (ix - idx_range_x.front()).value();
+            double const f = fdistribu_value(ispxvx);
+            mass_ref[isp] += quadrature_coeffs_x_host(ix) * quadrature_coeffs_vx_host(ivx) * f;
+            density_ref[ispx] += quadrature_coeffs_vx_host(ivx) * f;
+        });
+
+        std::vector<double> mass(mass_ref.size());
+        std::vector<double> density(density_ref.size());
+        PDI_multi_expose(
+                "read_diagnostics",
+                "diag_mass",
+                mass.data(),
+                PDI_IN,
+                "diag_density",
+                density.data(),
+                PDI_IN,
+                NULL);
+        for (std::size_t i(0); i < mass.size(); ++i) {
+            EXPECT_NEAR(mass[i], mass_ref[i], 1e-12 * mass_ref[i]);
+        }
+        for (std::size_t i(0); i < density.size(); ++i) {
+            EXPECT_NEAR(density[i], density_ref[i], 1e-12 * density_ref[i]);
+        }
+    }
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
+
+} // namespace
@@ -1,7 +1,9 @@
 // SPDX-License-Identifier: MIT
 #include <cmath>
+#include <functional>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include <ddc/ddc.hpp>
 
@@ -11,9 +13,11 @@
 #include <paraconf.h>
 #include <pdi.h>
 
+#include "composite_right_hand_side.hpp"
 #include "ddc_alias_inline_functions.hpp"
 #include "geometry_xvx.hpp"
 #include "irighthandside.hpp"
+#include "kinetic_source.hpp"
 #include "krook_source_adaptive.hpp"
 #include "krook_source_constant.hpp"
 #include "mask_tanh.hpp"
@@ -261,3 +265,99 @@ TEST(KrookSource, Constant)
     PC_tree_destroy(&conf_pdi);
     PDI_finalize();
 }
+
+TEST(KrookSource, CompositeMatchesSequential)
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(1.0);
+    IdxStepX const x_size(10);
+
+    CoordVx const vx_min(-6);
+    CoordVx const vx_max(6);
+    IdxStepVx const vx_size(20);
+
+    IdxStepSp const nb_kinspecies(2);
+
+    IdxRangeSp const idx_range_sp(IdxSp(0), nb_kinspecies);
+
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    // Creating mesh & supports
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_size);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_size);
+
+    ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+    ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+
+    IdxRangeX gridx(SplineInterpPointsX::get_domain<GridX>());
+    IdxRangeVx gridvx(SplineInterpPointsVx::get_domain<GridVx>());
+
+    IdxRangeSpXVx const mesh(idx_range_sp, gridx, gridvx);
+
+    host_t<DFieldMemSp> charges(idx_range_sp);
+    host_t<DFieldMemSp> masses(idx_range_sp);
+    charges(idx_range_sp.front()) = 1.;
+    charges(idx_range_sp.back()) = -1.;
+    ddc::host_for_each(idx_range_sp, [&](IdxSp const isp) { masses(isp) = 1.0; });
+    ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+
+    KrookSourceConstant const rhs_krook_constant(
+            gridx,
+            gridvx,
+            RhsType::Source,
+            0.25,
+            0.01,
+            0.2,
+            1.5,
+            0.8);
+    KrookSourceAdaptive const rhs_krook_adaptive(
+            gridx,
+            gridvx,
+            RhsType::Sink,
+            0.5,
+            0.01,
+            0.1,
+            0.5,
+            0.5);
+    KineticSource const rhs_kinetic(gridx, gridvx, 0.2, 0.01, 0.3, 1., 1., 1.);
+
+    std::vector<std::reference_wrapper<IRightHandSide const>> rhs_list
+            = {rhs_krook_constant, rhs_krook_adaptive, rhs_kinetic};
+    CompositeRightHandSide const rhs_composite(rhs_list);
+
+    // Initialisation of the distribution function : maxwellian
+    DFieldMemSpXVx allfdistribu_sequential(mesh);
+    ddc::host_for_each(ddc::select<Species, GridX>(mesh), [&](IdxSpX const ispx) {
+        double const density_init = charge(ddc::select<Species>(ispx)) >= 0. ? 1. : 2.;
+        DFieldMemVx finit(gridvx);
+        MaxwellianEquilibrium::compute_maxwellian(get_field(finit), density_init, 1., 0.);
+        auto finit_host = ddc::create_mirror_view_and_copy(get_field(finit));
+        ddc::parallel_deepcopy(allfdistribu_sequential[ispx], finit_host);
+    });
+    DFieldMemSpXVx allfdistribu_composite(mesh);
+    ddc::parallel_deepcopy(allfdistribu_composite, allfdistribu_sequential);
+
+    double const deltat = 0.1;
+    int const nbsteps = 5;
+    for (int iter = 0; iter < nbsteps; ++iter) {
+        for (IRightHandSide const& rhs : rhs_list) {
+            rhs(get_field(allfdistribu_sequential), deltat);
+        }
+        rhs_composite(get_field(allfdistribu_composite), deltat);
+    }
+
+    auto allfdistribu_sequential_host
+            = ddc::create_mirror_view_and_copy(get_field(allfdistribu_sequential));
+    auto allfdistribu_composite_host
+            = ddc::create_mirror_view_and_copy(get_field(allfdistribu_composite));
+    ddc::host_for_each(mesh, [&](IdxSpXVx const ispxvx) {
+        EXPECT_NEAR(
+                allfdistribu_composite_host(ispxvx),
+                allfdistribu_sequential_host(ispxvx),
+                1e-12);
+    });
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
@@ -42,6 +42,7 @@ sed -i.save 's/^  vx_size: .*/  vx_size: 16/' landau.yaml
 sed -i.save 's/^  nbiter: .*/  nbiter: 10/' landau.yaml
 sed -i.save 's/^  deltat: .*/  deltat: 0.125/' landau.yaml
 sed -i.save 's/^  time_diag: .*/  time_diag: 0.25/' landau.yaml
+sed -i.save 's/^  time_checkpoint: .*/  time_checkpoint: 0.25/' landau.yaml
 
 "${GYSELALIBXX_EXEC}" "${PWD}/landau.yaml"
 
@@ -71,4 +71,15 @@ TEST(Masks, Ordering)
             Kokkos::DefaultExecutionSpace(),
             get_const_field(mask_normalised_inverted));
     EXPECT_LE(std::fabs(mask_inverted_integrated - 1.0), tolerance);
+
+    // same with the mask filled directly on the device
+    DFieldMemX mask_device(gridx);
+    mask_tanh(get_field(mask_device), extent, stiffness, MaskType::Inverted, true);
+    double const mask_device_integrated
+            = integrate_x(Kokkos::DefaultExecutionSpace(), get_const_field(mask_device));
+    EXPECT_LE(std::fabs(mask_device_integrated - 1.0), tolerance);
+    auto mask_device_host = ddc::create_mirror_view_and_copy(get_field(mask_device));
+    EXPECT_LE(
+            std::fabs(mask_device_host(tenth) - mask_normalised_inverted_host(tenth)),
+            tolerance);
 }
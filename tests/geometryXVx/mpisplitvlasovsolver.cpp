@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: MIT
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+#include <paraconf.h>
+#include <pdi.h>
+
+#include "bsl_advection_vx.hpp"
+#include "bsl_advection_x.hpp"
+#include "chargedensitycalculator.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "geometry_xvx.hpp"
+#include "krook_source_constant.hpp"
+#include "mpichargedensitycalculator.hpp"
+#include "mpisplitvlasovsolver.hpp"
+#include "mpitransposealltoall.hpp"
+#include "species_info.hpp"
+#include "spline_definitions_xvx.hpp"
+#include "splitvlasovsolver.hpp"
+#include "trapezoid_quadrature.hpp"
+
+namespace {
+
+/**
+ * Initialise the discrete spaces of a mesh with a single electron species (so that both the
+ * positions and the velocities are distributed over the MPI ranks).
+ */
+IdxRangeSpXVx init_idx_range()
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(2 * M_PI);
+    IdxStepX const x_ncells(16);
+
+    CoordVx const vx_min(-6.0);
+    CoordVx const vx_max(6.0);
+    IdxStepVx const vx_ncells(16);
+
+    IdxRangeSp const idx_range_sp(IdxSp(0), IdxStepSp(1));
+
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_ncells);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_ncells);
+    ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+    ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+    IdxRangeX const idx_range_x(SplineInterpPointsX::get_domain<GridX>());
+    IdxRangeVx const idx_range_vx(SplineInterpPointsVx::get_domain<GridVx>());
+
+    host_t<DFieldMemSp> charges(idx_range_sp);
+    host_t<DFieldMemSp> masses(idx_range_sp);
+    ddc::parallel_fill(charges, -1.);
+    ddc::parallel_fill(masses, 1.);
+    ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+
+    return IdxRangeSpXVx(idx_range_sp, idx_range_x, idx_range_vx);
+}
+
+/**
+ * Initialise the distribution function as a perturbed Maxwellian on the full index range
+ * and on the local index range, and the electric field.
+ */
+void init_fields(
+        DFieldSpXVx fdistribu,
+        DFieldSpXVx local_fdistribu,
+        DFieldX electric_field)
+{
+    IdxRangeSpXVx const idx_range = get_idx_range(fdistribu);
+    IdxRangeSpXVx const local_idx_range = get_idx_range(local_fdistribu);
+    IdxRangeX const idx_range_x = get_idx_range(electric_field);
+    host_t<DFieldMemSpXVx> fdistribu_host(idx_range);
+    ddc::for_each(idx_range, [&](IdxSpXVx const ispxvx) {
+        double const x = ddc::coordinate(ddc::select<GridX>(ispxvx));
+        double const v = ddc::coordinate(ddc::select<GridVx>(ispxvx));
+        fdistribu_host(ispxvx) = (1.0 + 0.1 * std::cos(x)) * std::exp(-0.5 * v * v);
+    });
+    host_t<DFieldMemSpXVx> local_fdistribu_host(local_idx_range);
+    ddc::for_each(local_idx_range, [&](IdxSpXVx const ispxvx) {
+        local_fdistribu_host(ispxvx) = fdistribu_host(ispxvx);
+    });
+    ddc::parallel_deepcopy(fdistribu, fdistribu_host);
+    ddc::parallel_deepcopy(local_fdistribu, local_fdistribu_host);
+
+    host_t<DFieldMemX> electric_field_host(idx_range_x);
+    ddc::for_each(idx_range_x, [&](IdxX const ix) {
+        electric_field_host(ix) = 0.1 * std::sin(ddc::coordinate(ix));
+    });
+    ddc::parallel_deepcopy(electric_field, electric_field_host);
+}
+
+/**
+ * Check that the local part of the distribution function matches the full distribution
+ * function.
+ */
+void check_local_fdistribu(DConstFieldSpXVx fdistribu, DConstFieldSpXVx local_fdistribu)
+{
+    auto fdistribu_host = ddc::create_mirror_view_and_copy(fdistribu);
+    auto local_fdistribu_host = ddc::create_mirror_view_and_copy(local_fdistribu);
+    ddc::for_each(get_idx_range(local_fdistribu), [&](IdxSpXVx const ispxvx) {
+        EXPECT_NEAR(local_fdistribu_host(ispxvx), fdistribu_host(ispxvx), 1e-12);
+    });
+}
+
+/**
+ * Advect a distribution function distributed over the MPI ranks with MpiSplitVlasovSolver and
+ * compute its charge density with MpiChargeDensityCalculator. Check that the results are
+ * those obtained on the full distribution function with SplitVlasovSolver and
+ * ChargeDensityCalculator.
+ */
+TEST(MpiSplitVlasovSolver, CompareWithSerial)
+{
+    IdxRangeSpXVx const idx_range = init_idx_range();
+    IdxRangeX const idx_range_x(idx_range);
+    IdxRangeVx const idx_range_vx(idx_range);
+
+    MPITransposeAllToAll<XSplit, VxSplit> transpose(idx_range, MPI_COMM_WORLD);
+    IdxRangeSpXVx const local_idx_range(transpose.get_local_idx_range<VxSplit>());
+    IdxRangeVx const local_idx_range_vx(local_idx_range);
+
+    DFieldMemSpXVx fdistribu(idx_range);
+    DFieldMemSpXVx local_fdistribu(local_idx_range);
+    DFieldMemX electric_field(idx_range_x);
+    init_fields(get_field(fdistribu), get_field(local_fdistribu), get_field(electric_field));
+
+    SplineInterpolatorX const spline_interpolation_x(idx_range_x);
+    SplineInterpolatorVx const spline_interpolation_vx(idx_range_vx);
+    BslAdvectionSpatial<GeometryXVx, SplineInterpolatorX> const advection_x(
+            spline_interpolation_x);
+    BslAdvectionVelocity<GeometryXVx, SplineInterpolatorVx> const advection_vx(
+            spline_interpolation_vx);
+
+    SplitVlasovSolver const vlasov(advection_x, advection_vx);
+    MpiSplitVlasovSolver const mpi_vlasov(advection_x, advection_vx, transpose);
+
+    double const dt = 0.1;
+    int const nb_steps = 3;
+    for (int iter(0); iter < nb_steps; ++iter) {
+        vlasov(get_field(fdistribu), get_const_field(electric_field), dt);
+        mpi_vlasov(get_field(local_fdistribu), get_const_field(electric_field), dt);
+    }
+    check_local_fdistribu(get_const_field(fdistribu), get_const_field(local_fdistribu));
+
+    DFieldMemVx const quadrature_coeffs
+            = trapezoid_quadrature_coefficients_1d<Kokkos::DefaultExecutionSpace>(idx_range_vx);
+    DFieldMemVx local_quadrature_coeffs(local_idx_range_vx);
+    ddc::parallel_deepcopy(
+            get_field(local_quadrature_coeffs),
+            quadrature_coeffs[local_idx_range_vx]);
+
+    ChargeDensityCalculator const charge_density_calculator(get_const_field(quadrature_coeffs));
+    ChargeDensityCalculator const local_charge_density_calculator(
+            get_const_field(local_quadrature_coeffs));
+    MpiChargeDensityCalculator const
+            mpi_charge_density_calculator(MPI_COMM_WORLD, local_charge_density_calculator);
+
+    DFieldMemX charge_density(idx_range_x);
+    DFieldMemX mpi_charge_density(idx_range_x);
+    charge_density_calculator(get_field(charge_density), get_const_field(fdistribu));
+    mpi_charge_density_calculator(get_field(mpi_charge_density), get_const_field(local_fdistribu));
+
+    auto charge_density_host = ddc::create_mirror_view_and_copy(get_field(charge_density));
+    auto mpi_charge_density_host = ddc::create_mirror_view_and_copy(get_field(mpi_charge_density));
+    ddc::for_each(idx_range_x, [&](IdxX const ix) {
+        EXPECT_NEAR(mpi_charge_density_host(ix), charge_density_host(ix), 1e-12);
+    });
+}
+
+/**
+ * Apply a Krook source with MpiSplitVlasovSolver on a distribution function distributed over
+ * the MPI ranks. Check that the result is that of the same splitting (the sources surround
+ * the advection along vx) applied to the full distribution function.
+ */
+TEST(MpiSplitVlasovSolver, SourcesCompareWithSerial)
+{
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    IdxRangeSpXVx const idx_range = init_idx_range();
+    IdxRangeX const idx_range_x(idx_range);
+    IdxRangeVx const idx_range_vx(idx_range);
+
+    MPITransposeAllToAll<XSplit, VxSplit> transpose(idx_range, MPI_COMM_WORLD);
+    IdxRangeSpXVx const local_idx_range(transpose.get_local_idx_range<VxSplit>());
+
+    DFieldMemSpXVx fdistribu(idx_range);
+    DFieldMemSpXVx local_fdistribu(local_idx_range);
+    DFieldMemX electric_field(idx_range_x);
+    init_fields(get_field(fdistribu), get_field(local_fdistribu), get_field(electric_field));
+
+    SplineInterpolatorX const spline_interpolation_x(idx_range_x);
+    SplineInterpolatorVx const spline_interpolation_vx(idx_range_vx);
+    BslAdvectionSpatial<GeometryXVx, SplineInterpolatorX> const advection_x(
+            spline_interpolation_x);
+    BslAdvectionVelocity<GeometryXVx, SplineInterpolatorVx> const advection_vx(
+            spline_interpolation_vx);
+
+    // The mask is defined on all the positions so the source can act on any local index range
+    KrookSourceConstant const rhs_krook(
+            idx_range_x,
+            idx_range_vx,
+            RhsType::Sink,
+            1.0,
+            0.1,
+            0.5,
+            0.5,
+            0.8);
+    MpiSplitVlasovSolver const mpi_boltzmann(advection_x, advection_vx, transpose, {rhs_krook});
+
+    double const dt = 0.1;
+    int const nb_steps = 3;
+    for (int iter(0); iter < nb_steps; ++iter) {
+        advection_x(get_field(fdistribu), dt / 2);
+        rhs_krook(get_field(fdistribu), dt / 2);
+        advection_vx(get_field(fdistribu), get_const_field(electric_field), dt);
+        rhs_krook(get_field(fdistribu), dt / 2);
+        advection_x(get_field(fdistribu), dt / 2);
+        mpi_boltzmann(get_field(local_fdistribu), get_const_field(electric_field), dt);
+    }
+    check_local_fdistribu(get_const_field(fdistribu), get_const_field(local_fdistribu));
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
+
+} // namespace
@@ -5,6 +5,7 @@
 #include "bsl_advection_x.hpp"
 #include "geometry_xvx.hpp"
 #include "spline_definitions_xvx.hpp"
+#include "trapezoid_quadrature.hpp"
 
 
 
@@ -103,3 +104,62 @@ TEST(SpatialAdvection, SplineBatched)
             = SpatialAdvection<GeometryXVx, GridX>(spline_advection_x, idx_range_x, idx_range_vx);
     EXPECT_LE(err, 1.e-6);
 }
+
+TEST(SpatialAdvection, ChargeDensityAfterTransport)
+{
+    auto [idx_range_x, idx_range_vx] = Init_idx_range_spatial_adv();
+
+    IdxStepSp const nb_species(2);
+    IdxRangeSp const idx_range_allsp(IdxSp(0), nb_species);
+    IdxSp const i_elec = idx_range_allsp.front();
+    IdxSp const i_ion = idx_range_allsp.back();
+    host_t<DFieldMemSp> masses_host(idx_range_allsp);
+    host_t<DFieldMemSp> charges_host(idx_range_allsp);
+    masses_host(i_elec) = 1.;
+    masses_host(i_ion) = 4.;
+    charges_host(i_elec) = -1.;
+    charges_host(i_ion) = 1.;
+    ddc::init_discrete_space<Species>(std::move(charges_host), std::move(masses_host));
+
+    IdxRangeSpXVx const meshSpXVx(idx_range_allsp, idx_range_x, idx_range_vx);
+    host_t<DFieldMemSpXVx> allfdistribu_host(meshSpXVx);
+    ddc::host_for_each(meshSpXVx, [&](IdxSpXVx const ispxvx) {
+        double const x = ddc::coordinate(ddc::select<GridX>(ispxvx));
+        double const v = ddc::coordinate(ddc::select<GridVx>(ispxvx));
+        double const amplitude = (ddc::select<Species>(ispxvx) == i_elec) ? 0.5 : 0.2;
+        allfdistribu_host(ispxvx) = (1. + amplitude * cos(x)) * exp(-0.5 * v * v);
+    });
+    DFieldMemSpXVx allfdistribu(meshSpXVx);
+    ddc::parallel_deepcopy(allfdistribu, allfdistribu_host);
+
+    DFieldMemVx const quadrature_coeffs(
+            trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(idx_range_vx));
+    auto quadrature_coeffs_host = ddc::create_mirror_view_and_copy(get_field(quadrature_coeffs));
+
+    SplineInterpolatorX spline_interpolation(idx_range_x);
+    BslAdvectionSpatial<GeometryXVx, SplineInterpolatorX> const spline_advection_x(
+            spline_interpolation);
+
+    double const timestep = .1;
+    DFieldMemX charge_density(idx_range_x);
+    spline_advection_x.charge_density_after_transport(
+            get_field(charge_density),
+            get_const_field(allfdistribu),
+            get_const_field(quadrature_coeffs),
+            timestep);
+    auto charge_density_host = ddc::create_mirror_view_and_copy(get_field(charge_density));
+
+    // The fused operator must match the integral of the advected distribution function
+    spline_advection_x(get_field(allfdistribu), timestep);
+    ddc::parallel_deepcopy(allfdistribu_host, allfdistribu);
+    ddc::host_for_each(idx_range_x, [&](IdxX const ix) {
+        double charge_density_ref = 0.;
+        for (IdxSp const isp : idx_range_allsp) {
+            for (IdxVx const ivx : idx_range_vx) {
+                charge_density_ref += charge(isp) * quadrature_coeffs_host(ivx)
+                                      * allfdistribu_host(isp, ix, ivx);
+            }
+        }
+        EXPECT_NEAR(charge_density_host(ix), charge_density_ref, 1.e-12);
+    });
+}
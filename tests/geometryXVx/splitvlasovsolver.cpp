@@ -26,6 +26,26 @@ public:
     {
         return this->CallOp(allfdistribu, dt);
     }
+
+    MOCK_METHOD(
+            (DFieldX),
+            CallChargeDensity,
+            // clang-format off
+            ((DFieldX) charge_density,
+             (DConstField<IdxRange>) allfdistribu,
+             (DConstFieldVx) quadrature_coeffs,
+             (double) dt),
+            // clang-format on
+            (const));
+
+    DFieldX charge_density_after_transport(
+            DFieldX const charge_density,
+            DConstField<IdxRange> const allfdistribu,
+            DConstFieldVx const quadrature_coeffs,
+            double const dt) const override
+    {
+        return this->CallChargeDensity(charge_density, allfdistribu, quadrature_coeffs, dt);
+    }
 };
 
 class MockAdvectionVx : public IAdvectionVelocity<GeometryXVx, GridVx>
@@ -79,3 +99,33 @@ TEST(SplitVlasovSolver, Ordering)
 
     solver(fdistribu_s, get_const_field(efield), dt);
 }
+
+TEST(SplitVlasovSolver, ChargeDensityOrdering)
+{
+    // A single species so that the species loop is entered once
+    IdxRangeSpXVx const idx_range(IdxSpXVx(0, 0, 0), IdxStepSpXVx(1, 0, 0));
+    DFieldMemSpXVx fdistribu(idx_range);
+    DFieldMemX const efield(ddc::select<GridX>(idx_range));
+    DFieldMemX charge_density(ddc::select<GridX>(idx_range));
+    DFieldMemVx const quadrature_coeffs(ddc::select<GridVx>(idx_range));
+    double const dt = 0.;
+
+    MockAdvectionX const advec_x;
+    MockAdvectionVx const advec_vx;
+    SplitVlasovSolver const solver(advec_x, advec_vx);
+
+    {
+        InSequence s;
+
+        EXPECT_CALL(advec_x, CallOp).WillOnce(ReturnArg<0>());
+        EXPECT_CALL(advec_vx, CallOp).WillOnce(ReturnArg<0>());
+        EXPECT_CALL(advec_x, CallChargeDensity).WillOnce(ReturnArg<0>());
+    }
+
+    solver.charge_density_after_step(
+            get_field(charge_density),
+            get_const_field(fdistribu),
+            get_const_field(efield),
+            get_const_field(quadrature_coeffs),
+            dt);
+}
@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/splines.hpp>
+
+#include <gtest/gtest.h>
+
+#include "bsl_advection_vx.hpp"
+#include "bsl_advection_x.hpp"
+#include "chargedensitycalculator.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_helper.hpp"
+#include "fft_poisson_solver.hpp"
+#include "geometry_xyvxvy.hpp"
+#include "neumann_spline_quadrature.hpp"
+#include "qnsolver.hpp"
+#include "species_info.hpp"
+#include "spline_interpolation.hpp"
+#include "splitvlasovsolver.hpp"
+
+namespace {
+
+int constexpr BSDegree = 3;
+
+struct BSplinesX : ddc::UniformBSplines<X, BSDegree>
+{
+};
+struct BSplinesY : ddc::UniformBSplines<Y, BSDegree>
+{
+};
+struct BSplinesVx : ddc::UniformBSplines<Vx, BSDegree>
+{
+};
+struct BSplinesVy : ddc::UniformBSplines<Vy, BSDegree>
+{
+};
+
+using SplineInterpPointsX = ddc::GrevilleInterpolationPoints<
+        BSplinesX,
+        ddc::BoundCond::PERIODIC,
+        ddc::BoundCond::PERIODIC>;
+using SplineInterpPointsY = ddc::GrevilleInterpolationPoints<
+        BSplinesY,
+        ddc::BoundCond::PERIODIC,
+        ddc::BoundCond::PERIODIC>;
+using SplineInterpPointsVx = ddc::GrevilleInterpolationPoints<
+        BSplinesVx,
+        ddc::BoundCond::HOMOGENEOUS_HERMITE,
+        ddc::BoundCond::HOMOGENEOUS_HERMITE>;
+using SplineInterpPointsVy = ddc::GrevilleInterpolationPoints<
+        BSplinesVy,
+        ddc::BoundCond::HOMOGENEOUS_HERMITE,
+        ddc::BoundCond::HOMOGENEOUS_HERMITE>;
+
+using SplineInterpolatorX = SplineInterpolator<
+        Kokkos::DefaultExecutionSpace,
+        BSplinesX,
+        GridX,
+        PERIODIC,
+        PERIODIC,
+        ddc::BoundCond::PERIODIC,
+        ddc::BoundCond::PERIODIC>;
+using SplineInterpolatorY = SplineInterpolator<
+        Kokkos::DefaultExecutionSpace,
+        BSplinesY,
+        GridY,
+        PERIODIC,
+        PERIODIC,
+        ddc::BoundCond::PERIODIC,
+        ddc::BoundCond::PERIODIC>;
+using SplineInterpolatorVx = SplineInterpolator<
+        Kokkos::DefaultExecutionSpace,
+        BSplinesVx,
+        GridVx,
+        CONSTANT,
+        CONSTANT,
+        ddc::BoundCond::HOMOGENEOUS_HERMITE,
+        ddc::BoundCond::HOMOGENEOUS_HERMITE>;
+using SplineInterpolatorVy = SplineInterpolator<
+        Kokkos::DefaultExecutionSpace,
+        BSplinesVy,
+        GridVy,
+        CONSTANT,
+        CONSTANT,
+        ddc::BoundCond::HOMOGENEOUS_HERMITE,
+        ddc::BoundCond::HOMOGENEOUS_HERMITE>;
+
+using IdxSpVxVyXY = Idx<Species, GridVx, GridVy, GridX, GridY>;
+
+/// Integrate the distribution function over the phase space (up to a constant factor).
+template <class ElementType>
+double compute_mass(
+        ConstFieldSpVxVyXY<ElementType> allfdistribu,
+        DConstFieldVxVy quadrature_coeffs)
+{
+    auto allfdistribu_host = ddc::create_mirror_view_and_copy(allfdistribu);
+    auto quadrature_coeffs_host = ddc::create_mirror_view_and_copy(quadrature_coeffs);
+    double mass = 0.0;
+    ddc::host_for_each(get_idx_range(allfdistribu_host), [&](IdxSpVxVyXY const idx) {
+        mass += quadrature_coeffs_host(IdxVxVy(idx)) * allfdistribu_host(idx);
+    });
+    return mass;
+}
+
+} // namespace
+
+TEST(MixedPrecision, SplitVlasovPoissonConservation)
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(4.0 * M_PI);
+    IdxStepX const x_ncells(16);
+    CoordY const y_min(0.0);
+    CoordY const y_max(4.0 * M_PI);
+    IdxStep<GridY> const y_ncells(8);
+    CoordVx const vx_min(-6.0);
+    CoordVx const vx_max(6.0);
+    IdxStepVx const vx_ncells(15);
+    CoordVy const vy_min(-6.0);
+    CoordVy const vy_max(6.0);
+    IdxStepVy const vy_ncells(15);
+
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_ncells);
+    ddc::init_discrete_space<BSplinesY>(y_min, y_max, y_ncells);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_ncells);
+    ddc::init_discrete_space<BSplinesVy>(vy_min, vy_max, vy_ncells);
+    ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+    ddc::init_discrete_space<GridY>(SplineInterpPointsY::get_sampling<GridY>());
+    ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+    ddc::init_discrete_space<GridVy>(SplineInterpPointsVy::get_sampling<GridVy>());
+
+    IdxRangeX const idx_range_x(SplineInterpPointsX::get_domain<GridX>());
+    IdxRangeY const idx_range_y(SplineInterpPointsY::get_domain<GridY>());
+    IdxRangeVx const idx_range_vx(SplineInterpPointsVx::get_domain<GridVx>());
+    IdxRangeVy const idx_range_vy(SplineInterpPointsVy::get_domain<GridVy>());
+    IdxRangeXY const idx_range_xy(idx_range_x, idx_range_y);
+    IdxRangeVxVy const idx_range_vxvy(idx_range_vx, idx_range_vy);
+
+    IdxRangeSp const idx_range_sp(IdxSp(0), IdxStepSp(1));
+    host_t<DFieldMemSp> charges(idx_range_sp);
+    host_t<DFieldMemSp> masses(idx_range_sp);
+    charges(idx_range_sp.front()) = -1.;
+    masses(idx_range_sp.front()) = 1.;
+    ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+
+    IdxRangeSpVxVyXY const idx_range(idx_range_sp, idx_range_vxvy, idx_range_xy);
+
+    // Operators
+    SplineInterpolatorX const interpolator_x(idx_range_x);
+    SplineInterpolatorY const interpolator_y(idx_range_y);
+    SplineInterpolatorVx const interpolator_vx(idx_range_vx);
+    SplineInterpolatorVy const interpolator_vy(idx_range_vy);
+
+    BslAdvectionSpatial<GeometryVxVyXY, SplineInterpolatorX> const advection_x(interpolator_x);
+    BslAdvectionSpatial<GeometryVxVyXY, SplineInterpolatorY> const advection_y(interpolator_y);
+    BslAdvectionVelocity<GeometryVxVyXY, SplineInterpolatorVx> const advection_vx(
+            interpolator_vx);
+    BslAdvectionVelocity<GeometryVxVyXY, SplineInterpolatorVy> const advection_vy(
+            interpolator_vy);
+    SplitVlasovSolver const vlasov(advection_x, advection_y, advection_vx, advection_vy);
+
+    DFieldMemVxVy const quadrature_coeffs(
+            neumann_spline_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(
+                    idx_range_vxvy,
+                    interpolator_vx.get_builder(),
+                    interpolator_vy.get_builder()));
+    FFTPoissonSolver<IdxRangeXY> fft_poisson_solver(idx_range_xy);
+    ChargeDensityCalculator const rhs(get_const_field(quadrature_coeffs));
+    QNSolver const poisson(fft_poisson_solver, rhs);
+
+    // Initial condition: perturbed Maxwellian
+    host_t<DFieldMemSpVxVyXY> allfdistribu_host(idx_range);
+    ddc::host_for_each(idx_range, [&](IdxSpVxVyXY const idx) {
+        double const x = ddc::coordinate(ddc::select<GridX>(idx));
+        double const y = ddc::coordinate(ddc::select<GridY>(idx));
+        double const vx = ddc::coordinate(ddc::select<GridVx>(idx));
+        double const vy = ddc::coordinate(ddc::select<GridVy>(idx));
+        allfdistribu_host(idx) = (1.0 + 0.05 * std::cos(0.5 * x) + 0.05 * std::cos(0.5 * y))
+                                 * std::exp(-0.5 * (vx * vx + vy * vy)) / (2.0 * M_PI);
+    });
+    DFieldMemSpVxVyXY allfdistribu_double(idx_range);
+    ddc::parallel_deepcopy(allfdistribu_double, allfdistribu_host);
+    FieldMemSpVxVyXY<float> allfdistribu_float(idx_range);
+    ddcHelper::convert_deepcopy(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(allfdistribu_float),
+            get_const_field(allfdistribu_double));
+
+    DFieldMemXY electrostatic_potential(idx_range_xy);
+    DVectorFieldMemXY electric_field(idx_range_xy);
+
+    double const mass_init
+            = compute_mass(get_const_field(allfdistribu_double), get_const_field(quadrature_coeffs));
+
+    double const dt = 0.1;
+    int const nbiter = 10;
+    for (int iter(0); iter < nbiter; ++iter) {
+        poisson(get_field(electrostatic_potential),
+                get_field(electric_field),
+                get_const_field(allfdistribu_double));
+        vlasov(get_field(allfdistribu_double), get_const_field(electric_field), dt);
+
+        poisson(get_field(electrostatic_potential),
+                get_field(electric_field),
+                get_const_field(allfdistribu_float));
+        vlasov(get_field(allfdistribu_float), get_const_field(electric_field), dt);
+    }
+
+    double const mass_error_double
+            = std::abs(
+                      compute_mass(
+                              get_const_field(allfdistribu_double),
+                              get_const_field(quadrature_coeffs))
+                      - mass_init)
+              / mass_init;
+    double const mass_error_float
+            = std::abs(
+                      compute_mass(
+                              get_const_field(allfdistribu_float),
+                              get_const_field(quadrature_coeffs))
+                      - mass_init)
+              / mass_init;
+
+    // The single precision storage only adds rounding errors to the conservation error
+    EXPECT_LE(mass_error_double, 1e-6);
+    EXPECT_LE(mass_error_float, mass_error_double + 1e-5);
+
+    // The two runs remain close
+    auto allfdistribu_double_host = ddc::create_mirror_view_and_copy(get_field(allfdistribu_double));
+    auto allfdistribu_float_host = ddc::create_mirror_view_and_copy(get_field(allfdistribu_float));
+    double max_f = 0.0;
+    double max_diff = 0.0;
+    ddc::host_for_each(idx_range, [&](IdxSpVxVyXY const idx) {
+        max_f = std::max(max_f, std::abs(allfdistribu_double_host(idx)));
+        max_diff = std::max(
+                max_diff,
+                std::abs(allfdistribu_double_host(idx) - allfdistribu_float_host(idx)));
+    });
+    EXPECT_LE(max_diff / max_f, 1e-5);
+}
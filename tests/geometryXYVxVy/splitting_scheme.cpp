@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "splitting_scheme.hpp"
+
+namespace {
+
+using Matrix2D = std::array<std::array<double, 2>, 2>;
+
+Matrix2D multiply(Matrix2D const& a, Matrix2D const& b)
+{
+    Matrix2D result {};
+    for (int i(0); i < 2; ++i) {
+        for (int j(0); j < 2; ++j) {
+            result[i][j] = a[i][0] * b[0][j] + a[i][1] * b[1][j];
+        }
+    }
+    return result;
+}
+
+/**
+ * Apply the splitting scheme to the operators A = [[0, 1], [0, 0]] and B = [[0, 0], [1, 0]]
+ * whose flows are known exactly, and return the error compared to the flow of A + B.
+ * These operators mimic the free streaming and the acceleration of the Vlasov equation.
+ */
+double splitting_error(SplittingScheme const& scheme, double dt)
+{
+    Matrix2D result {{{1, 0}, {0, 1}}};
+    int const n_velocity_stages = scheme.get_n_velocity_stages();
+    for (int stage(0); stage <= n_velocity_stages; ++stage) {
+        double const a = scheme.get_spatial_coeff(stage) * dt;
+        result = multiply(Matrix2D {{{1, a}, {0, 1}}}, result);
+        if (stage < n_velocity_stages) {
+            double const b = scheme.get_velocity_coeff(stage) * dt;
+            result = multiply(Matrix2D {{{1, 0}, {b, 1}}}, result);
+        }
+    }
+    Matrix2D const exact {{{std::cosh(dt), std::sinh(dt)}, {std::sinh(dt), std::cosh(dt)}}};
+    double error = 0.0;
+    for (int i(0); i < 2; ++i) {
+        for (int j(0); j < 2; ++j) {
+            error = std::max(error, std::abs(result[i][j] - exact[i][j]));
+        }
+    }
+    return error;
+}
+
+void check_order(SplittingMethod method, int order)
+{
+    SplittingScheme const scheme(method);
+    int const n_velocity_stages = scheme.get_n_velocity_stages();
+
+    double sum_spatial = 0.0;
+    double sum_velocity = 0.0;
+    for (int stage(0); stage <= n_velocity_stages; ++stage) {
+        sum_spatial += scheme.get_spatial_coeff(stage);
+        EXPECT_DOUBLE_EQ(
+                scheme.get_spatial_coeff(stage),
+                scheme.get_spatial_coeff(n_velocity_stages - stage));
+    }
+    for (int stage(0); stage < n_velocity_stages; ++stage) {
+        sum_velocity += scheme.get_velocity_coeff(stage);
+        EXPECT_DOUBLE_EQ(
+                scheme.get_velocity_coeff(stage),
+                scheme.get_velocity_coeff(n_velocity_stages - 1 - stage));
+    }
+    EXPECT_NEAR(sum_spatial, 1.0, 1e-14);
+    EXPECT_NEAR(sum_velocity, 1.0, 1e-14);
+
+    // The local error is of order dt^(order+1)
+    double const dt = 0.2;
+    double const error_ratio = splitting_error(scheme, dt) / splitting_error(scheme, dt / 2);
+    double const order_measured = std::log2(error_ratio) - 1;
+    EXPECT_NEAR(order_measured, order, 0.1);
+}
+
+} // namespace
+
+TEST(SplittingScheme, Strang)
+{
+    check_order(SplittingMethod::Strang, 2);
+}
+
+TEST(SplittingScheme, ForestRuth)
+{
+    check_order(SplittingMethod::ForestRuth, 4);
+}
+
+TEST(SplittingScheme, BlanesMoan)
+{
+    check_order(SplittingMethod::BlanesMoan, 4);
+}
@@ -388,3 +388,87 @@ TYPED_TEST(LagrangePeriodicEvaluatorFixture, Convergence)
         }
     }
 }
+
+namespace {
+
+struct GridShiftY : UniformGridBase<Y>
+{
+};
+
+struct LagBasisShiftY : UniformLagrangeBasis<Y, 3, double>
+{
+};
+
+} // namespace
+
+TEST(LagrangeEvaluator, ConstantShiftReusesBasis)
+{
+    using Builder = IdentityInterpolationBuilder<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            double,
+            GridShiftY,
+            LagBasisShiftY>;
+    using Evaluator = LagrangeEvaluator<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            double,
+            LagBasisShiftY,
+            GridShiftY,
+            ddc::PeriodicExtrapolationRule<Y>,
+            ddc::PeriodicExtrapolationRule<Y>>;
+    using IdxRangeCoeff = typename Builder::template batched_basis_idx_range_type<
+            IdxRange<GridShiftY>>;
+
+    Coord<Y> const ymin(0);
+    Coord<Y> const ymax(2 * Kokkos::numbers::pi);
+    std::size_t const ncells(32);
+    ddc::init_discrete_space<GridShiftY>(
+            GridShiftY::init(ymin, ymax, IdxStep<GridShiftY>(ncells + 1)));
+    IdxRange<GridShiftY> const idx_range(Idx<GridShiftY>(0), IdxStep<GridShiftY>(ncells));
+    ddc::init_discrete_space<LagBasisShiftY>(
+            IdxRange<GridShiftY>(Idx<GridShiftY>(0), IdxStep<GridShiftY>(ncells + 1)));
+
+    DFieldMem<IdxRange<GridShiftY>> function_values_alloc(idx_range);
+    DField<IdxRange<GridShiftY>> function_values = get_field(function_values_alloc);
+    FieldMem<Coord<Y>, IdxRange<GridShiftY>> feet_alloc(idx_range);
+    Field<Coord<Y>, IdxRange<GridShiftY>> feet = get_field(feet_alloc);
+    double const shift = 0.37 * (ymax - ymin) / ncells;
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            idx_range,
+            KOKKOS_LAMBDA(Idx<GridShiftY> const i) {
+                function_values(i) = Kokkos::cos(ddc::coordinate(i));
+                feet(i) = ddc::coordinate(i) - shift;
+            });
+
+    Builder const builder;
+    DFieldMem<IdxRangeCoeff> lagrange_coeffs_alloc(
+            ddc::discrete_space<LagBasisShiftY>().full_domain());
+    builder(get_field(lagrange_coeffs_alloc), get_const_field(function_values));
+    DConstField<IdxRangeCoeff> lagrange_coeffs = get_const_field(lagrange_coeffs_alloc);
+
+    ddc::PeriodicExtrapolationRule<Y> extrapol;
+    Evaluator const evaluator(extrapol, extrapol);
+
+    // Batched evaluation, which shares the values of the basis between the feet
+    DFieldMem<IdxRange<GridShiftY>> batched_values_alloc(idx_range);
+    evaluator(get_field(batched_values_alloc), get_const_field(feet), lagrange_coeffs);
+
+    // Point-wise evaluation
+    DFieldMem<IdxRange<GridShiftY>> point_values_alloc(idx_range);
+    DField<IdxRange<GridShiftY>> point_values = get_field(point_values_alloc);
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            idx_range,
+            KOKKOS_LAMBDA(Idx<GridShiftY> const i) {
+                point_values(i) = evaluator(feet(i), lagrange_coeffs);
+            });
+
+    auto batched_values_host = ddc::create_mirror_view_and_copy(get_field(batched_values_alloc));
+    auto point_values_host = ddc::create_mirror_view_and_copy(point_values);
+    ddc::host_for_each(idx_range, [&](Idx<GridShiftY> const i) {
+        EXPECT_NEAR(batched_values_host(i), point_values_host(i), 1e-14);
+        EXPECT_NEAR(batched_values_host(i), std::cos(ddc::coordinate(i) - shift), 1e-4);
+    });
+}
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: MIT
+#include <chrono>
+#include <cstdlib>
+#include <sstream>
+#include <thread>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include "region_annotations.hpp"
+#include "region_profiler.hpp"
+
+namespace {
+
+void wait_for(double seconds)
+{
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+}
+
+} // namespace
+
+TEST(RegionProfiler, NestedRegions)
+{
+    RegionProfilingOptions options;
+    options.fence_at_region_boundaries = false;
+    start_region_profiling(options);
+    ASSERT_TRUE(region_profiling_is_active());
+
+    for (int i(0); i < 2; ++i) {
+        Kokkos::Profiling::pushRegion("(GSLX) Outer");
+        wait_for(0.02);
+        Kokkos::Profiling::pushRegion("Not profiled");
+        Kokkos::Profiling::pushRegion("(GSLX) Inner");
+        annotate_region_bytes(1000);
+        wait_for(0.01);
+        Kokkos::Profiling::popRegion();
+        Kokkos::Profiling::popRegion();
+        Kokkos::Profiling::popRegion();
+    }
+
+    std::vector<RegionProfile> const profiles = get_region_profiles();
+    stop_region_profiling();
+    EXPECT_FALSE(region_profiling_is_active());
+
+    ASSERT_EQ(profiles.size(), 2);
+    RegionProfile const& inner = profiles[0];
+    RegionProfile const& outer = profiles[1];
+    EXPECT_EQ(inner.name, "(GSLX) Inner");
+    EXPECT_EQ(outer.name, "(GSLX) Outer");
+
+    EXPECT_EQ(inner.n_ranks, 1);
+    EXPECT_DOUBLE_EQ(inner.calls, 2);
+    EXPECT_DOUBLE_EQ(outer.calls, 2);
+    EXPECT_DOUBLE_EQ(inner.bytes, 2000);
+    EXPECT_DOUBLE_EQ(outer.bytes, 0);
+
+    EXPECT_GE(inner.inclusive_mean, 0.02);
+    EXPECT_DOUBLE_EQ(inner.inclusive_mean, inner.exclusive_mean);
+    EXPECT_GE(outer.exclusive_mean, 0.04);
+    EXPECT_NEAR(outer.inclusive_mean - outer.exclusive_mean, inner.inclusive_mean, 1e-12);
+    EXPECT_DOUBLE_EQ(outer.inclusive_min, outer.inclusive_max);
+
+    std::stringstream summary;
+    print_region_profiles(summary, profiles);
+    EXPECT_NE(summary.str().find("(GSLX) Inner"), std::string::npos);
+    EXPECT_NE(summary.str().find("(GSLX) Outer"), std::string::npos);
+}
+
+TEST(RegionProfiler, Restart)
+{
+    start_region_profiling();
+    Kokkos::Profiling::pushRegion("(GSLX) First");
+    Kokkos::Profiling::popRegion();
+    stop_region_profiling();
+
+    // Regions pushed while the profiler is stopped are ignored
+    Kokkos::Profiling::pushRegion("(GSLX) Ignored");
+    Kokkos::Profiling::popRegion();
+
+    start_region_profiling();
+    Kokkos::Profiling::pushRegion("(GSLX) Second");
+    Kokkos::Profiling::popRegion();
+    std::vector<RegionProfile> const profiles = get_region_profiles();
+    stop_region_profiling();
+
+    ASSERT_EQ(profiles.size(), 1);
+    EXPECT_EQ(profiles[0].name, "(GSLX) Second");
+}
+
+TEST(RegionProfiler, EnvironmentOptIn)
+{
+    unsetenv("GSLX_REGION_PROFILING");
+    EXPECT_FALSE(start_region_profiling_if_requested());
+    EXPECT_FALSE(region_profiling_is_active());
+
+    setenv("GSLX_REGION_PROFILING", "1", 1);
+    EXPECT_TRUE(start_region_profiling_if_requested());
+    EXPECT_TRUE(region_profiling_is_active());
+    stop_region_profiling();
+    unsetenv("GSLX_REGION_PROFILING");
+}
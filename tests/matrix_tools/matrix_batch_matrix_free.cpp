@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "matrix_batch_matrix_free.hpp"
+
+namespace {
+
+using BatchedView = Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::DefaultExecutionSpace>;
+
+/// A tridiagonal stencil whose diagonal depends on the system.
+struct TridiagonalStencil
+{
+    int mat_size;
+    double sub_diag;
+    double diag;
+    double up_diag;
+
+    template <class VectorType>
+    KOKKOS_FUNCTION double operator()(int batch_idx, int row, VectorType const& x) const
+    {
+        double res = (diag + 0.5 * batch_idx) * x(row);
+        if (row > 0) {
+            res += sub_diag * x(row - 1);
+        }
+        if (row < mat_size - 1) {
+            res += up_diag * x(row + 1);
+        }
+        return res;
+    }
+};
+
+template <MatrixBatchMatrixFreeSolver Solver>
+void solve_and_check(TridiagonalStencil const& stencil, int const batch_size, double const tol)
+{
+    int const mat_size = stencil.mat_size;
+    Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::DefaultHostExecutionSpace>
+            rhs_host("rhs_host", batch_size, mat_size);
+    for (int batch_idx = 0; batch_idx < batch_size; ++batch_idx) {
+        for (int i = 0; i < mat_size; ++i) {
+            rhs_host(batch_idx, i) = std::sin(0.3 * i + batch_idx);
+        }
+    }
+    BatchedView x("x", batch_size, mat_size);
+    Kokkos::deep_copy(x, rhs_host);
+
+    MatrixBatchMatrixFree<Kokkos::DefaultExecutionSpace, TridiagonalStencil, Solver>
+            matrix(batch_size, mat_size, stencil, 1000, tol);
+    matrix.setup_solver();
+    matrix.solve(x);
+
+    auto x_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x);
+    for (int batch_idx = 0; batch_idx < batch_size; ++batch_idx) {
+        auto x_k = Kokkos::subview(x_host, batch_idx, Kokkos::ALL);
+        for (int i = 0; i < mat_size; ++i) {
+            EXPECT_NEAR(stencil(batch_idx, i, x_k), rhs_host(batch_idx, i), 1e-10);
+        }
+    }
+}
+
+} // namespace
+
+TEST(MatrixBatchMatrixFree, SymmetricCG)
+{
+    solve_and_check<MatrixBatchMatrixFreeSolver::CG>(
+            TridiagonalStencil {50, -1., 2., -1.},
+            3,
+            1e-13);
+}
+
+TEST(MatrixBatchMatrixFree, SymmetricBiCGStab)
+{
+    solve_and_check<MatrixBatchMatrixFreeSolver::BICGSTAB>(
+            TridiagonalStencil {50, -1., 2., -1.},
+            3,
+            1e-13);
+}
+
+TEST(MatrixBatchMatrixFree, NonSymmetricBiCGStab)
+{
+    solve_and_check<MatrixBatchMatrixFreeSolver::BICGSTAB>(
+            TridiagonalStencil {50, -1.2, 2.5, -0.8},
+            3,
+            1e-13);
+}
+
+TEST(MatrixBatchMatrixFree, NotConverged)
+{
+    int const batch_size = 2;
+    int const mat_size = 50;
+    BatchedView x("x", batch_size, mat_size);
+    Kokkos::deep_copy(x, 1.);
+    TridiagonalStencil const stencil {mat_size, -1., 2., -1.};
+    MatrixBatchMatrixFree<
+            Kokkos::DefaultExecutionSpace,
+            TridiagonalStencil,
+            MatrixBatchMatrixFreeSolver::CG> const matrix(batch_size, mat_size, stencil, 2, 1e-13);
+    EXPECT_THROW(matrix.solve(x), std::runtime_error);
+}
@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: MIT
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "mpihaloexchange.hpp"
+#include "mpilayout.hpp"
+
+namespace {
+
+struct X
+{
+};
+struct Y
+{
+};
+
+struct GridX : UniformGridBase<X>
+{
+};
+struct GridY : UniformGridBase<Y>
+{
+};
+struct GridXHalo : UniformGridBase<X>
+{
+};
+struct GridYHalo : UniformGridBase<Y>
+{
+};
+
+using IdxX = Idx<GridX>;
+using IdxY = Idx<GridY>;
+using IdxXY = Idx<GridX, GridY>;
+using IdxYX = Idx<GridY, GridX>;
+using IdxXHalo = Idx<GridXHalo>;
+using IdxYHalo = Idx<GridYHalo>;
+
+using IdxStepX = IdxStep<GridX>;
+using IdxStepY = IdxStep<GridY>;
+
+using IdxRangeX = IdxRange<GridX>;
+using IdxRangeY = IdxRange<GridY>;
+using IdxRangeXY = IdxRange<GridX, GridY>;
+using IdxRangeYX = IdxRange<GridY, GridX>;
+
+using XDistribLayout = MPILayout<IdxRangeYX, GridX>;
+using XYDistribLayout = MPILayout<IdxRangeXY, GridX, GridY>;
+
+int get_rank()
+{
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    return rank;
+}
+
+int get_size()
+{
+    int size;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    return size;
+}
+
+} // namespace
+
+TEST(MPIParallelisation, HaloExchange1D)
+{
+    IdxRangeX const global_idx_range_x(IdxX(0), IdxStepX(12));
+    IdxRangeY const global_idx_range_y(IdxY(0), IdxStepY(5));
+    IdxRangeYX const global_idx_range(global_idx_range_y, global_idx_range_x);
+    int const nx = global_idx_range_x.size();
+    int const halo_width = 3;
+
+    IdxRangeYX const local_idx_range
+            = XDistribLayout::distribute_idx_range(global_idx_range, get_size(), get_rank());
+    IdxRangeX const local_idx_range_x(local_idx_range);
+
+    MPIHaloExchange<GridX, GridXHalo> const halo_exchange(
+            MPI_COMM_WORLD,
+            local_idx_range,
+            halo_width);
+
+    host_t<DFieldMem<IdxRangeYX>> local_alloc(local_idx_range);
+    ddc::host_for_each(local_idx_range, [&](IdxYX iyx) {
+        local_alloc(iyx) = 100 * (IdxY(iyx) - IdxY(0)) + (IdxX(iyx) - IdxX(0));
+    });
+
+    auto const halo_idx_range = halo_exchange.get_halo_idx_range(local_idx_range);
+    host_t<DFieldMem<decltype(halo_idx_range)>> halo_alloc(halo_idx_range);
+    EXPECT_EQ(IdxRange<GridXHalo>(halo_idx_range).size(), local_idx_range_x.size() + 2 * halo_width);
+
+    halo_exchange(
+            Kokkos::DefaultHostExecutionSpace(),
+            get_field(halo_alloc),
+            get_const_field(local_alloc));
+
+    int const local_start = local_idx_range_x.front() - IdxX(0);
+    bool success = true;
+    ddc::host_for_each(halo_idx_range, [&](Idx<GridY, GridXHalo> iyx) {
+        int const global_ix = (local_start - halo_width + (IdxXHalo(iyx) - IdxXHalo(0)) + nx) % nx;
+        double const expected = 100 * (IdxY(iyx) - IdxY(0)) + global_ix;
+        success = success and (halo_alloc(iyx) == expected);
+    });
+    EXPECT_TRUE(success);
+}
+
+TEST(MPIParallelisation, HaloExchange2D)
+{
+    IdxRangeX const global_idx_range_x(IdxX(0), IdxStepX(8));
+    IdxRangeY const global_idx_range_y(IdxY(0), IdxStepY(6));
+    IdxRangeXY const global_idx_range(global_idx_range_x, global_idx_range_y);
+    int const nx = global_idx_range_x.size();
+    int const ny = global_idx_range_y.size();
+    int const halo_width = 2;
+
+    IdxRangeXY const local_idx_range
+            = XYDistribLayout::distribute_idx_range(global_idx_range, get_size(), get_rank());
+    IdxRangeX const local_idx_range_x(local_idx_range);
+
+    MPIHaloExchange<GridX, GridXHalo> const halo_exchange_x(
+            MPI_COMM_WORLD,
+            local_idx_range,
+            halo_width);
+    MPIHaloExchange<GridY, GridYHalo> const halo_exchange_y(
+            MPI_COMM_WORLD,
+            local_idx_range,
+            halo_width);
+
+    host_t<DFieldMem<IdxRangeXY>> local_alloc(local_idx_range);
+    ddc::host_for_each(local_idx_range, [&](IdxXY ixy) {
+        local_alloc(ixy) = 100 * (IdxX(ixy) - IdxX(0)) + (IdxY(ixy) - IdxY(0));
+    });
+
+    // Exchange along x
+    auto const halo_idx_range_x = halo_exchange_x.get_halo_idx_range(local_idx_range);
+    host_t<DFieldMem<decltype(halo_idx_range_x)>> halo_x_alloc(halo_idx_range_x);
+    halo_exchange_x(
+            Kokkos::DefaultHostExecutionSpace(),
+            get_field(halo_x_alloc),
+            get_const_field(local_alloc));
+
+    int const local_start_x = local_idx_range_x.front() - IdxX(0);
+    bool success = true;
+    ddc::host_for_each(halo_idx_range_x, [&](Idx<GridXHalo, GridY> ixy) {
+        int const global_ix
+                = (local_start_x - halo_width + (IdxXHalo(ixy) - IdxXHalo(0)) + nx) % nx;
+        double const expected = 100 * global_ix + (IdxY(ixy) - IdxY(0));
+        success = success and (halo_x_alloc(ixy) == expected);
+    });
+    EXPECT_TRUE(success);
+
+    // Exchange along y
+    auto const halo_idx_range_y = halo_exchange_y.get_halo_idx_range(local_idx_range);
+    host_t<DFieldMem<decltype(halo_idx_range_y)>> halo_y_alloc(halo_idx_range_y);
+    halo_exchange_y(
+            Kokkos::DefaultHostExecutionSpace(),
+            get_field(halo_y_alloc),
+            get_const_field(local_alloc));
+
+    int const local_start_y = IdxRangeY(local_idx_range).front() - IdxY(0);
+    ddc::host_for_each(halo_idx_range_y, [&](Idx<GridX, GridYHalo> ixy) {
+        int const global_iy
+                = (local_start_y - halo_width + (IdxYHalo(ixy) - IdxYHalo(0)) + ny) % ny;
+        double const expected = 100 * (IdxX(ixy) - IdxX(0)) + global_iy;
+        success = success and (halo_y_alloc(ixy) == expected);
+    });
+    EXPECT_TRUE(success);
+}
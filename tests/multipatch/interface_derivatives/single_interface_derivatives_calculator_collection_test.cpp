@@ -298,4 +298,77 @@ TEST_F(SingleInterfaceDerivativesCalculatorCollectionTest, CheckCallToOperators)
             deriv_calculators_collect,
             derivatives_calculator_1_2,
             derivatives_calculator_2_3);
-}
\ No newline at end of file
+}
+
+TEST_F(SingleInterfaceDerivativesCalculatorCollectionTest, CheckDeviceFunctionCoefficients)
+{
+    SingleInterfaceDerivativesCalculatorCollection
+            deriv_calculators_collect(derivatives_calculator_1_2, derivatives_calculator_2_3);
+
+    // Instantiate test function values ==========================================================
+    host_t<DFieldMemOnPatch<Patch1>> function_1_host_alloc(idx_range_xy1);
+    host_t<DFieldMemOnPatch<Patch2>> function_2_host_alloc(idx_range_xy2);
+    host_t<DFieldMemOnPatch<Patch3>> function_3_host_alloc(idx_range_xy3);
+
+    host_t<DFieldOnPatch<Patch1>> function_1_host(get_field(function_1_host_alloc));
+    host_t<DFieldOnPatch<Patch2>> function_2_host(get_field(function_2_host_alloc));
+    host_t<DFieldOnPatch<Patch3>> function_3_host(get_field(function_3_host_alloc));
+
+    MultipatchField<DFieldOnPatch_host, Patch1, Patch2, Patch3>
+            functions_host(function_1_host, function_2_host, function_3_host);
+    initialise_all_functions(functions_host);
+
+    DFieldMemOnPatch<Patch1> function_1_alloc(idx_range_xy1);
+    DFieldMemOnPatch<Patch2> function_2_alloc(idx_range_xy2);
+    DFieldMemOnPatch<Patch3> function_3_alloc(idx_range_xy3);
+    ddc::parallel_deepcopy(get_field(function_1_alloc), get_const_field(function_1_host));
+    ddc::parallel_deepcopy(get_field(function_2_alloc), get_const_field(function_2_host));
+    ddc::parallel_deepcopy(get_field(function_3_alloc), get_const_field(function_3_host));
+
+    MultipatchField<DConstFieldOnPatch, Patch1, Patch2, Patch3> functions(
+            get_const_field(function_1_alloc),
+            get_const_field(function_2_alloc),
+            get_const_field(function_3_alloc));
+
+    // Compute the coefficients on device ========================================================
+    DFieldMem<IdxRange<GridY<1>>> coeffs_12_alloc(idx_range_y1);
+    DFieldMem<IdxRange<GridY<2>>> coeffs_23_alloc(idx_range_y2);
+    deriv_calculators_collect.get_function_coefficients(
+            Kokkos::DefaultExecutionSpace(),
+            std::make_tuple(get_field(coeffs_12_alloc), get_field(coeffs_23_alloc)),
+            functions);
+
+    // Same computation interface by interface.
+    DFieldMem<IdxRange<GridY<1>>> coeffs_12_single_alloc(idx_range_y1);
+    derivatives_calculator_1_2.get_function_coefficients(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(coeffs_12_single_alloc),
+            get_const_field(function_1_alloc),
+            get_const_field(function_2_alloc));
+
+    auto coeffs_12_host = ddc::create_mirror_view_and_copy(get_field(coeffs_12_alloc));
+    auto coeffs_23_host = ddc::create_mirror_view_and_copy(get_field(coeffs_23_alloc));
+    auto coeffs_12_single_host
+            = ddc::create_mirror_view_and_copy(get_field(coeffs_12_single_alloc));
+
+    // Compare with the host computation =========================================================
+    ddc::host_for_each(idx_range_y1, [&](Idx<GridY<1>> const idx_y1) {
+        Idx<GridY<2>> const idx_y2
+                = idx_range_y2.front()
+                  + IdxStep<GridY<2>>((idx_y1 - idx_range_y1.front()).value());
+        double const expected = derivatives_calculator_1_2.get_function_coefficients(
+                get_const_field(function_1_host[idx_y1]),
+                get_const_field(function_2_host[idx_y2]));
+        EXPECT_NEAR(coeffs_12_host(idx_y1), expected, 1e-12);
+        EXPECT_NEAR(coeffs_12_single_host(idx_y1), expected, 1e-12);
+    });
+    ddc::host_for_each(idx_range_y2, [&](Idx<GridY<2>> const idx_y2) {
+        Idx<GridY<3>> const idx_y3
+                = idx_range_y3.front()
+                  + IdxStep<GridY<3>>((idx_y2 - idx_range_y2.front()).value());
+        double const expected = derivatives_calculator_2_3.get_function_coefficients(
+                get_const_field(function_2_host[idx_y2]),
+                get_const_field(function_3_host[idx_y3]));
+        EXPECT_NEAR(coeffs_23_host(idx_y2), expected, 1e-12);
+    });
+}
@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: MIT
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "buffer_version.hpp"
+#include "cached_field_solver.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+
+namespace {
+
+struct X
+{
+    /// @brief A boolean indicating if the dimension is periodic.
+    static bool constexpr PERIODIC = true;
+};
+
+using CoordX = Coord<X>;
+
+struct GridX : UniformGridBase<X>
+{
+};
+
+using IdxX = Idx<GridX>;
+using IdxStepX = IdxStep<GridX>;
+using IdxRangeX = IdxRange<GridX>;
+
+using DFieldMemX = DFieldMem<IdxRangeX>;
+using DFieldX = DField<IdxRangeX>;
+using DConstFieldX = DConstField<IdxRangeX>;
+
+/// A field solver which counts its calls. The potential is a copy of the source and the field
+/// contains the number of calls.
+class CountingFieldSolver
+{
+    mutable int m_n_calls = 0;
+
+public:
+    void operator()(DFieldX potential, DFieldX electric_field, DConstFieldX source) const
+    {
+        m_n_calls++;
+        ddc::parallel_deepcopy(potential, source);
+        ddc::parallel_fill(electric_field, m_n_calls);
+    }
+
+    int get_n_calls() const
+    {
+        return m_n_calls;
+    }
+};
+
+} // namespace
+
+TEST(CachedFieldSolver, SkipsUnchangedSource)
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(1.0);
+    IdxStepX const x_size(10);
+    ddc::init_discrete_space<GridX>(GridX::init<GridX>(x_min, x_max, x_size + 1));
+    IdxRangeX const idx_range_x(IdxX(0), x_size);
+
+    DFieldMemX tracked_source(idx_range_x);
+    DFieldMemX other_source(idx_range_x);
+    ddc::parallel_fill(get_field(tracked_source), 1.0);
+    ddc::parallel_fill(get_field(other_source), 2.0);
+
+    DFieldMemX potential(idx_range_x);
+    DFieldMemX electric_field(idx_range_x);
+
+    CountingFieldSolver const field_solver;
+    BufferVersion source_version(get_field(tracked_source));
+    CachedFieldSolver<CountingFieldSolver, DFieldMemX, DFieldMemX> const
+            cached_solver(field_solver, source_version, idx_range_x);
+
+    cached_solver(
+            get_field(potential),
+            get_field(electric_field),
+            get_const_field(tracked_source));
+    EXPECT_EQ(field_solver.get_n_calls(), 1);
+
+    // The source has not changed so the stored results are returned
+    ddc::parallel_fill(get_field(potential), 0.0);
+    cached_solver(
+            get_field(potential),
+            get_field(electric_field),
+            get_const_field(tracked_source));
+    EXPECT_EQ(field_solver.get_n_calls(), 1);
+    auto potential_host = ddc::create_mirror_view_and_copy(get_field(potential));
+    auto electric_field_host = ddc::create_mirror_view_and_copy(get_field(electric_field));
+    for (IdxX const ix : idx_range_x) {
+        EXPECT_EQ(potential_host(ix), 1.0);
+        EXPECT_EQ(electric_field_host(ix), 1.0);
+    }
+
+    // Other buffers are always solved and do not replace the stored results
+    cached_solver(get_field(potential), get_field(electric_field), get_const_field(other_source));
+    cached_solver(get_field(potential), get_field(electric_field), get_const_field(other_source));
+    EXPECT_EQ(field_solver.get_n_calls(), 3);
+    cached_solver(
+            get_field(potential),
+            get_field(electric_field),
+            get_const_field(tracked_source));
+    EXPECT_EQ(field_solver.get_n_calls(), 3);
+
+    // A new version of the source is solved again
+    source_version.increment();
+    cached_solver(
+            get_field(potential),
+            get_field(electric_field),
+            get_const_field(tracked_source));
+    EXPECT_EQ(field_solver.get_n_calls(), 4);
+}
@@ -23,3 +23,25 @@ TEST(SpeciesInfo, Ielec)
     ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
     EXPECT_EQ(my_ielec, ielec());
 }
+
+TEST(SpeciesInfo, MassRatios)
+{
+    IdxStepSp const nb_kinspecies(2);
+    IdxRangeSp const idx_range_sp(IdxSp(0), nb_kinspecies);
+    IdxSp my_iion = idx_range_sp.front();
+    IdxSp my_ielec = idx_range_sp.back();
+
+    host_t<DFieldMemSp> charges(idx_range_sp);
+    host_t<DFieldMemSp> masses(idx_range_sp);
+    charges(my_ielec) = -1.;
+    charges(my_iion) = 2.;
+    masses(my_ielec) = 1.;
+    masses(my_iion) = 400.;
+
+    SpeciesInformation::Impl<Species, Kokkos::HostSpace> const
+            species_info(std::move(charges), std::move(masses));
+    EXPECT_DOUBLE_EQ(species_info.sqrt_me_on_mass(my_ielec), 1.);
+    EXPECT_DOUBLE_EQ(species_info.sqrt_me_on_mass(my_iion), 0.05);
+    EXPECT_DOUBLE_EQ(species_info.charge_on_mass(my_ielec), -1.);
+    EXPECT_DOUBLE_EQ(species_info.charge_on_mass(my_iion), 0.005);
+}
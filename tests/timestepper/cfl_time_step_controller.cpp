@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: MIT
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "cfl_time_step_controller.hpp"
+
+namespace {
+
+struct R
+{
+    bool PERIODIC = false;
+};
+
+struct GridR : NonUniformGridBase<R>
+{
+};
+
+} // namespace
+
+TEST(CFLTimeStepController, CFLCondition)
+{
+    CFLTimeStepController const controller(0.5, 0.01, 0.1, 1.0);
+
+    // dt = cfl / rate = 0.05 divides the output interval exactly
+    EXPECT_DOUBLE_EQ(controller.get_time_step(10.0, 1.0), 0.05);
+    // The maximum time step is used when the advection field is small or zero
+    EXPECT_DOUBLE_EQ(controller.get_time_step(1.0, 1.0), 0.1);
+    EXPECT_DOUBLE_EQ(controller.get_time_step(0.0, 1.0), 0.1);
+    // The minimum time step is used when the advection field is large
+    EXPECT_DOUBLE_EQ(controller.get_time_step(1000.0, 1.0), 0.01);
+}
+
+TEST(CFLTimeStepController, OutputTimes)
+{
+    CFLTimeStepController const controller(0.5, 0.01, 0.1, 1.0);
+
+    // The last step before an output finishes exactly on the output time
+    EXPECT_EQ(controller.get_time_step(10.0, 0.03), 0.03);
+    EXPECT_EQ(controller.get_time_step(10.0, 0.005), 0.005);
+
+    // The output interval is split into steps of equal size which respect the CFL condition
+    double const dt = controller.get_time_step(3.0, 1.0);
+    EXPECT_LE(dt, 0.5 / 3.0);
+    EXPECT_DOUBLE_EQ(dt, 1.0 / 6.0);
+
+    // Advancing through the interval reaches the output time exactly
+    double time = 0.0;
+    double const next_output_time = 1.0;
+    int n_steps = 0;
+    while (time < next_output_time) {
+        double const step = controller.get_time_step(7.0, next_output_time - time);
+        time = (step == next_output_time - time) ? next_output_time : time + step;
+        n_steps++;
+    }
+    EXPECT_EQ(time, next_output_time);
+    EXPECT_EQ(n_steps, 14);
+}
+
+TEST(CFLTimeStepController, MinCellWidth)
+{
+    std::vector<Coord<R>> const points {Coord<R>(0.0), Coord<R>(0.5), Coord<R>(0.7), Coord<R>(1.0)};
+    ddc::init_discrete_space<GridR>(GridR::init<GridR>(points));
+    IdxRange<GridR> const idx_range(Idx<GridR>(0), IdxStep<GridR>(points.size()));
+    EXPECT_NEAR(min_cell_width(idx_range), 0.2, 1e-14);
+}
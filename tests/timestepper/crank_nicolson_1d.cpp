@@ -20,6 +20,10 @@ struct GridX : UniformGridBase<X>
 {
 };
 
+struct GridXAnderson : UniformGridBase<X>
+{
+};
+
 TEST(CrankNicolsonFixture, CrankNicolsonOrder)
 {
     using CoordX = Coord<X>;
@@ -86,3 +90,96 @@ TEST(CrankNicolsonFixture, CrankNicolsonOrder)
         EXPECT_NEAR(order[j], 2., 1e-1);
     }
 }
+
+TEST(CrankNicolsonFixture, CrankNicolsonAnderson)
+{
+    using CoordX = Coord<X>;
+    using IdxX = Idx<GridXAnderson>;
+    using IdxStepX = IdxStep<GridXAnderson>;
+    using IdxRangeX = IdxRange<GridXAnderson>;
+    using DFieldMemX = host_t<DFieldMem<IdxRangeX>>;
+    using Method = CrankNicolson<DFieldMemX, DFieldMemX, Kokkos::DefaultHostExecutionSpace>;
+
+    CoordX x_min(0.0);
+    CoordX x_max(1.0);
+    IdxStepX x_size(10);
+
+    IdxX start(0);
+
+    ddc::init_discrete_space<GridXAnderson>(GridXAnderson::init(x_min, x_max, x_size));
+    IdxRangeX idx_range(start, x_size);
+
+    // The fixed point iteration converges slowly as dt * decay_rate / 2 = 0.9
+    double const dt(0.1);
+    double const decay_rate(18.0);
+    double const amplification = (1.0 - 0.5 * dt * decay_rate) / (1.0 + 0.5 * dt * decay_rate);
+
+    Method fixed_point(idx_range, 500, 1e-12);
+    Method anderson(idx_range, 500, 1e-12, 3);
+
+    DFieldMemX vals_fixed_point(idx_range);
+    DFieldMemX vals_anderson(idx_range);
+    ddc::host_for_each(idx_range, [&](IdxX ix) {
+        vals_fixed_point(ix) = double(ix - idx_range.front()) + 1.0;
+        vals_anderson(ix) = double(ix - idx_range.front()) + 1.0;
+    });
+
+    int n_calls_fixed_point = 0;
+    fixed_point
+            .update(get_field(vals_fixed_point),
+                    dt,
+                    [&](host_t<DField<IdxRangeX>> dy, host_t<DConstField<IdxRangeX>> y) {
+                        n_calls_fixed_point++;
+                        ddc::host_for_each(idx_range, [&](IdxX ix) {
+                            dy(ix) = -decay_rate * y(ix);
+                        });
+                    });
+
+    int n_calls_anderson = 0;
+    anderson.update(
+            get_field(vals_anderson),
+            dt,
+            [&](host_t<DField<IdxRangeX>> dy, host_t<DConstField<IdxRangeX>> y) {
+                n_calls_anderson++;
+                ddc::host_for_each(idx_range, [&](IdxX ix) { dy(ix) = -decay_rate * y(ix); });
+            });
+
+    ddc::host_for_each(idx_range, [&](IdxX ix) {
+        double const expected = (double(ix - idx_range.front()) + 1.0) * amplification;
+        EXPECT_NEAR(vals_fixed_point(ix), expected, 1e-9);
+        EXPECT_NEAR(vals_anderson(ix), expected, 1e-9);
+    });
+    EXPECT_LT(10 * n_calls_anderson, n_calls_fixed_point);
+}
+
+TEST(CrankNicolsonFixture, CrankNicolsonAndersonScalar)
+{
+    using Method = CrankNicolson<double>;
+
+    // The fixed point iteration converges slowly as dt * decay_rate / 2 = 0.9
+    double const dt(0.1);
+    double const decay_rate(18.0);
+    double const amplification = (1.0 - 0.5 * dt * decay_rate) / (1.0 + 0.5 * dt * decay_rate);
+
+    Method fixed_point(500, 1e-12);
+    Method anderson(500, 1e-12, 1);
+
+    double val_fixed_point = 2.0;
+    double val_anderson = 2.0;
+
+    int n_calls_fixed_point = 0;
+    fixed_point.update(val_fixed_point, dt, [&](double& dy, double y) {
+        n_calls_fixed_point++;
+        dy = -decay_rate * y;
+    });
+
+    int n_calls_anderson = 0;
+    anderson.update(val_anderson, dt, [&](double& dy, double y) {
+        n_calls_anderson++;
+        dy = -decay_rate * y;
+    });
+
+    EXPECT_NEAR(val_fixed_point, 2.0 * amplification, 1e-9);
+    EXPECT_NEAR(val_anderson, 2.0 * amplification, 1e-9);
+    EXPECT_LT(10 * n_calls_anderson, n_calls_fixed_point);
+}
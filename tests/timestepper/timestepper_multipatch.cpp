@@ -51,8 +51,8 @@ using VectorFieldRTheta2 = DVectorFieldOnPatch<Patch2>;
 using VectorConstFieldRTheta1 = DVectorConstFieldOnPatch<Patch1>;
 using VectorConstFieldRTheta2 = DVectorConstFieldOnPatch<Patch2>;
 
-template <class TimeStepper>
-void multipatch_timestepper_test(double expected_order)
+template <class TimeStepper, class... TimeStepperArgs>
+void multipatch_timestepper_test(double expected_order, TimeStepperArgs... time_stepper_args)
 {
     int constexpr Ntests = 5;
     std::array<double, Ntests> error;
@@ -81,7 +81,7 @@ void multipatch_timestepper_test(double expected_order)
     DMultipatchFieldMemR vals_alloc(idx_ranges);
     DMultipatchFieldR vals(vals_alloc);
 
-    TimeStepper timestepper(idx_ranges);
+    TimeStepper timestepper(idx_ranges, time_stepper_args...);
 
     host_t<DFieldMem<IdxRange<GridR<1>>>> result_patch1(idx_range_1);
     host_t<DFieldMem<IdxRange<GridR<2>>>> result_patch2(idx_range_2);
@@ -166,8 +166,8 @@ void multipatch_timestepper_test(double expected_order)
     }
 }
 
-template <class TimeStepper>
-void multipatch_timestepper_2D_test(double expected_order)
+template <class TimeStepper, class... TimeStepperArgs>
+void multipatch_timestepper_2D_test(double expected_order, TimeStepperArgs... time_stepper_args)
 {
     int constexpr Ntests = 2;
     std::array<double, Ntests> error;
@@ -217,7 +217,7 @@ void multipatch_timestepper_2D_test(double expected_order)
     CMultipatchFieldMemRTheta vals_alloc(idx_ranges);
     CMultipatchFieldRTheta vals(vals_alloc);
 
-    TimeStepper timestepper(idx_ranges);
+    TimeStepper timestepper(idx_ranges, time_stepper_args...);
 
     host_t<FieldMem<CoordRTheta, IdxRange<GridR<1>, GridTheta<1>>>> result_patch1(idx_range_1);
     host_t<FieldMem<CoordRTheta, IdxRange<GridR<2>, GridTheta<2>>>> result_patch2(idx_range_2);
@@ -355,6 +355,11 @@ TEST(CrankNicolsonFixture, Multipatch)
     multipatch_timestepper_test<CrankNicolson<DMultipatchFieldMemR>>(2.0);
 }
 
+TEST(CrankNicolsonFixture, MultipatchAnderson)
+{
+    multipatch_timestepper_test<CrankNicolson<DMultipatchFieldMemR>>(2.0, 20, 1e-12, 3);
+}
+
 TEST(EulerFixture, Multipatch2D)
 {
     multipatch_timestepper_2D_test<
@@ -385,4 +390,14 @@ TEST(CrankNicolsonFixture, Multipatch2D)
             CrankNicolson<CMultipatchFieldMemRTheta, CMultipatchVectorFieldMemRTheta>>(2.0);
 }
 
+TEST(CrankNicolsonFixture, Multipatch2DAnderson)
+{
+    multipatch_timestepper_2D_test<
+            CrankNicolson<CMultipatchFieldMemRTheta, CMultipatchVectorFieldMemRTheta>>(
+            2.0,
+            20,
+            1e-12,
+            3);
+}
+
 } // namespace